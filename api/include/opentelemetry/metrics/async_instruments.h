@@ -0,0 +1,106 @@
+#pragma once
+
+#include <initializer_list>
+#include <utility>
+
+#include "opentelemetry/common/attribute_value.h"
+#include "opentelemetry/metrics/instrument.h"
+#include "opentelemetry/nostd/span.h"
+#include "opentelemetry/nostd/type_traits.h"
+#include "opentelemetry/trace/key_value_iterable_view.h"
+#include "opentelemetry/version.h"
+
+OPENTELEMETRY_BEGIN_NAMESPACE
+namespace metrics
+{
+/**
+ * Receives the observations of an asynchronous instrument during a collection. A single
+ * callback may observe any number of label sets; observing a label set again replaces its
+ * previous observation.
+ *
+ * @tparam T the type of the values observed, either int64_t or double
+ */
+template <class T>
+class ObserverResult
+{
+public:
+  virtual ~ObserverResult() = default;
+
+  /**
+   * Observe the current value of the given label set.
+   * @param value the value observed
+   * @param labels the labels identifying the observed value
+   */
+  virtual void Observe(T value, const trace::KeyValueIterable &labels) noexcept = 0;
+
+  void Observe(T value) noexcept
+  {
+    this->Observe(value,
+                  nostd::span<const std::pair<nostd::string_view, common::AttributeValue>>{});
+  }
+
+  template <class U, nostd::enable_if_t<trace::detail::is_key_value_iterable<U>::value> * = nullptr>
+  void Observe(T value, const U &labels) noexcept
+  {
+    this->Observe(value, trace::KeyValueIterableView<U>(labels));
+  }
+
+  void Observe(
+      T value,
+      std::initializer_list<std::pair<nostd::string_view, common::AttributeValue>> labels) noexcept
+  {
+    this->Observe(value, nostd::span<const std::pair<nostd::string_view, common::AttributeValue>>{
+                             labels.begin(), labels.end()});
+  }
+};
+
+/**
+ * The callback of an asynchronous instrument. It is only called from the thread collecting the
+ * instrument, once per collection, and reports every observed label set through the result,
+ * which must not be used after the callback returns.
+ * @param result receives the observations
+ * @param state the state pointer passed when the instrument was created
+ */
+template <class T>
+using ObserverCallback = void (*)(ObserverResult<T> &result, void *state);
+
+/**
+ * An asynchronous instrument that observes monotonically increasing sums, e.g. the CPU time
+ * used by a process, when they are cheaper to read than to update on every change.
+ *
+ * @tparam T the type of the values observed, either int64_t or double
+ */
+template <class T>
+class SumObserver : public Instrument
+{
+public:
+  InstrumentKind GetKind() const noexcept override { return InstrumentKind::SumObserver; }
+};
+
+/**
+ * An asynchronous instrument that observes sums that may go up and down, e.g. the size of a
+ * queue or the number of connections in a pool.
+ *
+ * @tparam T the type of the values observed, either int64_t or double
+ */
+template <class T>
+class UpDownSumObserver : public Instrument
+{
+public:
+  InstrumentKind GetKind() const noexcept override { return InstrumentKind::UpDownSumObserver; }
+};
+
+/**
+ * An asynchronous instrument that observes the current value of a gauge, e.g. a temperature or
+ * the memory utilization of a process.
+ *
+ * @tparam T the type of the values observed, either int64_t or double
+ */
+template <class T>
+class ValueObserver : public Instrument
+{
+public:
+  InstrumentKind GetKind() const noexcept override { return InstrumentKind::ValueObserver; }
+};
+}  // namespace metrics
+OPENTELEMETRY_END_NAMESPACE
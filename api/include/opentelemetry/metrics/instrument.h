@@ -0,0 +1,75 @@
+#pragma once
+
+#include "opentelemetry/nostd/string_view.h"
+#include "opentelemetry/version.h"
+
+OPENTELEMETRY_BEGIN_NAMESPACE
+namespace metrics
+{
+/**
+ * The kinds of metric instruments.
+ */
+enum class InstrumentKind
+{
+  /**
+   * A synchronous instrument that records monotonically increasing sums.
+   */
+  Counter,
+
+  /**
+   * A synchronous instrument that records sums that may go up and down.
+   */
+  UpDownCounter,
+
+  /**
+   * A synchronous instrument that records a distribution of values.
+   */
+  ValueRecorder,
+
+  /**
+   * An asynchronous instrument that observes monotonically increasing sums.
+   */
+  SumObserver,
+
+  /**
+   * An asynchronous instrument that observes sums that may go up and down.
+   */
+  UpDownSumObserver,
+
+  /**
+   * An asynchronous instrument that observes the current value of a gauge.
+   */
+  ValueObserver,
+};
+
+/**
+ * The base of every metric instrument. An instrument is created by a Meter and identified by
+ * its name.
+ */
+class Instrument
+{
+public:
+  virtual ~Instrument() = default;
+
+  /**
+   * @return the name of this instrument
+   */
+  virtual nostd::string_view GetName() const noexcept = 0;
+
+  /**
+   * @return the human readable description of this instrument
+   */
+  virtual nostd::string_view GetDescription() const noexcept = 0;
+
+  /**
+   * @return the unit of the values recorded by this instrument, e.g. "ms" or "By"
+   */
+  virtual nostd::string_view GetUnit() const noexcept = 0;
+
+  /**
+   * @return the kind of this instrument
+   */
+  virtual InstrumentKind GetKind() const noexcept = 0;
+};
+}  // namespace metrics
+OPENTELEMETRY_END_NAMESPACE
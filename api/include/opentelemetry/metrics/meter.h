@@ -1,18 +1,154 @@
 #pragma once
+
+#include <cstdint>
+
+#include "opentelemetry/metrics/async_instruments.h"
+#include "opentelemetry/metrics/sync_instruments.h"
+#include "opentelemetry/nostd/shared_ptr.h"
+#include "opentelemetry/nostd/string_view.h"
 #include "opentelemetry/version.h"
 
 OPENTELEMETRY_BEGIN_NAMESPACE
-
 namespace metrics
 {
-
+/**
+ * Creates metric instruments.
+ *
+ * Instruments are identified by their name; creating an instrument with the name of an
+ * existing instrument returns a new handle to the same underlying data if the kinds match.
+ */
 class Meter
 {
 public:
-  Meter() = default;
+  virtual ~Meter() = default;
 
-};
+  /**
+   * Creates a Counter that records int64_t values.
+   * @param name the name of the instrument
+   * @param description a human readable description of what the instrument records
+   * @param unit the unit of the recorded values
+   * @return the new instrument, never a nullptr
+   */
+  virtual nostd::shared_ptr<Counter<int64_t>> NewIntCounter(
+      nostd::string_view name,
+      nostd::string_view description = "",
+      nostd::string_view unit        = "") noexcept = 0;
+
+  /**
+   * Creates a Counter that records double values.
+   * @see NewIntCounter
+   */
+  virtual nostd::shared_ptr<Counter<double>> NewDoubleCounter(
+      nostd::string_view name,
+      nostd::string_view description = "",
+      nostd::string_view unit        = "") noexcept = 0;
+
+  /**
+   * Creates an UpDownCounter that records int64_t values.
+   * @see NewIntCounter
+   */
+  virtual nostd::shared_ptr<UpDownCounter<int64_t>> NewIntUpDownCounter(
+      nostd::string_view name,
+      nostd::string_view description = "",
+      nostd::string_view unit        = "") noexcept = 0;
 
-} // namespace metrics
+  /**
+   * Creates an UpDownCounter that records double values.
+   * @see NewIntCounter
+   */
+  virtual nostd::shared_ptr<UpDownCounter<double>> NewDoubleUpDownCounter(
+      nostd::string_view name,
+      nostd::string_view description = "",
+      nostd::string_view unit        = "") noexcept = 0;
 
+  /**
+   * Creates a ValueRecorder that records int64_t values.
+   * @see NewIntCounter
+   */
+  virtual nostd::shared_ptr<ValueRecorder<int64_t>> NewIntValueRecorder(
+      nostd::string_view name,
+      nostd::string_view description = "",
+      nostd::string_view unit        = "") noexcept = 0;
+
+  /**
+   * Creates a ValueRecorder that records double values.
+   * @see NewIntCounter
+   */
+  virtual nostd::shared_ptr<ValueRecorder<double>> NewDoubleValueRecorder(
+      nostd::string_view name,
+      nostd::string_view description = "",
+      nostd::string_view unit        = "") noexcept = 0;
+  /**
+   * Creates a SumObserver that observes int64_t values.
+   * @param name the name of the instrument
+   * @param description a human readable description of what the instrument observes
+   * @param unit the unit of the observed values
+   * @param callback called on every collection to observe the values
+   * @param state passed to every call of the callback; must stay valid as long as the
+   * instrument exists
+   * @return the new instrument, never a nullptr
+   */
+  virtual nostd::shared_ptr<SumObserver<int64_t>> NewIntSumObserver(
+      nostd::string_view name,
+      nostd::string_view description,
+      nostd::string_view unit,
+      ObserverCallback<int64_t> callback,
+      void *state = nullptr) noexcept = 0;
+
+  /**
+   * Creates a SumObserver that observes double values.
+   * @see NewIntSumObserver
+   */
+  virtual nostd::shared_ptr<SumObserver<double>> NewDoubleSumObserver(
+      nostd::string_view name,
+      nostd::string_view description,
+      nostd::string_view unit,
+      ObserverCallback<double> callback,
+      void *state = nullptr) noexcept = 0;
+
+  /**
+   * Creates an UpDownSumObserver that observes int64_t values.
+   * @see NewIntSumObserver
+   */
+  virtual nostd::shared_ptr<UpDownSumObserver<int64_t>> NewIntUpDownSumObserver(
+      nostd::string_view name,
+      nostd::string_view description,
+      nostd::string_view unit,
+      ObserverCallback<int64_t> callback,
+      void *state = nullptr) noexcept = 0;
+
+  /**
+   * Creates an UpDownSumObserver that observes double values.
+   * @see NewIntSumObserver
+   */
+  virtual nostd::shared_ptr<UpDownSumObserver<double>> NewDoubleUpDownSumObserver(
+      nostd::string_view name,
+      nostd::string_view description,
+      nostd::string_view unit,
+      ObserverCallback<double> callback,
+      void *state = nullptr) noexcept = 0;
+
+  /**
+   * Creates a ValueObserver that observes int64_t values.
+   * @see NewIntSumObserver
+   */
+  virtual nostd::shared_ptr<ValueObserver<int64_t>> NewIntValueObserver(
+      nostd::string_view name,
+      nostd::string_view description,
+      nostd::string_view unit,
+      ObserverCallback<int64_t> callback,
+      void *state = nullptr) noexcept = 0;
+
+  /**
+   * Creates a ValueObserver that observes double values.
+   * @see NewIntSumObserver
+   */
+  virtual nostd::shared_ptr<ValueObserver<double>> NewDoubleValueObserver(
+      nostd::string_view name,
+      nostd::string_view description,
+      nostd::string_view unit,
+      ObserverCallback<double> callback,
+      void *state = nullptr) noexcept = 0;
+};
+}  // namespace metrics
 OPENTELEMETRY_END_NAMESPACE
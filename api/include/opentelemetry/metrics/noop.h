@@ -4,8 +4,10 @@
 // This file is part of the internal implementation of OpenTelemetry. Nothing in this file should be
 // used directly. Please refer to meter.h for documentation on these interfaces.
 
+#include "opentelemetry/metrics/async_instruments.h"
 #include "opentelemetry/metrics/meter.h"
 #include "opentelemetry/metrics/meter_provider.h"
+#include "opentelemetry/metrics/sync_instruments.h"
 #include "opentelemetry/nostd/string_view.h"
 #include "opentelemetry/nostd/unique_ptr.h"
 #include "opentelemetry/version.h"
@@ -16,10 +18,278 @@ OPENTELEMETRY_BEGIN_NAMESPACE
 namespace metrics
 {
 /**
- * No-op implementation of a MeterProvider.
+ * No-op implementation of BoundCounter. This class should not be used directly.
+ */
+template <class T>
+class NoopBoundCounter final : public BoundCounter<T>
+{
+public:
+  void Add(T /*value*/) noexcept override {}
+
+  void Unbind() noexcept override {}
+};
+
+/**
+ * No-op implementation of Counter. This class should not be used directly.
+ */
+template <class T>
+class NoopCounter final : public Counter<T>
+{
+public:
+  using Counter<T>::Add;
+  using Counter<T>::Bind;
+
+  void Add(T /*value*/, const trace::KeyValueIterable & /*labels*/) noexcept override {}
+
+  nostd::shared_ptr<BoundCounter<T>> Bind(
+      const trace::KeyValueIterable & /*labels*/) noexcept override
+  {
+    return nostd::shared_ptr<BoundCounter<T>>{new (std::nothrow) NoopBoundCounter<T>};
+  }
+
+  nostd::string_view GetName() const noexcept override { return ""; }
+
+  nostd::string_view GetDescription() const noexcept override { return ""; }
+
+  nostd::string_view GetUnit() const noexcept override { return ""; }
+};
+
+/**
+ * No-op implementation of BoundUpDownCounter. This class should not be used directly.
+ */
+template <class T>
+class NoopBoundUpDownCounter final : public BoundUpDownCounter<T>
+{
+public:
+  void Add(T /*value*/) noexcept override {}
+
+  void Unbind() noexcept override {}
+};
+
+/**
+ * No-op implementation of UpDownCounter. This class should not be used directly.
+ */
+template <class T>
+class NoopUpDownCounter final : public UpDownCounter<T>
+{
+public:
+  using UpDownCounter<T>::Add;
+  using UpDownCounter<T>::Bind;
+
+  void Add(T /*value*/, const trace::KeyValueIterable & /*labels*/) noexcept override {}
+
+  nostd::shared_ptr<BoundUpDownCounter<T>> Bind(
+      const trace::KeyValueIterable & /*labels*/) noexcept override
+  {
+    return nostd::shared_ptr<BoundUpDownCounter<T>>{new (std::nothrow) NoopBoundUpDownCounter<T>};
+  }
+
+  nostd::string_view GetName() const noexcept override { return ""; }
+
+  nostd::string_view GetDescription() const noexcept override { return ""; }
+
+  nostd::string_view GetUnit() const noexcept override { return ""; }
+};
+
+/**
+ * No-op implementation of BoundValueRecorder. This class should not be used directly.
+ */
+template <class T>
+class NoopBoundValueRecorder final : public BoundValueRecorder<T>
+{
+public:
+  void Record(T /*value*/) noexcept override {}
+
+  void Unbind() noexcept override {}
+};
+
+/**
+ * No-op implementation of ValueRecorder. This class should not be used directly.
+ */
+template <class T>
+class NoopValueRecorder final : public ValueRecorder<T>
+{
+public:
+  using ValueRecorder<T>::Record;
+  using ValueRecorder<T>::Bind;
+
+  void Record(T /*value*/, const trace::KeyValueIterable & /*labels*/) noexcept override {}
+
+  nostd::shared_ptr<BoundValueRecorder<T>> Bind(
+      const trace::KeyValueIterable & /*labels*/) noexcept override
+  {
+    return nostd::shared_ptr<BoundValueRecorder<T>>{new (std::nothrow) NoopBoundValueRecorder<T>};
+  }
+
+  nostd::string_view GetName() const noexcept override { return ""; }
+
+  nostd::string_view GetDescription() const noexcept override { return ""; }
+
+  nostd::string_view GetUnit() const noexcept override { return ""; }
+};
+
+/**
+ * No-op implementation of SumObserver. This class should not be used directly.
+ */
+template <class T>
+class NoopSumObserver final : public SumObserver<T>
+{
+public:
+  nostd::string_view GetName() const noexcept override { return ""; }
+
+  nostd::string_view GetDescription() const noexcept override { return ""; }
+
+  nostd::string_view GetUnit() const noexcept override { return ""; }
+};
+
+/**
+ * No-op implementation of UpDownSumObserver. This class should not be used directly.
+ */
+template <class T>
+class NoopUpDownSumObserver final : public UpDownSumObserver<T>
+{
+public:
+  nostd::string_view GetName() const noexcept override { return ""; }
+
+  nostd::string_view GetDescription() const noexcept override { return ""; }
+
+  nostd::string_view GetUnit() const noexcept override { return ""; }
+};
+
+/**
+ * No-op implementation of ValueObserver. This class should not be used directly.
+ */
+template <class T>
+class NoopValueObserver final : public ValueObserver<T>
+{
+public:
+  nostd::string_view GetName() const noexcept override { return ""; }
+
+  nostd::string_view GetDescription() const noexcept override { return ""; }
+
+  nostd::string_view GetUnit() const noexcept override { return ""; }
+};
+
+/**
+ * No-op implementation of Meter.
  */
-class NoopMeter final : public Meter, public std::enable_shared_from_this<NoopMeter> {};
+class NoopMeter final : public Meter, public std::enable_shared_from_this<NoopMeter>
+{
+public:
+  nostd::shared_ptr<Counter<int64_t>> NewIntCounter(nostd::string_view /*name*/,
+                                                    nostd::string_view /*description*/,
+                                                    nostd::string_view /*unit*/) noexcept override
+  {
+    return nostd::shared_ptr<Counter<int64_t>>{new (std::nothrow) NoopCounter<int64_t>};
+  }
+
+  nostd::shared_ptr<Counter<double>> NewDoubleCounter(nostd::string_view /*name*/,
+                                                      nostd::string_view /*description*/,
+                                                      nostd::string_view /*unit*/) noexcept override
+  {
+    return nostd::shared_ptr<Counter<double>>{new (std::nothrow) NoopCounter<double>};
+  }
+
+  nostd::shared_ptr<UpDownCounter<int64_t>> NewIntUpDownCounter(
+      nostd::string_view /*name*/,
+      nostd::string_view /*description*/,
+      nostd::string_view /*unit*/) noexcept override
+  {
+    return nostd::shared_ptr<UpDownCounter<int64_t>>{new (std::nothrow)
+                                                         NoopUpDownCounter<int64_t>};
+  }
 
+  nostd::shared_ptr<UpDownCounter<double>> NewDoubleUpDownCounter(
+      nostd::string_view /*name*/,
+      nostd::string_view /*description*/,
+      nostd::string_view /*unit*/) noexcept override
+  {
+    return nostd::shared_ptr<UpDownCounter<double>>{new (std::nothrow) NoopUpDownCounter<double>};
+  }
+
+  nostd::shared_ptr<ValueRecorder<int64_t>> NewIntValueRecorder(
+      nostd::string_view /*name*/,
+      nostd::string_view /*description*/,
+      nostd::string_view /*unit*/) noexcept override
+  {
+    return nostd::shared_ptr<ValueRecorder<int64_t>>{new (std::nothrow)
+                                                         NoopValueRecorder<int64_t>};
+  }
+
+  nostd::shared_ptr<ValueRecorder<double>> NewDoubleValueRecorder(
+      nostd::string_view /*name*/,
+      nostd::string_view /*description*/,
+      nostd::string_view /*unit*/) noexcept override
+  {
+    return nostd::shared_ptr<ValueRecorder<double>>{new (std::nothrow) NoopValueRecorder<double>};
+  }
+
+  nostd::shared_ptr<SumObserver<int64_t>> NewIntSumObserver(
+      nostd::string_view /*name*/,
+      nostd::string_view /*description*/,
+      nostd::string_view /*unit*/,
+      ObserverCallback<int64_t> /*callback*/,
+      void * /*state*/) noexcept override
+  {
+    return nostd::shared_ptr<SumObserver<int64_t>>{new (std::nothrow) NoopSumObserver<int64_t>};
+  }
+
+  nostd::shared_ptr<SumObserver<double>> NewDoubleSumObserver(
+      nostd::string_view /*name*/,
+      nostd::string_view /*description*/,
+      nostd::string_view /*unit*/,
+      ObserverCallback<double> /*callback*/,
+      void * /*state*/) noexcept override
+  {
+    return nostd::shared_ptr<SumObserver<double>>{new (std::nothrow) NoopSumObserver<double>};
+  }
+
+  nostd::shared_ptr<UpDownSumObserver<int64_t>> NewIntUpDownSumObserver(
+      nostd::string_view /*name*/,
+      nostd::string_view /*description*/,
+      nostd::string_view /*unit*/,
+      ObserverCallback<int64_t> /*callback*/,
+      void * /*state*/) noexcept override
+  {
+    return nostd::shared_ptr<UpDownSumObserver<int64_t>>{new (std::nothrow)
+                                                           NoopUpDownSumObserver<int64_t>};
+  }
+
+  nostd::shared_ptr<UpDownSumObserver<double>> NewDoubleUpDownSumObserver(
+      nostd::string_view /*name*/,
+      nostd::string_view /*description*/,
+      nostd::string_view /*unit*/,
+      ObserverCallback<double> /*callback*/,
+      void * /*state*/) noexcept override
+  {
+    return nostd::shared_ptr<UpDownSumObserver<double>>{new (std::nothrow)
+                                                           NoopUpDownSumObserver<double>};
+  }
+
+  nostd::shared_ptr<ValueObserver<int64_t>> NewIntValueObserver(
+      nostd::string_view /*name*/,
+      nostd::string_view /*description*/,
+      nostd::string_view /*unit*/,
+      ObserverCallback<int64_t> /*callback*/,
+      void * /*state*/) noexcept override
+  {
+    return nostd::shared_ptr<ValueObserver<int64_t>>{new (std::nothrow) NoopValueObserver<int64_t>};
+  }
+
+  nostd::shared_ptr<ValueObserver<double>> NewDoubleValueObserver(
+      nostd::string_view /*name*/,
+      nostd::string_view /*description*/,
+      nostd::string_view /*unit*/,
+      ObserverCallback<double> /*callback*/,
+      void * /*state*/) noexcept override
+  {
+    return nostd::shared_ptr<ValueObserver<double>>{new (std::nothrow) NoopValueObserver<double>};
+  }
+};
+
+/**
+ * No-op implementation of a MeterProvider.
+ */
 class NoopMeterProvider final : public opentelemetry::metrics::MeterProvider
 {
 public:
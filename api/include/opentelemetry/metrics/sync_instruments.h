@@ -0,0 +1,273 @@
+#pragma once
+
+#include <initializer_list>
+#include <utility>
+
+#include "opentelemetry/common/attribute_value.h"
+#include "opentelemetry/metrics/instrument.h"
+#include "opentelemetry/nostd/shared_ptr.h"
+#include "opentelemetry/nostd/span.h"
+#include "opentelemetry/nostd/type_traits.h"
+#include "opentelemetry/trace/key_value_iterable_view.h"
+#include "opentelemetry/version.h"
+
+OPENTELEMETRY_BEGIN_NAMESPACE
+namespace metrics
+{
+/**
+ * A Counter bound to a single label set. Labels are processed once when binding, so Add only
+ * has to update the sum.
+ *
+ * @tparam T the type of the values added, either int64_t or double
+ */
+template <class T>
+class BoundCounter
+{
+public:
+  virtual ~BoundCounter() = default;
+
+  /**
+   * Add a value to the sum of the bound label set. Negative values are ignored.
+   * @param value the value to add
+   */
+  virtual void Add(T value) noexcept = 0;
+
+  /**
+   * Release the binding. Values added after this call are ignored. Destroying the bound
+   * instrument also releases the binding.
+   */
+  virtual void Unbind() noexcept = 0;
+};
+
+/**
+ * A synchronous instrument that adds non-negative values to a sum, e.g. the number of bytes
+ * received or the number of requests served.
+ *
+ * @tparam T the type of the values added, either int64_t or double
+ */
+template <class T>
+class Counter : public Instrument
+{
+public:
+  /**
+   * Add a value to the sum of the given label set. Negative values are ignored.
+   * @param value the value to add
+   * @param labels the labels identifying the sum to update
+   */
+  virtual void Add(T value, const trace::KeyValueIterable &labels) noexcept = 0;
+
+  void Add(T value) noexcept
+  {
+    this->Add(value, nostd::span<const std::pair<nostd::string_view, common::AttributeValue>>{});
+  }
+
+  template <class U, nostd::enable_if_t<trace::detail::is_key_value_iterable<U>::value> * = nullptr>
+  void Add(T value, const U &labels) noexcept
+  {
+    this->Add(value, trace::KeyValueIterableView<U>(labels));
+  }
+
+  void Add(
+      T value,
+      std::initializer_list<std::pair<nostd::string_view, common::AttributeValue>> labels) noexcept
+  {
+    this->Add(value, nostd::span<const std::pair<nostd::string_view, common::AttributeValue>>{
+                         labels.begin(), labels.end()});
+  }
+
+  /**
+   * Bind the instrument to a label set, for repeated updates of the same sum.
+   * @param labels the labels identifying the sum to update
+   * @return the bound instrument, never a nullptr
+   */
+  virtual nostd::shared_ptr<BoundCounter<T>> Bind(
+      const trace::KeyValueIterable &labels) noexcept = 0;
+
+  template <class U, nostd::enable_if_t<trace::detail::is_key_value_iterable<U>::value> * = nullptr>
+  nostd::shared_ptr<BoundCounter<T>> Bind(const U &labels) noexcept
+  {
+    return this->Bind(trace::KeyValueIterableView<U>(labels));
+  }
+
+  nostd::shared_ptr<BoundCounter<T>> Bind(
+      std::initializer_list<std::pair<nostd::string_view, common::AttributeValue>> labels) noexcept
+  {
+    return this->Bind(nostd::span<const std::pair<nostd::string_view, common::AttributeValue>>{
+        labels.begin(), labels.end()});
+  }
+
+  InstrumentKind GetKind() const noexcept override { return InstrumentKind::Counter; }
+};
+
+/**
+ * An UpDownCounter bound to a single label set. Labels are processed once when binding, so Add
+ * only has to update the sum.
+ *
+ * @tparam T the type of the values added, either int64_t or double
+ */
+template <class T>
+class BoundUpDownCounter
+{
+public:
+  virtual ~BoundUpDownCounter() = default;
+
+  /**
+   * Add a value to the sum of the bound label set.
+   * @param value the value to add
+   */
+  virtual void Add(T value) noexcept = 0;
+
+  /**
+   * Release the binding. Values added after this call are ignored. Destroying the bound
+   * instrument also releases the binding.
+   */
+  virtual void Unbind() noexcept = 0;
+};
+
+/**
+ * A synchronous instrument that adds positive or negative values to a sum, e.g. the number of
+ * active requests or the size of a queue.
+ *
+ * @tparam T the type of the values added, either int64_t or double
+ */
+template <class T>
+class UpDownCounter : public Instrument
+{
+public:
+  /**
+   * Add a value to the sum of the given label set.
+   * @param value the value to add
+   * @param labels the labels identifying the sum to update
+   */
+  virtual void Add(T value, const trace::KeyValueIterable &labels) noexcept = 0;
+
+  void Add(T value) noexcept
+  {
+    this->Add(value, nostd::span<const std::pair<nostd::string_view, common::AttributeValue>>{});
+  }
+
+  template <class U, nostd::enable_if_t<trace::detail::is_key_value_iterable<U>::value> * = nullptr>
+  void Add(T value, const U &labels) noexcept
+  {
+    this->Add(value, trace::KeyValueIterableView<U>(labels));
+  }
+
+  void Add(
+      T value,
+      std::initializer_list<std::pair<nostd::string_view, common::AttributeValue>> labels) noexcept
+  {
+    this->Add(value, nostd::span<const std::pair<nostd::string_view, common::AttributeValue>>{
+                         labels.begin(), labels.end()});
+  }
+
+  /**
+   * Bind the instrument to a label set, for repeated updates of the same sum.
+   * @param labels the labels identifying the sum to update
+   * @return the bound instrument, never a nullptr
+   */
+  virtual nostd::shared_ptr<BoundUpDownCounter<T>> Bind(
+      const trace::KeyValueIterable &labels) noexcept = 0;
+
+  template <class U, nostd::enable_if_t<trace::detail::is_key_value_iterable<U>::value> * = nullptr>
+  nostd::shared_ptr<BoundUpDownCounter<T>> Bind(const U &labels) noexcept
+  {
+    return this->Bind(trace::KeyValueIterableView<U>(labels));
+  }
+
+  nostd::shared_ptr<BoundUpDownCounter<T>> Bind(
+      std::initializer_list<std::pair<nostd::string_view, common::AttributeValue>> labels) noexcept
+  {
+    return this->Bind(nostd::span<const std::pair<nostd::string_view, common::AttributeValue>>{
+        labels.begin(), labels.end()});
+  }
+
+  InstrumentKind GetKind() const noexcept override { return InstrumentKind::UpDownCounter; }
+};
+
+/**
+ * A ValueRecorder bound to a single label set. Labels are processed once when binding, so Record
+ * only has to update the distribution.
+ *
+ * @tparam T the type of the values recorded, either int64_t or double
+ */
+template <class T>
+class BoundValueRecorder
+{
+public:
+  virtual ~BoundValueRecorder() = default;
+
+  /**
+   * Record a value in the distribution of the bound label set.
+   * @param value the value to record
+   */
+  virtual void Record(T value) noexcept = 0;
+
+  /**
+   * Release the binding. Values recorded after this call are ignored. Destroying the bound
+   * instrument also releases the binding.
+   */
+  virtual void Unbind() noexcept = 0;
+};
+
+/**
+ * A synchronous instrument that records the distribution of values, e.g. request latencies or
+ * response sizes.
+ *
+ * @tparam T the type of the values recorded, either int64_t or double
+ */
+template <class T>
+class ValueRecorder : public Instrument
+{
+public:
+  /**
+   * Record a value in the distribution of the given label set.
+   * @param value the value to record
+   * @param labels the labels identifying the distribution to update
+   */
+  virtual void Record(T value, const trace::KeyValueIterable &labels) noexcept = 0;
+
+  void Record(T value) noexcept
+  {
+    this->Record(value,
+                 nostd::span<const std::pair<nostd::string_view, common::AttributeValue>>{});
+  }
+
+  template <class U, nostd::enable_if_t<trace::detail::is_key_value_iterable<U>::value> * = nullptr>
+  void Record(T value, const U &labels) noexcept
+  {
+    this->Record(value, trace::KeyValueIterableView<U>(labels));
+  }
+
+  void Record(
+      T value,
+      std::initializer_list<std::pair<nostd::string_view, common::AttributeValue>> labels) noexcept
+  {
+    this->Record(value, nostd::span<const std::pair<nostd::string_view, common::AttributeValue>>{
+                            labels.begin(), labels.end()});
+  }
+
+  /**
+   * Bind the instrument to a label set, for repeated updates of the same distribution.
+   * @param labels the labels identifying the distribution to update
+   * @return the bound instrument, never a nullptr
+   */
+  virtual nostd::shared_ptr<BoundValueRecorder<T>> Bind(
+      const trace::KeyValueIterable &labels) noexcept = 0;
+
+  template <class U, nostd::enable_if_t<trace::detail::is_key_value_iterable<U>::value> * = nullptr>
+  nostd::shared_ptr<BoundValueRecorder<T>> Bind(const U &labels) noexcept
+  {
+    return this->Bind(trace::KeyValueIterableView<U>(labels));
+  }
+
+  nostd::shared_ptr<BoundValueRecorder<T>> Bind(
+      std::initializer_list<std::pair<nostd::string_view, common::AttributeValue>> labels) noexcept
+  {
+    return this->Bind(nostd::span<const std::pair<nostd::string_view, common::AttributeValue>>{
+        labels.begin(), labels.end()});
+  }
+
+  InstrumentKind GetKind() const noexcept override { return InstrumentKind::ValueRecorder; }
+};
+}  // namespace metrics
+OPENTELEMETRY_END_NAMESPACE
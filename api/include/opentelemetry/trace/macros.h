@@ -0,0 +1,93 @@
+#pragma once
+
+#include <atomic>
+
+#include "opentelemetry/nostd/unique_ptr.h"
+#include "opentelemetry/trace/span.h"
+#include "opentelemetry/trace/tracer.h"
+#include "opentelemetry/version.h"
+
+/**
+ * Instrumentation macros that cost nothing when tracing is disabled.
+ *
+ *   OPENTELEMETRY_START_SPAN(span, tracer, "name", {{"key", value}});
+ *   OPENTELEMETRY_SPAN_SET_ATTRIBUTE(span, "key", ComputeValue());
+ *   OPENTELEMETRY_SPAN_ADD_EVENT(span, "event");
+ *   OPENTELEMETRY_SPAN_SET_STATUS(span, CanonicalCode::INTERNAL, "failed");
+ *   OPENTELEMETRY_SPAN_END(span);
+ *
+ * OPENTELEMETRY_START_SPAN declares span as a nostd::unique_ptr<Span>, which ends the span when
+ * it goes out of scope, and takes the arguments of Tracer::StartSpan after a pointer to the
+ * tracer. The other macros take the arguments of the Span methods of the same names.
+ *
+ * Tracing is disabled at runtime by SetTracingEnabled(false), after which OPENTELEMETRY_START_SPAN
+ * only reads a global flag, with a relaxed load, and leaves span empty, which the other macros
+ * skip. It is compiled out by defining OPENTELEMETRY_TRACE_MACROS_DISABLED, after which the
+ * macros generate no code. Either way, the tracer, the name, the attributes and the other
+ * arguments of the macros are not evaluated, so they may be expensive to compute.
+ */
+OPENTELEMETRY_BEGIN_NAMESPACE
+namespace trace
+{
+namespace detail
+{
+inline std::atomic<bool> &GetTracingEnabled() noexcept
+{
+  static std::atomic<bool> enabled(true);
+  return enabled;
+}
+}  // namespace detail
+
+/**
+ * @return whether the tracing macros start spans, which they do unless disabled
+ */
+inline bool IsTracingEnabled() noexcept
+{
+  return detail::GetTracingEnabled().load(std::memory_order_relaxed);
+}
+
+/**
+ * Enable or disable the tracing macros at runtime. Spans that were already started are still
+ * recorded.
+ */
+inline void SetTracingEnabled(bool enabled) noexcept
+{
+  detail::GetTracingEnabled().store(enabled, std::memory_order_relaxed);
+}
+}  // namespace trace
+OPENTELEMETRY_END_NAMESPACE
+
+#ifdef OPENTELEMETRY_TRACE_MACROS_DISABLED
+#  define OPENTELEMETRY_DETAIL_START_SPAN_ENABLED() false
+#  define OPENTELEMETRY_DETAIL_SPAN_ENABLED(span) false
+#else
+#  define OPENTELEMETRY_DETAIL_START_SPAN_ENABLED() ::opentelemetry::trace::IsTracingEnabled()
+#  define OPENTELEMETRY_DETAIL_SPAN_ENABLED(span) static_cast<bool>(span)
+#endif
+
+#define OPENTELEMETRY_START_SPAN(span, tracer, ...)                       \
+  ::opentelemetry::nostd::unique_ptr<::opentelemetry::trace::Span> span = \
+      OPENTELEMETRY_DETAIL_START_SPAN_ENABLED()                           \
+          ? (tracer)->StartSpan(__VA_ARGS__)                              \
+          : ::opentelemetry::nostd::unique_ptr<::opentelemetry::trace::Span>()
+
+// A span that was started is called even if tracing was disabled since.
+#define OPENTELEMETRY_DETAIL_SPAN_CALL(span, call) \
+  do                                               \
+  {                                                \
+    if (OPENTELEMETRY_DETAIL_SPAN_ENABLED(span))   \
+    {                                              \
+      (span)->call;                                \
+    }                                              \
+  } while (false)
+
+#define OPENTELEMETRY_SPAN_SET_ATTRIBUTE(span, ...) \
+  OPENTELEMETRY_DETAIL_SPAN_CALL(span, SetAttribute(__VA_ARGS__))
+
+#define OPENTELEMETRY_SPAN_ADD_EVENT(span, ...) \
+  OPENTELEMETRY_DETAIL_SPAN_CALL(span, AddEvent(__VA_ARGS__))
+
+#define OPENTELEMETRY_SPAN_SET_STATUS(span, ...) \
+  OPENTELEMETRY_DETAIL_SPAN_CALL(span, SetStatus(__VA_ARGS__))
+
+#define OPENTELEMETRY_SPAN_END(span) OPENTELEMETRY_DETAIL_SPAN_CALL(span, End())
@@ -12,6 +12,7 @@
 #include "opentelemetry/version.h"
 
 #include <memory>
+#include <new>
 
 OPENTELEMETRY_BEGIN_NAMESPACE
 namespace trace
@@ -66,6 +67,19 @@ class NoopTracer final : public Tracer, public std::enable_shared_from_this<Noop
     return nostd::unique_ptr<Span>{new (std::nothrow) NoopSpan{this->shared_from_this()}};
   }
 
+  Span *StartSpanInStorage(nostd::string_view /*name*/,
+                           const KeyValueIterable & /*attributes*/,
+                           const StartSpanOptions & /*options*/,
+                           void *storage,
+                           std::size_t storage_size) noexcept override
+  {
+    if (storage_size < sizeof(NoopSpan))
+    {
+      return nullptr;
+    }
+    return new (storage) NoopSpan{this->shared_from_this()};
+  }
+
   void ForceFlushWithMicroseconds(uint64_t /*timeout*/) noexcept override {}
 
   void CloseWithMicroseconds(uint64_t /*timeout*/) noexcept override {}
@@ -0,0 +1,122 @@
+#pragma once
+
+#include <cstddef>
+#include <initializer_list>
+#include <memory>
+#include <new>
+#include <utility>
+
+#include "opentelemetry/nostd/span.h"
+#include "opentelemetry/nostd/string_view.h"
+#include "opentelemetry/nostd/unique_ptr.h"
+#include "opentelemetry/trace/key_value_iterable_view.h"
+#include "opentelemetry/trace/noop.h"
+#include "opentelemetry/trace/span.h"
+#include "opentelemetry/trace/tracer.h"
+#include "opentelemetry/version.h"
+
+OPENTELEMETRY_BEGIN_NAMESPACE
+namespace trace
+{
+/**
+ * A span that is started in the storage of this object, e.g. on the stack, instead of on the
+ * heap, and that ends when this object goes out of scope.
+ *
+ *   ScopedSpan span(tracer, "name", {{"key", value}});
+ *   span->SetAttribute("other key", other_value);
+ *
+ * The span is started with Tracer::StartSpanInStorage. If the tracer can't start spans in
+ * storage, or its spans don't fit, it is started with Tracer::StartSpan instead, and if that fails
+ * too, a NoopSpan is started in the storage, so that the span is never null.
+ */
+class ScopedSpan final
+{
+public:
+  /**
+   * The size of the storage for spans, which fits the spans of the SDK.
+   */
+  static const std::size_t kStorageSize = 128;
+
+  ScopedSpan(Tracer &tracer,
+             nostd::string_view name,
+             const KeyValueIterable &attributes,
+             const StartSpanOptions &options = {}) noexcept
+  {
+    span_ = tracer.StartSpanInStorage(name, attributes, options, &storage_, sizeof(storage_));
+    if (span_ == nullptr)
+    {
+      heap_span_ = tracer.StartSpan(name, attributes, options);
+      span_      = heap_span_.get();
+    }
+    if (span_ == nullptr)
+    {
+      // The NoopSpan doesn't own the tracer, which outlives this object.
+      span_ = new (&storage_) NoopSpan{std::shared_ptr<Tracer>(std::shared_ptr<Tracer>(), &tracer)};
+    }
+  }
+
+  ScopedSpan(Tracer &tracer, nostd::string_view name, const StartSpanOptions &options = {}) noexcept
+      : ScopedSpan(tracer, name, {}, options)
+  {}
+
+  template <class T, nostd::enable_if_t<detail::is_key_value_iterable<T>::value> * = nullptr>
+  ScopedSpan(Tracer &tracer,
+             nostd::string_view name,
+             const T &attributes,
+             const StartSpanOptions &options = {}) noexcept
+      : ScopedSpan(tracer, name, KeyValueIterableView<T>(attributes), options)
+  {}
+
+  ScopedSpan(
+      Tracer &tracer,
+      nostd::string_view name,
+      std::initializer_list<std::pair<nostd::string_view, common::AttributeValue>> attributes,
+      const StartSpanOptions &options = {}) noexcept
+      : ScopedSpan(tracer,
+                   name,
+                   nostd::span<const std::pair<nostd::string_view, common::AttributeValue>>{
+                       attributes.begin(), attributes.end()},
+                   options)
+  {}
+
+  /**
+   * Ends the span, as its destructor does.
+   */
+  ~ScopedSpan()
+  {
+    if (heap_span_ == nullptr)
+    {
+      span_->~Span();
+    }
+  }
+
+  // Not copiable or movable, as the span may be in the storage of this object.
+  ScopedSpan(const ScopedSpan &) = delete;
+  ScopedSpan(ScopedSpan &&)      = delete;
+  ScopedSpan &operator=(const ScopedSpan &) = delete;
+  ScopedSpan &operator=(ScopedSpan &&) = delete;
+
+  Span *operator->() const noexcept { return span_; }
+
+  Span &operator*() const noexcept { return *span_; }
+
+  /**
+   * @return whether the span was started in the storage of this object
+   */
+  bool IsInStorage() const noexcept { return heap_span_ == nullptr; }
+
+private:
+  union Storage
+  {
+    std::max_align_t align;
+    unsigned char bytes[kStorageSize];
+  };
+
+  static_assert(sizeof(NoopSpan) <= kStorageSize, "NoopSpan must fit the storage");
+
+  Span *span_ = nullptr;
+  nostd::unique_ptr<Span> heap_span_;
+  Storage storage_;
+};
+}  // namespace trace
+OPENTELEMETRY_END_NAMESPACE
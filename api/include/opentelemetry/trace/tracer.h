@@ -6,6 +6,7 @@
 #include "opentelemetry/version.h"
 
 #include <chrono>
+#include <cstddef>
 
 OPENTELEMETRY_BEGIN_NAMESPACE
 namespace trace
@@ -82,6 +83,29 @@ class Tracer
   }
 
   virtual void CloseWithMicroseconds(uint64_t timeout) noexcept = 0;
+
+  /**
+   * Starts a span in storage provided by the caller, e.g. by a ScopedSpan, instead of on the heap.
+   * The span is destroyed by calling its destructor, rather than deleted.
+   *
+   * By default spans can't be started in storage, and nullptr is returned, in which case the
+   * caller starts the span with StartSpan instead.
+   *
+   * Declared after the other virtual functions, so that their slots in the vtable stay where
+   * tracers built against earlier headers, e.g. in plugins, have them.
+   *
+   * @param storage the storage, aligned for any type
+   * @param storage_size the size of the storage in bytes
+   * @return the span, or nullptr if it can't be started in the storage
+   */
+  virtual Span *StartSpanInStorage(nostd::string_view /*name*/,
+                                   const KeyValueIterable & /*attributes*/,
+                                   const StartSpanOptions & /*options*/,
+                                   void * /*storage*/,
+                                   std::size_t /*storage_size*/) noexcept
+  {
+    return nullptr;
+  }
 };
 }  // namespace trace
 OPENTELEMETRY_END_NAMESPACE
@@ -0,0 +1,53 @@
+#include "opentelemetry/metrics/noop.h"
+
+#include <map>
+#include <memory>
+#include <string>
+
+#include <gtest/gtest.h>
+
+using opentelemetry::metrics::Meter;
+using opentelemetry::metrics::NoopMeter;
+
+TEST(NoopTest, UseNoopInstruments)
+{
+  std::shared_ptr<Meter> meter{new NoopMeter{}};
+
+  auto counter = meter->NewIntCounter("counter", "a counter", "1");
+  counter->Add(1);
+  counter->Add(1, {{"a", 1}, {"b", "2"}});
+  auto bound_counter = counter->Bind({{"a", 1}});
+  bound_counter->Add(1);
+  bound_counter->Unbind();
+
+  std::map<std::string, std::string> labels;
+  auto up_down_counter = meter->NewDoubleUpDownCounter("up_down_counter");
+  up_down_counter->Add(-1.5, labels);
+
+  auto value_recorder = meter->NewIntValueRecorder("value_recorder");
+  value_recorder->Record(5, {{"a", 1}});
+  value_recorder->Bind(labels)->Record(7);
+
+  EXPECT_EQ(counter->GetName(), "");
+  EXPECT_EQ(up_down_counter->GetKind(), opentelemetry::metrics::InstrumentKind::UpDownCounter);
+}
+
+TEST(NoopTest, UseNoopObservers)
+{
+  std::shared_ptr<Meter> meter{new NoopMeter{}};
+  int calls = 0;
+  auto observer = meter->NewIntValueObserver(
+      "value_observer", "", "",
+      [](opentelemetry::metrics::ObserverResult<int64_t> &result, void *state) {
+        ++*static_cast<int *>(state);
+        result.Observe(1);
+      },
+      &calls);
+
+  // A no-op observer never calls its callback.
+  EXPECT_EQ(calls, 0);
+  EXPECT_EQ(observer->GetName(), "");
+  EXPECT_EQ(observer->GetKind(), opentelemetry::metrics::InstrumentKind::ValueObserver);
+  EXPECT_EQ(meter->NewDoubleSumObserver("sum_observer", "", "", nullptr)->GetKind(),
+            opentelemetry::metrics::InstrumentKind::SumObserver);
+}
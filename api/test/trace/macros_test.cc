@@ -0,0 +1,58 @@
+#include "opentelemetry/trace/macros.h"
+#include "opentelemetry/trace/noop.h"
+
+#include <memory>
+
+#include <gtest/gtest.h>
+
+using opentelemetry::trace::NoopTracer;
+using opentelemetry::trace::Tracer;
+
+namespace
+{
+int evaluated = 0;
+
+std::shared_ptr<Tracer> GetTracer()
+{
+  ++evaluated;
+  static std::shared_ptr<Tracer> tracer{new NoopTracer{}};
+  return tracer;
+}
+
+int GetValue()
+{
+  ++evaluated;
+  return 1;
+}
+}  // namespace
+
+TEST(MacrosTest, StartSpansWhenEnabled)
+{
+  evaluated = 0;
+  EXPECT_TRUE(opentelemetry::trace::IsTracingEnabled());
+
+  OPENTELEMETRY_START_SPAN(span, GetTracer(), "span", {{"a", GetValue()}, {"b", "2"}});
+  ASSERT_TRUE(span);
+  EXPECT_EQ(&span->tracer(), GetTracer().get());
+  OPENTELEMETRY_SPAN_SET_ATTRIBUTE(span, "c", GetValue());
+  OPENTELEMETRY_SPAN_ADD_EVENT(span, "event", {{"d", GetValue()}});
+  OPENTELEMETRY_SPAN_SET_STATUS(span, opentelemetry::trace::CanonicalCode::INTERNAL, "failed");
+  OPENTELEMETRY_SPAN_END(span);
+  EXPECT_EQ(evaluated, 5);
+}
+
+TEST(MacrosTest, EvaluateNothingWhenDisabled)
+{
+  evaluated = 0;
+  opentelemetry::trace::SetTracingEnabled(false);
+
+  OPENTELEMETRY_START_SPAN(span, GetTracer(), "span", {{"a", GetValue()}, {"b", "2"}});
+  EXPECT_FALSE(span);
+  OPENTELEMETRY_SPAN_SET_ATTRIBUTE(span, "c", GetValue());
+  OPENTELEMETRY_SPAN_ADD_EVENT(span, "event", {{"d", GetValue()}});
+  OPENTELEMETRY_SPAN_END(span);
+  EXPECT_EQ(evaluated, 0);
+
+  opentelemetry::trace::SetTracingEnabled(true);
+  EXPECT_TRUE(opentelemetry::trace::IsTracingEnabled());
+}
@@ -0,0 +1,88 @@
+#include "opentelemetry/trace/scoped_span.h"
+#include "opentelemetry/trace/noop.h"
+
+#include <map>
+#include <memory>
+#include <string>
+
+#include <gtest/gtest.h>
+
+using opentelemetry::trace::NoopSpan;
+using opentelemetry::trace::NoopTracer;
+using opentelemetry::trace::ScopedSpan;
+using opentelemetry::trace::Tracer;
+
+namespace
+{
+/**
+ * A tracer that can only start spans on the heap, or none at all if fail is set.
+ */
+class HeapTracer final : public Tracer, public std::enable_shared_from_this<HeapTracer>
+{
+public:
+  opentelemetry::nostd::unique_ptr<opentelemetry::trace::Span> StartSpan(
+      opentelemetry::nostd::string_view /*name*/,
+      const opentelemetry::trace::KeyValueIterable & /*attributes*/,
+      const opentelemetry::trace::StartSpanOptions & /*options*/) noexcept override
+  {
+    ++started;
+    if (fail)
+    {
+      return nullptr;
+    }
+    return opentelemetry::nostd::unique_ptr<opentelemetry::trace::Span>{
+        new NoopSpan{this->shared_from_this()}};
+  }
+
+  void ForceFlushWithMicroseconds(uint64_t /*timeout*/) noexcept override {}
+
+  void CloseWithMicroseconds(uint64_t /*timeout*/) noexcept override {}
+
+  int started = 0;
+  bool fail   = false;
+};
+}  // namespace
+
+TEST(ScopedSpanTest, StartsSpanInStorage)
+{
+  std::shared_ptr<Tracer> tracer{new NoopTracer{}};
+
+  ScopedSpan span1(*tracer, "span 1");
+  EXPECT_TRUE(span1.IsInStorage());
+  EXPECT_EQ(&span1->tracer(), tracer.get());
+
+  std::map<std::string, int> attributes = {{"a", 1}};
+  ScopedSpan span2(*tracer, "span 2", attributes);
+  EXPECT_TRUE(span2.IsInStorage());
+
+  ScopedSpan span3(*tracer, "span 3", {{"a", 1}, {"b", "2"}});
+  EXPECT_TRUE(span3.IsInStorage());
+  span3->SetAttribute("c", 3.0);
+  (*span3).End();
+}
+
+TEST(ScopedSpanTest, StartsSpanOnHeapOtherwise)
+{
+  auto tracer = std::make_shared<HeapTracer>();
+  {
+    ScopedSpan span(*tracer, "span");
+    EXPECT_FALSE(span.IsInStorage());
+    EXPECT_EQ(&span->tracer(), tracer.get());
+  }
+  EXPECT_EQ(tracer->started, 1);
+}
+
+TEST(ScopedSpanTest, StartsNoopSpanIfStartFails)
+{
+  auto tracer  = std::make_shared<HeapTracer>();
+  tracer->fail = true;
+  {
+    ScopedSpan span(*tracer, "span");
+    EXPECT_TRUE(span.IsInStorage());
+    EXPECT_FALSE(span->IsRecording());
+    EXPECT_EQ(&span->tracer(), tracer.get());
+    span->SetAttribute("a", 1);
+  }
+  EXPECT_EQ(tracer->started, 1);
+  EXPECT_EQ(tracer.use_count(), 1);
+}
@@ -0,0 +1,21 @@
+#pragma once
+
+#include <memory>
+
+#include <grpcpp/channel.h>
+
+#include "opentelemetry/version.h"
+
+OPENTELEMETRY_BEGIN_NAMESPACE
+namespace exporter
+{
+namespace otlp
+{
+/**
+ * @return the channel to the OpenTelemetry Collector. It is created on first use and shared by
+ * every OTLP exporter, so that a process sends traces and metrics over a single connection.
+ */
+std::shared_ptr<grpc::Channel> GetCollectorChannel();
+}  // namespace otlp
+}  // namespace exporter
+OPENTELEMETRY_END_NAMESPACE
@@ -0,0 +1,42 @@
+#pragma once
+
+#include <vector>
+
+#include "opentelemetry/core/timestamp.h"
+#include "opentelemetry/proto/metrics/v1/metrics.pb.h"
+#include "opentelemetry/sdk/metrics/record.h"
+#include "opentelemetry/version.h"
+
+OPENTELEMETRY_BEGIN_NAMESPACE
+namespace exporter
+{
+namespace otlp
+{
+/**
+ * The percentiles reported for the summary of a DDSketch.
+ */
+const double kSummaryPercentiles[] = {0, 50, 90, 95, 99, 100};
+
+/**
+ * Encode collected metric records as OTLP metrics.
+ *
+ * Records are encoded straight from the checkpointed values: consecutive records of the same
+ * instrument, as collected from a meter, become the data points of a single metric, and the
+ * data points of every metric are reserved up front. Encoding into a message that was cleared
+ * reuses its data points and strings, so repeated encoding of similar batches does not allocate
+ * memory.
+ *
+ * @param records the records to encode
+ * @param temporality the temporality the records were collected with
+ * @param start_time the start of the interval the records cover
+ * @param end_time the time the records were collected
+ * @param library_metrics receives one metric per instrument
+ */
+void EncodeMetrics(const std::vector<sdk::metrics::MetricRecord> &records,
+                   sdk::metrics::AggregationTemporality temporality,
+                   core::SystemTimestamp start_time,
+                   core::SystemTimestamp end_time,
+                   proto::metrics::v1::InstrumentationLibraryMetrics *library_metrics);
+}  // namespace otlp
+}  // namespace exporter
+OPENTELEMETRY_END_NAMESPACE
@@ -0,0 +1,73 @@
+#pragma once
+
+#include "opentelemetry/proto/collector/metrics/v1/metrics_service.grpc.pb.h"
+#include "opentelemetry/sdk/metrics/exporter.h"
+
+OPENTELEMETRY_BEGIN_NAMESPACE
+namespace exporter
+{
+namespace otlp
+{
+/**
+ * The OTLP metrics exporter exports metric records in OpenTelemetry Protocol (OTLP) format. It
+ * shares its connection to the collector with the OTLP span exporter.
+ */
+class OtlpMetricsExporter final : public opentelemetry::sdk::metrics::MetricExporter
+{
+public:
+  /**
+   * Create an OtlpMetricsExporter. This constructor initializes a service stub to be
+   * used for exporting.
+   * @param temporality the temporality to collect the exported records with
+   */
+  explicit OtlpMetricsExporter(sdk::metrics::AggregationTemporality temporality =
+                                   sdk::metrics::AggregationTemporality::Cumulative);
+
+  sdk::metrics::AggregationTemporality GetAggregationTemporality() const noexcept override
+  {
+    return temporality_;
+  }
+
+  /**
+   * Export a batch of metric records in OTLP format. The request is encoded straight from the
+   * records, into the messages of the previous request: once an export of similar size has been
+   * made, encoding does not allocate memory.
+   */
+  sdk::metrics::ExportResult Export(const std::vector<sdk::metrics::MetricRecord> &records,
+                                    core::SystemTimestamp start_time,
+                                    core::SystemTimestamp end_time) noexcept override;
+
+  /**
+   * Shut down the exporter.
+   * @param timeout an optional timeout, the default timeout of 0 means that no
+   * timeout is applied.
+   */
+  void Shutdown(
+      std::chrono::microseconds timeout = std::chrono::microseconds(0)) noexcept override {};
+
+private:
+  // For testing
+  friend class OtlpMetricsExporterTestPeer;
+
+  const sdk::metrics::AggregationTemporality temporality_;
+
+  // Store service stub internally. Useful for testing.
+  std::unique_ptr<proto::collector::metrics::v1::MetricsService::StubInterface>
+      metrics_service_stub_;
+
+  // Reused by every export.
+  proto::collector::metrics::v1::ExportMetricsServiceRequest request_;
+
+  /**
+   * Create an OtlpMetricsExporter using the specified service stub.
+   * Only tests can call this constructor directly.
+   * @param stub the service stub to be used for exporting
+   * @param temporality the temporality to collect the exported records with
+   */
+  OtlpMetricsExporter(
+      std::unique_ptr<proto::collector::metrics::v1::MetricsService::StubInterface> stub,
+      sdk::metrics::AggregationTemporality temporality);
+};
+}  // namespace otlp
+}  // namespace exporter
+OPENTELEMETRY_END_NAMESPACE
@@ -0,0 +1,23 @@
+#include "opentelemetry/exporters/otlp/channel.h"
+
+#include <grpcpp/grpcpp.h>
+
+OPENTELEMETRY_BEGIN_NAMESPACE
+namespace exporter
+{
+namespace otlp
+{
+namespace
+{
+const char kCollectorAddress[] = "localhost:55678";
+}  // namespace
+
+std::shared_ptr<grpc::Channel> GetCollectorChannel()
+{
+  static const std::shared_ptr<grpc::Channel> channel =
+      grpc::CreateChannel(kCollectorAddress, grpc::InsecureChannelCredentials());
+  return channel;
+}
+}  // namespace otlp
+}  // namespace exporter
+OPENTELEMETRY_END_NAMESPACE
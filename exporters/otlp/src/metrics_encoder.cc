@@ -0,0 +1,179 @@
+#include "opentelemetry/exporters/otlp/metrics_encoder.h"
+
+OPENTELEMETRY_BEGIN_NAMESPACE
+namespace exporter
+{
+namespace otlp
+{
+namespace
+{
+using opentelemetry::metrics::InstrumentKind;
+using proto::metrics::v1::MetricDescriptor;
+using sdk::metrics::AggregationTemporality;
+using sdk::metrics::DDSketch;
+using sdk::metrics::HistogramValue;
+using sdk::metrics::MetricRecord;
+
+/**
+ * Sets the labels and timestamps shared by every kind of data point. A cumulative point starts
+ * when its series was created, rather than at start_time.
+ */
+template <class DataPoint>
+void SetPointBase(const MetricRecord &record,
+                  AggregationTemporality temporality,
+                  uint64_t start_time,
+                  uint64_t end_time,
+                  DataPoint *point)
+{
+  auto &labels = record.labels.GetLabels();
+  point->mutable_labels()->Reserve(static_cast<int>(labels.size()));
+  for (auto &label : labels)
+  {
+    auto label_proto = point->add_labels();
+    label_proto->set_key(label.first);
+    label_proto->set_value(label.second);
+  }
+  point->set_start_time_unix_nano(
+      temporality == AggregationTemporality::Cumulative
+          ? static_cast<uint64_t>(record.start_time.time_since_epoch().count())
+          : start_time);
+  point->set_time_unix_nano(end_time);
+}
+
+MetricDescriptor::Type GetType(InstrumentKind kind, std::size_t value_index) noexcept
+{
+  bool is_monotonic = kind == InstrumentKind::Counter || kind == InstrumentKind::SumObserver;
+  switch (value_index)
+  {
+    case 0:
+      return is_monotonic ? MetricDescriptor::MONOTONIC_INT64 : MetricDescriptor::INT64;
+    case 1:
+      return is_monotonic ? MetricDescriptor::MONOTONIC_DOUBLE : MetricDescriptor::DOUBLE;
+    case 2:
+      return MetricDescriptor::HISTOGRAM;
+    default:
+      return MetricDescriptor::SUMMARY;
+  }
+}
+
+MetricDescriptor::Temporality GetTemporality(InstrumentKind kind,
+                                             AggregationTemporality temporality) noexcept
+{
+  if (kind == InstrumentKind::ValueObserver)
+  {
+    return MetricDescriptor::INSTANTANEOUS;
+  }
+  return temporality == AggregationTemporality::Delta ? MetricDescriptor::DELTA
+                                                      : MetricDescriptor::CUMULATIVE;
+}
+
+/**
+ * Encodes the records [begin, end), which share an instrument and a value type.
+ */
+void EncodeMetric(std::vector<MetricRecord>::const_iterator begin,
+                  std::vector<MetricRecord>::const_iterator end,
+                  AggregationTemporality temporality,
+                  uint64_t start_time,
+                  uint64_t end_time,
+                  proto::metrics::v1::Metric *metric)
+{
+  auto &descriptor  = *begin->descriptor;
+  auto value_index  = begin->value.index();
+  auto point_count  = static_cast<int>(end - begin);
+  auto descriptor_proto = metric->mutable_metric_descriptor();
+  descriptor_proto->set_name(descriptor.name);
+  descriptor_proto->set_description(descriptor.description);
+  descriptor_proto->set_unit(descriptor.unit);
+  descriptor_proto->set_type(GetType(descriptor.kind, value_index));
+  descriptor_proto->set_temporality(GetTemporality(descriptor.kind, temporality));
+
+  switch (value_index)
+  {
+    case 0:
+      metric->mutable_int64_data_points()->Reserve(point_count);
+      for (auto record = begin; record != end; ++record)
+      {
+        auto point = metric->add_int64_data_points();
+        SetPointBase(*record, temporality, start_time, end_time, point);
+        point->set_value(nostd::get<int64_t>(record->value));
+      }
+      break;
+    case 1:
+      metric->mutable_double_data_points()->Reserve(point_count);
+      for (auto record = begin; record != end; ++record)
+      {
+        auto point = metric->add_double_data_points();
+        SetPointBase(*record, temporality, start_time, end_time, point);
+        point->set_value(nostd::get<double>(record->value));
+      }
+      break;
+    case 2:
+      metric->mutable_histogram_data_points()->Reserve(point_count);
+      for (auto record = begin; record != end; ++record)
+      {
+        auto &histogram = nostd::get<HistogramValue>(record->value);
+        auto point      = metric->add_histogram_data_points();
+        SetPointBase(*record, temporality, start_time, end_time, point);
+        point->set_count(histogram.count);
+        point->set_sum(histogram.sum);
+        point->mutable_buckets()->Reserve(static_cast<int>(histogram.counts.size()));
+        for (auto count : histogram.counts)
+        {
+          point->add_buckets()->set_count(count);
+        }
+        point->mutable_explicit_bounds()->Add(histogram.boundaries->begin(),
+                                              histogram.boundaries->end());
+      }
+      break;
+    default:
+      metric->mutable_summary_data_points()->Reserve(point_count);
+      for (auto record = begin; record != end; ++record)
+      {
+        auto &sketch = nostd::get<DDSketch>(record->value);
+        auto point   = metric->add_summary_data_points();
+        SetPointBase(*record, temporality, start_time, end_time, point);
+        point->set_count(sketch.GetCount());
+        point->set_sum(sketch.GetSum());
+        if (sketch.GetCount() == 0)
+        {
+          continue;
+        }
+        point->mutable_percentile_values()->Reserve(
+            static_cast<int>(sizeof(kSummaryPercentiles) / sizeof(kSummaryPercentiles[0])));
+        for (auto percentile : kSummaryPercentiles)
+        {
+          auto value = point->add_percentile_values();
+          value->set_percentile(percentile);
+          value->set_value(sketch.GetQuantile(percentile / 100));
+        }
+      }
+      break;
+  }
+}
+}  // namespace
+
+void EncodeMetrics(const std::vector<MetricRecord> &records,
+                   AggregationTemporality temporality,
+                   core::SystemTimestamp start_time,
+                   core::SystemTimestamp end_time,
+                   proto::metrics::v1::InstrumentationLibraryMetrics *library_metrics)
+{
+  auto start_time_nanos = static_cast<uint64_t>(start_time.time_since_epoch().count());
+  auto end_time_nanos   = static_cast<uint64_t>(end_time.time_since_epoch().count());
+  auto begin            = records.begin();
+  while (begin != records.end())
+  {
+    auto end = begin + 1;
+    while (end != records.end() && end->descriptor == begin->descriptor &&
+           end->value.index() == begin->value.index())
+    {
+      ++end;
+    }
+    EncodeMetric(begin, end, temporality, start_time_nanos, end_time_nanos,
+                 library_metrics->add_metrics());
+    begin = end;
+  }
+}
+}  // namespace otlp
+}  // namespace exporter
+OPENTELEMETRY_END_NAMESPACE
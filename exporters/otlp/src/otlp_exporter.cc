@@ -1,4 +1,5 @@
 #include "opentelemetry/exporters/otlp/otlp_exporter.h"
+#include "opentelemetry/exporters/otlp/channel.h"
 #include "opentelemetry/exporters/otlp/recordable.h"
 
 #include <grpcpp/grpcpp.h>
@@ -10,8 +11,6 @@ namespace exporter
 namespace otlp
 {
 
-const std::string kCollectorAddress = "localhost:55678";
-
 // ----------------------------- Helper functions ------------------------------
 
 /**
@@ -37,8 +36,7 @@ void PopulateRequest(const nostd::span<std::unique_ptr<sdk::trace::Recordable>>
  */
 std::unique_ptr<proto::collector::trace::v1::TraceService::Stub> MakeServiceStub()
 {
-  auto channel = grpc::CreateChannel(kCollectorAddress, grpc::InsecureChannelCredentials());
-  return proto::collector::trace::v1::TraceService::NewStub(channel);
+  return proto::collector::trace::v1::TraceService::NewStub(GetCollectorChannel());
 }
 
 // -------------------------------- Contructors --------------------------------
@@ -0,0 +1,63 @@
+#include "opentelemetry/exporters/otlp/otlp_metrics_exporter.h"
+#include "opentelemetry/exporters/otlp/channel.h"
+#include "opentelemetry/exporters/otlp/metrics_encoder.h"
+
+#include <grpcpp/grpcpp.h>
+#include <iostream>
+
+OPENTELEMETRY_BEGIN_NAMESPACE
+namespace exporter
+{
+namespace otlp
+{
+namespace
+{
+/**
+ * Create service stub to communicate with the OpenTelemetry Collector.
+ */
+std::unique_ptr<proto::collector::metrics::v1::MetricsService::Stub> MakeServiceStub()
+{
+  return proto::collector::metrics::v1::MetricsService::NewStub(GetCollectorChannel());
+}
+}  // namespace
+
+OtlpMetricsExporter::OtlpMetricsExporter(sdk::metrics::AggregationTemporality temporality)
+    : OtlpMetricsExporter(MakeServiceStub(), temporality)
+{}
+
+OtlpMetricsExporter::OtlpMetricsExporter(
+    std::unique_ptr<proto::collector::metrics::v1::MetricsService::StubInterface> stub,
+    sdk::metrics::AggregationTemporality temporality)
+    : temporality_(temporality), metrics_service_stub_(std::move(stub))
+{}
+
+sdk::metrics::ExportResult OtlpMetricsExporter::Export(
+    const std::vector<sdk::metrics::MetricRecord> &records,
+    core::SystemTimestamp start_time,
+    core::SystemTimestamp end_time) noexcept
+{
+  if (records.empty())
+  {
+    return sdk::metrics::ExportResult::kSuccess;
+  }
+
+  // Clearing keeps the messages of the previous request, which are reused for this one.
+  request_.Clear();
+  EncodeMetrics(records, temporality_, start_time, end_time,
+                request_.add_resource_metrics()->add_instrumentation_library_metrics());
+
+  grpc::ClientContext context;
+  proto::collector::metrics::v1::ExportMetricsServiceResponse response;
+
+  grpc::Status status = metrics_service_stub_->Export(&context, request_, &response);
+
+  if (!status.ok())
+  {
+    std::cerr << "[OTLP Metrics Exporter] Export() failed: " << status.error_message() << "\n";
+    return sdk::metrics::ExportResult::kFailure;
+  }
+  return sdk::metrics::ExportResult::kSuccess;
+}
+}  // namespace otlp
+}  // namespace exporter
+OPENTELEMETRY_END_NAMESPACE
@@ -22,9 +22,13 @@ void Recordable::SetAttribute(nostd::string_view key,
   (void)value;
 }
 
-void Recordable::AddEvent(nostd::string_view name, core::SystemTimestamp timestamp) noexcept
+void Recordable::AddEvent(nostd::string_view name,
+                          core::SystemTimestamp timestamp,
+                          const trace::KeyValueIterable &attributes) noexcept
 {
   (void)name;
+  (void)timestamp;
+  (void)attributes;
 }
 
 void Recordable::SetStatus(trace::CanonicalCode code, nostd::string_view description) noexcept
@@ -38,6 +42,28 @@ void Recordable::SetName(nostd::string_view name) noexcept
   span_.set_name(name.data(), name.size());
 }
 
+void Recordable::SetSpanKind(trace::SpanKind span_kind) noexcept
+{
+  switch (span_kind)
+  {
+    case trace::SpanKind::kServer:
+      span_.set_kind(proto::trace::v1::Span::SERVER);
+      break;
+    case trace::SpanKind::kClient:
+      span_.set_kind(proto::trace::v1::Span::CLIENT);
+      break;
+    case trace::SpanKind::kProducer:
+      span_.set_kind(proto::trace::v1::Span::PRODUCER);
+      break;
+    case trace::SpanKind::kConsumer:
+      span_.set_kind(proto::trace::v1::Span::CONSUMER);
+      break;
+    default:
+      span_.set_kind(proto::trace::v1::Span::INTERNAL);
+      break;
+  }
+}
+
 void Recordable::SetStartTime(opentelemetry::core::SystemTimestamp start_time) noexcept
 {
   const uint64_t nano_unix_time = start_time.time_since_epoch().count();
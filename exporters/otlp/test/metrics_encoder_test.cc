@@ -0,0 +1,133 @@
+#include "opentelemetry/exporters/otlp/metrics_encoder.h"
+#include "opentelemetry/sdk/metrics/meter.h"
+
+#include <gtest/gtest.h>
+
+OPENTELEMETRY_BEGIN_NAMESPACE
+namespace exporter
+{
+namespace otlp
+{
+using proto::metrics::v1::MetricDescriptor;
+using sdk::metrics::AggregationTemporality;
+
+const core::SystemTimestamp kStartTime(std::chrono::nanoseconds(1000));
+const core::SystemTimestamp kEndTime(std::chrono::nanoseconds(2000));
+
+proto::metrics::v1::InstrumentationLibraryMetrics Encode(sdk::metrics::Meter &meter,
+                                                         AggregationTemporality temporality)
+{
+  proto::metrics::v1::InstrumentationLibraryMetrics library_metrics;
+  EncodeMetrics(meter.Collect(temporality), temporality, kStartTime, kEndTime, &library_metrics);
+  return library_metrics;
+}
+
+TEST(MetricsEncoder, Sums)
+{
+  sdk::metrics::Meter meter;
+  auto counter = meter.NewIntCounter("requests", "Served requests", "1");
+  counter->Add(1, {{"method", "GET"}});
+  counter->Add(2, {{"method", "POST"}});
+  meter.NewDoubleUpDownCounter("queue_size")->Add(-1.5);
+
+  auto library_metrics = Encode(meter, AggregationTemporality::Delta);
+  ASSERT_EQ(library_metrics.metrics_size(), 2);
+
+  auto &queue_size = library_metrics.metrics(0);
+  EXPECT_EQ(queue_size.metric_descriptor().name(), "queue_size");
+  EXPECT_EQ(queue_size.metric_descriptor().type(), MetricDescriptor::DOUBLE);
+  EXPECT_EQ(queue_size.metric_descriptor().temporality(), MetricDescriptor::DELTA);
+  ASSERT_EQ(queue_size.double_data_points_size(), 1);
+  EXPECT_EQ(queue_size.double_data_points(0).value(), -1.5);
+  EXPECT_EQ(queue_size.double_data_points(0).labels_size(), 0);
+
+  auto &requests = library_metrics.metrics(1);
+  EXPECT_EQ(requests.metric_descriptor().name(), "requests");
+  EXPECT_EQ(requests.metric_descriptor().description(), "Served requests");
+  EXPECT_EQ(requests.metric_descriptor().unit(), "1");
+  EXPECT_EQ(requests.metric_descriptor().type(), MetricDescriptor::MONOTONIC_INT64);
+  ASSERT_EQ(requests.int64_data_points_size(), 2);
+  int64_t sum = 0;
+  for (auto &point : requests.int64_data_points())
+  {
+    ASSERT_EQ(point.labels_size(), 1);
+    EXPECT_EQ(point.labels(0).key(), "method");
+    EXPECT_EQ(point.start_time_unix_nano(), 1000);
+    EXPECT_EQ(point.time_unix_nano(), 2000);
+    sum += point.value();
+  }
+  EXPECT_EQ(sum, 3);
+}
+
+TEST(MetricsEncoder, Histogram)
+{
+  sdk::metrics::Meter meter({10, 100});
+  auto recorder = meter.NewIntValueRecorder("latency", "", "ms");
+  for (int64_t value : {5, 50, 500, 600})
+  {
+    recorder->Record(value);
+  }
+
+  auto library_metrics = Encode(meter, AggregationTemporality::Cumulative);
+  ASSERT_EQ(library_metrics.metrics_size(), 1);
+  auto &metric = library_metrics.metrics(0);
+  EXPECT_EQ(metric.metric_descriptor().type(), MetricDescriptor::HISTOGRAM);
+  EXPECT_EQ(metric.metric_descriptor().temporality(), MetricDescriptor::CUMULATIVE);
+  ASSERT_EQ(metric.histogram_data_points_size(), 1);
+  auto &point = metric.histogram_data_points(0);
+  // Cumulative points start when their series was created.
+  EXPECT_GT(point.start_time_unix_nano(), 1000);
+  EXPECT_EQ(point.count(), 4);
+  EXPECT_EQ(point.sum(), 1155);
+  ASSERT_EQ(point.explicit_bounds_size(), 2);
+  EXPECT_EQ(point.explicit_bounds(1), 100);
+  ASSERT_EQ(point.buckets_size(), 3);
+  EXPECT_EQ(point.buckets(0).count(), 1);
+  EXPECT_EQ(point.buckets(1).count(), 1);
+  EXPECT_EQ(point.buckets(2).count(), 2);
+}
+
+TEST(MetricsEncoder, Summary)
+{
+  sdk::metrics::Meter meter;
+  auto recorder =
+      meter.NewDoubleValueRecorder("latency", "", "ms", sdk::metrics::DDSketchOptions());
+  for (int i = 1; i <= 100; ++i)
+  {
+    recorder->Record(i);
+  }
+
+  auto library_metrics = Encode(meter, AggregationTemporality::Cumulative);
+  ASSERT_EQ(library_metrics.metrics_size(), 1);
+  auto &metric = library_metrics.metrics(0);
+  EXPECT_EQ(metric.metric_descriptor().type(), MetricDescriptor::SUMMARY);
+  ASSERT_EQ(metric.summary_data_points_size(), 1);
+  auto &point = metric.summary_data_points(0);
+  EXPECT_EQ(point.count(), 100);
+  EXPECT_EQ(point.sum(), 5050);
+  ASSERT_EQ(point.percentile_values_size(), 6);
+  EXPECT_EQ(point.percentile_values(0).value(), 1);
+  EXPECT_EQ(point.percentile_values(1).percentile(), 50);
+  EXPECT_NEAR(point.percentile_values(1).value(), 50, 1);
+  EXPECT_EQ(point.percentile_values(5).value(), 100);
+}
+
+TEST(MetricsEncoder, ValueObserverIsInstantaneous)
+{
+  sdk::metrics::Meter meter;
+  meter.NewIntValueObserver("pool_size", "", "",
+                            [](opentelemetry::metrics::ObserverResult<int64_t> &result, void *) {
+                              result.Observe(7);
+                            });
+
+  auto library_metrics = Encode(meter, AggregationTemporality::Delta);
+  ASSERT_EQ(library_metrics.metrics_size(), 1);
+  auto &metric = library_metrics.metrics(0);
+  EXPECT_EQ(metric.metric_descriptor().type(), MetricDescriptor::INT64);
+  EXPECT_EQ(metric.metric_descriptor().temporality(), MetricDescriptor::INSTANTANEOUS);
+  ASSERT_EQ(metric.int64_data_points_size(), 1);
+  EXPECT_EQ(metric.int64_data_points(0).value(), 7);
+}
+}  // namespace otlp
+}  // namespace exporter
+OPENTELEMETRY_END_NAMESPACE
@@ -0,0 +1,64 @@
+#include "opentelemetry/exporters/otlp/otlp_metrics_exporter.h"
+#include "opentelemetry/proto/collector/metrics/v1/metrics_service_mock.grpc.pb.h"
+#include "opentelemetry/sdk/metrics/meter.h"
+
+#include <gtest/gtest.h>
+
+using namespace testing;
+
+OPENTELEMETRY_BEGIN_NAMESPACE
+namespace exporter
+{
+namespace otlp
+{
+
+class OtlpMetricsExporterTestPeer : public ::testing::Test
+{
+public:
+  std::unique_ptr<sdk::metrics::MetricExporter> GetExporter(
+      std::unique_ptr<proto::collector::metrics::v1::MetricsService::StubInterface>
+          &stub_interface,
+      sdk::metrics::AggregationTemporality temporality)
+  {
+    return std::unique_ptr<sdk::metrics::MetricExporter>(
+        new OtlpMetricsExporter(std::move(stub_interface), temporality));
+  }
+};
+
+TEST_F(OtlpMetricsExporterTestPeer, ExportUnitTest)
+{
+  auto mock_stub = new proto::collector::metrics::v1::MockMetricsServiceStub();
+  std::unique_ptr<proto::collector::metrics::v1::MetricsService::StubInterface> stub_interface(
+      mock_stub);
+  auto exporter = GetExporter(stub_interface, sdk::metrics::AggregationTemporality::Delta);
+  EXPECT_EQ(exporter->GetAggregationTemporality(), sdk::metrics::AggregationTemporality::Delta);
+
+  sdk::metrics::Meter meter;
+  meter.NewIntCounter("requests")->Add(1);
+  auto records = meter.Collect(sdk::metrics::AggregationTemporality::Delta);
+
+  // Test successful RPC
+  proto::collector::metrics::v1::ExportMetricsServiceRequest request;
+  EXPECT_CALL(*mock_stub, Export(_, _, _))
+      .Times(Exactly(1))
+      .WillOnce(DoAll(SaveArg<1>(&request), Return(grpc::Status::OK)));
+  auto result = exporter->Export(records, core::SystemTimestamp(), core::SystemTimestamp());
+  EXPECT_EQ(sdk::metrics::ExportResult::kSuccess, result);
+  ASSERT_EQ(request.resource_metrics_size(), 1);
+  ASSERT_EQ(request.resource_metrics(0).instrumentation_library_metrics_size(), 1);
+  EXPECT_EQ(request.resource_metrics(0).instrumentation_library_metrics(0).metrics_size(), 1);
+
+  // Test failed RPC
+  EXPECT_CALL(*mock_stub, Export(_, _, _))
+      .Times(Exactly(1))
+      .WillOnce(Return(grpc::Status::CANCELLED));
+  result = exporter->Export(records, core::SystemTimestamp(), core::SystemTimestamp());
+  EXPECT_EQ(sdk::metrics::ExportResult::kFailure, result);
+
+  // Nothing is sent without records.
+  result = exporter->Export({}, core::SystemTimestamp(), core::SystemTimestamp());
+  EXPECT_EQ(sdk::metrics::ExportResult::kSuccess, result);
+}
+}  // namespace otlp
+}  // namespace exporter
+OPENTELEMETRY_END_NAMESPACE
@@ -41,6 +41,15 @@ TEST(Recordable, SetName)
   EXPECT_EQ(rec.span().name(), name);
 }
 
+TEST(Recordable, SetSpanKind)
+{
+  Recordable rec;
+  rec.SetSpanKind(trace::SpanKind::kServer);
+  EXPECT_EQ(rec.span().kind(), proto::trace::v1::Span::SERVER);
+  rec.SetSpanKind(trace::SpanKind::kInternal);
+  EXPECT_EQ(rec.span().kind(), proto::trace::v1::Span::INTERNAL);
+}
+
 TEST(Recordable, SetStartTime)
 {
   Recordable rec;
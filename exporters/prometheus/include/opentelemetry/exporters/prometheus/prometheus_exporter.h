@@ -0,0 +1,89 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "opentelemetry/exporters/prometheus/prometheus_serializer.h"
+#include "opentelemetry/ext/http/server/http_server.h"
+#include "opentelemetry/sdk/metrics/meter.h"
+#include "opentelemetry/version.h"
+
+OPENTELEMETRY_BEGIN_NAMESPACE
+namespace exporter
+{
+namespace prometheus
+{
+/**
+ * The port Prometheus exporters conventionally listen on.
+ */
+const uint16_t kDefaultPort = 9464;
+
+/**
+ * Exposes the metrics of a meter to Prometheus, which pulls them from /metrics.
+ *
+ * Every scrape collects the meter with cumulative temporality, on the server thread, so the
+ * meter must not be collected by anyone else. The collected records and the text of every
+ * series are kept between scrapes, so a scrape of an unchanged set of series only formats the
+ * values.
+ *
+ * This class is thread-safe.
+ */
+class PrometheusExporter
+{
+public:
+  /**
+   * Initialize an exporter. No socket is opened until Start is called.
+   * @param meter the meter to expose
+   * @param port the port to listen on; 0 picks an ephemeral port
+   * @param address the IPv4 address to listen on
+   * @param max_idle_collections the number of consecutive scrapes an unused label set is kept
+   * for after its last update
+   */
+  explicit PrometheusExporter(
+      std::shared_ptr<sdk::metrics::Meter> meter,
+      uint16_t port                    = kDefaultPort,
+      std::string address              = "0.0.0.0",
+      std::size_t max_idle_collections = sdk::metrics::kDefaultMaxIdleCollections);
+
+  /**
+   * Start serving scrapes on a background thread.
+   * @return whether the server is listening
+   */
+  bool Start() noexcept { return server_.Start(); }
+
+  /**
+   * Stop serving scrapes and wait for the server thread to exit.
+   */
+  void Stop() noexcept { server_.Stop(); }
+
+  /**
+   * @return the port the server listens on, which is only known for an ephemeral port once
+   * Start succeeded
+   */
+  uint16_t GetPort() const noexcept { return server_.GetPort(); }
+
+  /**
+   * Collect the meter and append the text exposition of its metrics to out, exactly as a scrape
+   * of /metrics would.
+   */
+  void Scrape(std::string &out) noexcept;
+
+private:
+  const std::shared_ptr<sdk::metrics::Meter> meter_;
+  const std::size_t max_idle_collections_;
+
+  std::mutex mtx_;
+  std::vector<sdk::metrics::MetricRecord> records_;
+  PrometheusSerializer serializer_;
+  // The size of the previous scrape, which the next one is reserved for.
+  std::size_t scrape_size_ = 0;
+
+  ext::http::server::HttpServer server_;
+};
+}  // namespace prometheus
+}  // namespace exporter
+OPENTELEMETRY_END_NAMESPACE
@@ -0,0 +1,123 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "opentelemetry/sdk/metrics/record.h"
+#include "opentelemetry/version.h"
+
+OPENTELEMETRY_BEGIN_NAMESPACE
+namespace exporter
+{
+namespace prometheus
+{
+/**
+ * The quantiles reported for every summary, which is how sketches of value recorders are
+ * exposed.
+ */
+const double kSummaryQuantiles[] = {0, 0.5, 0.9, 0.95, 0.99, 1};
+
+/**
+ * Serializes collected metric records in the Prometheus text exposition format, version 0.0.4.
+ *
+ * Counters and sum observers are exposed as counters, value recorders as histograms or, when
+ * they record into a sketch, as summaries, and every other instrument as a gauge. Names are
+ * sanitized to the Prometheus character set. Records are expected to be grouped by instrument,
+ * as Meter::Collect returns them.
+ *
+ * Everything about a series that does not change between scrapes is formatted once and cached:
+ * the HELP and TYPE lines of every instrument, the bucket bounds of its histograms and the name
+ * and labels of every series. Once a scrape has seen every series, serializing only formats the
+ * values and does not allocate memory beyond the growth of the output. Series that are missing
+ * from a scrape are dropped from the cache.
+ *
+ * This class is thread-compatible.
+ */
+class PrometheusSerializer
+{
+public:
+  /**
+   * Append the text exposition of records to out.
+   * @param records the records of a cumulative collection
+   * @param out the string to append to; reusing it across scrapes avoids growing it every time
+   */
+  void Serialize(const std::vector<sdk::metrics::MetricRecord> &records, std::string &out);
+
+  /**
+   * @return the number of series currently cached
+   */
+  std::size_t GetSeriesCount() const noexcept { return series_.size(); }
+
+  /**
+   * Append a value in the format Prometheus parses: integers are written without a fraction,
+   * and other values with the fewest digits that read back exactly.
+   */
+  static void AppendValue(double value, std::string &out);
+
+  static void AppendValue(int64_t value, std::string &out);
+
+  static void AppendValue(uint64_t value, std::string &out);
+
+private:
+  // The text shared by every series of an instrument.
+  struct Family
+  {
+    // Keeps the descriptor alive, so its address is not reused for another instrument.
+    std::shared_ptr<const sdk::metrics::InstrumentDescriptor> descriptor;
+    std::string name;
+    // The HELP and TYPE lines.
+    std::string header;
+    // The boundaries the suffixes of a histogram were built from.
+    std::shared_ptr<const std::vector<double>> boundaries;
+    // The end of every bucket or quantile line up to its value, e.g. `0.5"} `. The last bucket
+    // of a histogram is `+Inf"} `.
+    std::vector<std::string> suffixes;
+    uint64_t last_scrape = 0;
+  };
+
+  // The text of a single series up to its values.
+  struct Series
+  {
+    // Keeps the labels alive, so their address is not reused for another label set.
+    sdk::metrics::LabelSet labels;
+    // `name{labels} ` for counters and gauges, `name_bucket{labels,le="` for histograms and
+    // `name{labels,quantile="` for summaries.
+    std::string prefix;
+    // `name_sum{labels} ` and `name_count{labels} ` for histograms and summaries.
+    std::string sum_prefix;
+    std::string count_prefix;
+    uint64_t last_scrape = 0;
+  };
+
+  using SeriesKey = std::pair<const void *, const void *>;
+
+  struct SeriesKeyHash
+  {
+    std::size_t operator()(const SeriesKey &key) const noexcept
+    {
+      return std::hash<const void *>()(key.first) * 31 + std::hash<const void *>()(key.second);
+    }
+  };
+
+  Family &GetFamily(const sdk::metrics::MetricRecord &record);
+
+  Series &GetSeries(const Family &family, const sdk::metrics::MetricRecord &record);
+
+  void AppendRecord(const Family &family,
+                    const Series &series,
+                    const sdk::metrics::MetricRecord &record,
+                    std::string &out);
+
+  std::unordered_map<const void *, Family> families_;
+  std::unordered_map<SeriesKey, Series, SeriesKeyHash> series_;
+  uint64_t scrape_ = 0;
+};
+}  // namespace prometheus
+}  // namespace exporter
+OPENTELEMETRY_END_NAMESPACE
@@ -0,0 +1,39 @@
+#include "opentelemetry/exporters/prometheus/prometheus_exporter.h"
+
+#include <utility>
+
+OPENTELEMETRY_BEGIN_NAMESPACE
+namespace exporter
+{
+namespace prometheus
+{
+PrometheusExporter::PrometheusExporter(std::shared_ptr<sdk::metrics::Meter> meter,
+                                       uint16_t port,
+                                       std::string address,
+                                       std::size_t max_idle_collections)
+    : meter_(std::move(meter)),
+      max_idle_collections_(max_idle_collections),
+      server_(port, std::move(address))
+{
+  server_.AddHandler("/metrics", [this](const ext::http::server::HttpRequest &,
+                                        ext::http::server::HttpResponse &response) {
+    response.content_type = "text/plain; version=0.0.4; charset=utf-8";
+    Scrape(response.body);
+  });
+}
+
+void PrometheusExporter::Scrape(std::string &out) noexcept
+{
+  std::lock_guard<std::mutex> lock(mtx_);
+  records_.clear();
+  meter_->Collect(records_, sdk::metrics::AggregationTemporality::Cumulative,
+                  max_idle_collections_);
+  // The output of a scrape is about as large as the previous one, so it is sized up front.
+  out.reserve(out.size() + scrape_size_);
+  auto size = out.size();
+  serializer_.Serialize(records_, out);
+  scrape_size_ = out.size() - size;
+}
+}  // namespace prometheus
+}  // namespace exporter
+OPENTELEMETRY_END_NAMESPACE
@@ -0,0 +1,415 @@
+#include "opentelemetry/exporters/prometheus/prometheus_serializer.h"
+
+#include <cmath>
+#include <cstdio>
+#include <iterator>
+
+OPENTELEMETRY_BEGIN_NAMESPACE
+namespace exporter
+{
+namespace prometheus
+{
+namespace
+{
+using opentelemetry::metrics::InstrumentKind;
+using sdk::metrics::DDSketch;
+using sdk::metrics::HistogramValue;
+using sdk::metrics::MetricRecord;
+
+// The indexes of the alternatives of MetricValue.
+const std::size_t kHistogramIndex = 2;
+const std::size_t kSketchIndex    = 3;
+
+// Doubles of a smaller magnitude that have no fraction are written as integers.
+const double kMaxIntegralDouble = 1e15;
+
+// Doubles with at most this many fraction digits are written without snprintf.
+const double kPowersOf10[] = {1, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9};
+
+/**
+ * Appends scaled / 10^digits, with exactly digits fraction digits.
+ */
+void AppendDecimal(int64_t scaled, std::size_t digits, std::string &out)
+{
+  if (scaled < 0)
+  {
+    out.push_back('-');
+  }
+  uint64_t magnitude = scaled < 0 ? 0 - static_cast<uint64_t>(scaled) : scaled;
+  char buffer[24];
+  char *end   = buffer + sizeof(buffer);
+  char *start = end;
+  for (std::size_t i = 0; i < digits || magnitude != 0 || i == digits; ++i)
+  {
+    if (i == digits)
+    {
+      *--start = '.';
+    }
+    *--start = static_cast<char>('0' + magnitude % 10);
+    magnitude /= 10;
+  }
+  out.append(start, end);
+}
+
+bool IsNameChar(char c, bool is_first, bool allow_colon) noexcept
+{
+  return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || c == '_' ||
+         (allow_colon && c == ':') || (!is_first && c >= '0' && c <= '9');
+}
+
+/**
+ * Appends name with every character outside of [a-zA-Z0-9_] (or [a-zA-Z0-9_:] for metric
+ * names) replaced by an underscore, and an underscore in front of a leading digit.
+ */
+void AppendSanitizedName(const std::string &name, bool allow_colon, std::string &out)
+{
+  bool is_prefixed = name.empty() || (name[0] >= '0' && name[0] <= '9');
+  if (is_prefixed)
+  {
+    out.push_back('_');
+  }
+  for (std::size_t i = 0; i < name.size(); ++i)
+  {
+    out.push_back(IsNameChar(name[i], i == 0 && !is_prefixed, allow_colon) ? name[i] : '_');
+  }
+}
+
+/**
+ * Appends text with backslashes and line feeds escaped, and double quotes as well for label
+ * values.
+ */
+void AppendEscaped(const std::string &text, bool escape_quotes, std::string &out)
+{
+  for (char c : text)
+  {
+    if (c == '\\')
+    {
+      out.append("\\\\");
+    }
+    else if (c == '\n')
+    {
+      out.append("\\n");
+    }
+    else if (c == '"' && escape_quotes)
+    {
+      out.append("\\\"");
+    }
+    else
+    {
+      out.push_back(c);
+    }
+  }
+}
+
+const char *GetTypeName(const MetricRecord &record) noexcept
+{
+  switch (record.value.index())
+  {
+    case kHistogramIndex:
+      return "histogram";
+    case kSketchIndex:
+      return "summary";
+    default:
+      return record.descriptor->kind == InstrumentKind::Counter ||
+                     record.descriptor->kind == InstrumentKind::SumObserver
+                 ? "counter"
+                 : "gauge";
+  }
+}
+
+/**
+ * Appends `name{labels`, with a trailing comma when extra labels follow, or `name` alone when
+ * there are no labels at all.
+ */
+void AppendSeriesStart(const std::string &name,
+                       const char *suffix,
+                       const std::string &labels,
+                       bool has_extra_label,
+                       std::string &out)
+{
+  out.append(name);
+  out.append(suffix);
+  if (labels.empty() && !has_extra_label)
+  {
+    return;
+  }
+  out.push_back('{');
+  out.append(labels);
+  if (!labels.empty() && has_extra_label)
+  {
+    out.push_back(',');
+  }
+}
+
+void AppendSuffix(double bound, std::string &out)
+{
+  PrometheusSerializer::AppendValue(bound, out);
+  out.append("\"} ");
+}
+}  // namespace
+
+void PrometheusSerializer::AppendValue(uint64_t value, std::string &out)
+{
+  char buffer[20];
+  char *end   = buffer + sizeof(buffer);
+  char *start = end;
+  do
+  {
+    *--start = static_cast<char>('0' + value % 10);
+    value /= 10;
+  } while (value != 0);
+  out.append(start, end);
+}
+
+void PrometheusSerializer::AppendValue(int64_t value, std::string &out)
+{
+  if (value < 0)
+  {
+    out.push_back('-');
+    // Negating in unsigned arithmetic also covers the minimum value.
+    AppendValue(0 - static_cast<uint64_t>(value), out);
+    return;
+  }
+  AppendValue(static_cast<uint64_t>(value), out);
+}
+
+void PrometheusSerializer::AppendValue(double value, std::string &out)
+{
+  if (std::isnan(value))
+  {
+    out.append("NaN");
+    return;
+  }
+  if (std::isinf(value))
+  {
+    out.append(value > 0 ? "+Inf" : "-Inf");
+    return;
+  }
+  if (std::fabs(value) < kMaxIntegralDouble && value == std::trunc(value))
+  {
+    AppendValue(static_cast<int64_t>(value), out);
+    return;
+  }
+  // Short decimal fractions such as 0.1 are written from integers. Dividing the exact scaled
+  // integer rounds correctly, just as parsing the written decimal does, so the check proves
+  // that the value reads back exactly.
+  for (std::size_t digits = 1; digits < sizeof(kPowersOf10) / sizeof(kPowersOf10[0]); ++digits)
+  {
+    double scaled = value * kPowersOf10[digits];
+    if (std::fabs(scaled) >= kMaxIntegralDouble)
+    {
+      break;
+    }
+    if (scaled == std::trunc(scaled) && scaled / kPowersOf10[digits] == value)
+    {
+      AppendDecimal(static_cast<int64_t>(scaled), digits, out);
+      return;
+    }
+  }
+  // 17 significant digits always read back exactly.
+  char buffer[32];
+  int size = std::snprintf(buffer, sizeof(buffer), "%.17g", value);
+  out.append(buffer, static_cast<std::size_t>(size));
+}
+
+PrometheusSerializer::Family &PrometheusSerializer::GetFamily(const MetricRecord &record)
+{
+  auto &family = families_[record.descriptor.get()];
+  if (family.descriptor == nullptr)
+  {
+    family.descriptor = record.descriptor;
+    AppendSanitizedName(record.descriptor->name, true, family.name);
+    family.header.append("# HELP ");
+    family.header.append(family.name);
+    family.header.push_back(' ');
+    AppendEscaped(record.descriptor->description, false, family.header);
+    family.header.append("\n# TYPE ");
+    family.header.append(family.name);
+    family.header.push_back(' ');
+    family.header.append(GetTypeName(record));
+    family.header.push_back('\n');
+
+    if (record.value.index() == kSketchIndex)
+    {
+      for (auto quantile : kSummaryQuantiles)
+      {
+        family.suffixes.emplace_back();
+        AppendSuffix(quantile, family.suffixes.back());
+      }
+    }
+  }
+
+  if (record.value.index() == kHistogramIndex)
+  {
+    auto &boundaries = nostd::get<HistogramValue>(record.value).boundaries;
+    if (family.boundaries != boundaries)
+    {
+      family.boundaries = boundaries;
+      family.suffixes.clear();
+      for (auto bound : *boundaries)
+      {
+        family.suffixes.emplace_back();
+        AppendSuffix(bound, family.suffixes.back());
+      }
+      family.suffixes.emplace_back("+Inf\"} ");
+    }
+  }
+  return family;
+}
+
+PrometheusSerializer::Series &PrometheusSerializer::GetSeries(const Family &family,
+                                                              const MetricRecord &record)
+{
+  auto &labels = record.labels.GetLabels();
+  auto &series = series_[SeriesKey(record.descriptor.get(), &labels)];
+  if (!series.prefix.empty())
+  {
+    return series;
+  }
+  series.labels = record.labels;
+
+  std::string label_text;
+  for (auto &label : labels)
+  {
+    if (!label_text.empty())
+    {
+      label_text.push_back(',');
+    }
+    AppendSanitizedName(label.first, false, label_text);
+    label_text.append("=\"");
+    AppendEscaped(label.second, true, label_text);
+    label_text.push_back('"');
+  }
+
+  auto index = record.value.index();
+  if (index != kHistogramIndex && index != kSketchIndex)
+  {
+    AppendSeriesStart(family.name, "", label_text, false, series.prefix);
+    series.prefix.append(label_text.empty() ? " " : "} ");
+    return series;
+  }
+
+  if (index == kHistogramIndex)
+  {
+    AppendSeriesStart(family.name, "_bucket", label_text, true, series.prefix);
+    series.prefix.append("le=\"");
+  }
+  else
+  {
+    AppendSeriesStart(family.name, "", label_text, true, series.prefix);
+    series.prefix.append("quantile=\"");
+  }
+  AppendSeriesStart(family.name, "_sum", label_text, false, series.sum_prefix);
+  series.sum_prefix.append(label_text.empty() ? " " : "} ");
+  AppendSeriesStart(family.name, "_count", label_text, false, series.count_prefix);
+  series.count_prefix.append(label_text.empty() ? " " : "} ");
+  return series;
+}
+
+void PrometheusSerializer::AppendRecord(const Family &family,
+                                        const Series &series,
+                                        const MetricRecord &record,
+                                        std::string &out)
+{
+  switch (record.value.index())
+  {
+    case 0:
+      out.append(series.prefix);
+      AppendValue(nostd::get<int64_t>(record.value), out);
+      out.push_back('\n');
+      break;
+    case 1:
+      out.append(series.prefix);
+      AppendValue(nostd::get<double>(record.value), out);
+      out.push_back('\n');
+      break;
+    case kHistogramIndex: {
+      auto &histogram = nostd::get<HistogramValue>(record.value);
+      // Prometheus buckets are cumulative.
+      uint64_t count = 0;
+      for (std::size_t i = 0; i < histogram.counts.size() && i < family.suffixes.size(); ++i)
+      {
+        count += histogram.counts[i];
+        out.append(series.prefix);
+        out.append(family.suffixes[i]);
+        AppendValue(count, out);
+        out.push_back('\n');
+      }
+      out.append(series.sum_prefix);
+      AppendValue(histogram.sum, out);
+      out.push_back('\n');
+      out.append(series.count_prefix);
+      AppendValue(histogram.count, out);
+      out.push_back('\n');
+      break;
+    }
+    default: {
+      auto &sketch = nostd::get<DDSketch>(record.value);
+      if (sketch.GetCount() != 0)
+      {
+        for (std::size_t i = 0; i < family.suffixes.size(); ++i)
+        {
+          out.append(series.prefix);
+          out.append(family.suffixes[i]);
+          AppendValue(sketch.GetQuantile(kSummaryQuantiles[i]), out);
+          out.push_back('\n');
+        }
+      }
+      out.append(series.sum_prefix);
+      AppendValue(sketch.GetSum(), out);
+      out.push_back('\n');
+      out.append(series.count_prefix);
+      AppendValue(sketch.GetCount(), out);
+      out.push_back('\n');
+      break;
+    }
+  }
+}
+
+void PrometheusSerializer::Serialize(const std::vector<MetricRecord> &records, std::string &out)
+{
+  ++scrape_;
+  std::size_t family_count = 0;
+  std::size_t series_count = 0;
+  Family *family           = nullptr;
+  for (auto &record : records)
+  {
+    if (family == nullptr || family->descriptor != record.descriptor)
+    {
+      family = &GetFamily(record);
+      if (family->last_scrape != scrape_)
+      {
+        family->last_scrape = scrape_;
+        ++family_count;
+        out.append(family->header);
+      }
+    }
+    auto &series = GetSeries(*family, record);
+    if (series.last_scrape != scrape_)
+    {
+      series.last_scrape = scrape_;
+      ++series_count;
+    }
+    AppendRecord(*family, series, record, out);
+  }
+
+  // Only walk the caches when something went away since the previous scrape.
+  if (series_count != series_.size())
+  {
+    for (auto series = series_.begin(); series != series_.end();)
+    {
+      series = series->second.last_scrape == scrape_ ? std::next(series) : series_.erase(series);
+    }
+  }
+  if (family_count != families_.size())
+  {
+    for (auto family = families_.begin(); family != families_.end();)
+    {
+      family =
+          family->second.last_scrape == scrape_ ? std::next(family) : families_.erase(family);
+    }
+  }
+}
+}  // namespace prometheus
+}  // namespace exporter
+OPENTELEMETRY_END_NAMESPACE
@@ -0,0 +1,98 @@
+#include "opentelemetry/exporters/prometheus/prometheus_exporter.h"
+
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include <cstring>
+#include <string>
+
+#include <gtest/gtest.h>
+
+OPENTELEMETRY_BEGIN_NAMESPACE
+namespace exporter
+{
+namespace prometheus
+{
+/*
+ * Sends a GET request to the server on localhost and returns everything it answers until it
+ * closes the connection.
+ */
+std::string Get(uint16_t port, const std::string &target)
+{
+  int fd = socket(AF_INET, SOCK_STREAM, 0);
+  sockaddr_in address;
+  std::memset(&address, 0, sizeof(address));
+  address.sin_family      = AF_INET;
+  address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+  address.sin_port        = htons(port);
+  if (connect(fd, reinterpret_cast<sockaddr *>(&address), sizeof(address)) != 0)
+  {
+    close(fd);
+    return "";
+  }
+  std::string request = "GET " + target + " HTTP/1.1\r\nHost: localhost\r\n\r\n";
+  send(fd, request.data(), request.size(), MSG_NOSIGNAL);
+
+  std::string response;
+  char buffer[4096];
+  ssize_t count;
+  while ((count = read(fd, buffer, sizeof(buffer))) > 0)
+  {
+    response.append(buffer, count);
+  }
+  close(fd);
+  return response;
+}
+
+TEST(PrometheusExporter, ServesMetrics)
+{
+  auto meter   = std::make_shared<sdk::metrics::Meter>();
+  auto counter = meter->NewIntCounter("requests", "Served requests", "1");
+  counter->Add(2, {{"method", "GET"}});
+
+  PrometheusExporter exporter(meter, 0, "127.0.0.1");
+  ASSERT_TRUE(exporter.Start());
+  ASSERT_NE(exporter.GetPort(), 0);
+
+  auto response = Get(exporter.GetPort(), "/metrics");
+  EXPECT_EQ(response.find("HTTP/1.1 200 OK\r\n"), 0);
+  EXPECT_NE(response.find("Content-Type: text/plain; version=0.0.4; charset=utf-8\r\n"),
+            std::string::npos);
+  EXPECT_NE(response.find("\r\n\r\n# HELP requests Served requests\n# TYPE requests counter\n"
+                          "requests{method=\"GET\"} 2\n"),
+            std::string::npos);
+
+  // Scrapes are cumulative.
+  counter->Add(3, {{"method", "GET"}});
+  EXPECT_NE(Get(exporter.GetPort(), "/metrics").find("requests{method=\"GET\"} 5\n"),
+            std::string::npos);
+  EXPECT_EQ(Get(exporter.GetPort(), "/other").find("HTTP/1.1 404 Not Found\r\n"), 0);
+  exporter.Stop();
+}
+
+TEST(PrometheusExporter, ServesLargeScrape)
+{
+  auto meter   = std::make_shared<sdk::metrics::Meter>();
+  auto counter = meter->NewIntCounter("requests");
+  for (int i = 0; i < 1000; ++i)
+  {
+    counter->Add(1, {{"route", std::to_string(i)}});
+  }
+
+  PrometheusExporter exporter(meter, 0, "127.0.0.1");
+  ASSERT_TRUE(exporter.Start());
+  std::string scrape;
+  exporter.Scrape(scrape);
+
+  auto response = Get(exporter.GetPort(), "/metrics");
+  auto body_start = response.find("\r\n\r\n");
+  ASSERT_NE(body_start, std::string::npos);
+  EXPECT_EQ(response.substr(body_start + 4), scrape);
+  EXPECT_NE(response.find("Content-Length: " + std::to_string(scrape.size()) + "\r\n"),
+            std::string::npos);
+}
+}  // namespace prometheus
+}  // namespace exporter
+OPENTELEMETRY_END_NAMESPACE
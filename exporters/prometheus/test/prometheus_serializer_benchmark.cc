@@ -0,0 +1,70 @@
+#include "opentelemetry/exporters/prometheus/prometheus_serializer.h"
+#include "opentelemetry/sdk/metrics/meter.h"
+
+#include <map>
+#include <string>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+namespace
+{
+using opentelemetry::exporter::prometheus::PrometheusSerializer;
+using opentelemetry::sdk::metrics::AggregationTemporality;
+using opentelemetry::sdk::metrics::Meter;
+using opentelemetry::sdk::metrics::MetricRecord;
+
+// Serializes the state.range(0) series of a counter, as every scrape after the first one does.
+void BM_SerializeCounter(benchmark::State &state)
+{
+  Meter meter(Meter::GetDefaultBoundaries(), static_cast<std::size_t>(state.range(0)));
+  auto counter = meter.NewIntCounter("http_requests", "Served requests");
+  for (int64_t i = 0; i < state.range(0); ++i)
+  {
+    counter->Add(i, std::map<std::string, std::string>{
+                        {"method", "GET"}, {"route", "/api/v1/items/" + std::to_string(i)}});
+  }
+  auto records = meter.Collect(AggregationTemporality::Cumulative);
+
+  PrometheusSerializer serializer;
+  std::string out;
+  serializer.Serialize(records, out);
+  for (auto _ : state)
+  {
+    out.clear();
+    serializer.Serialize(records, out);
+    benchmark::DoNotOptimize(out.data());
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+  state.SetBytesProcessed(state.iterations() * out.size());
+}
+BENCHMARK(BM_SerializeCounter)->Arg(1000)->Arg(50000)->Unit(benchmark::kMillisecond);
+
+// Serializes the state.range(0) series of a value recorder with the default histogram buckets.
+void BM_SerializeHistogram(benchmark::State &state)
+{
+  Meter meter(Meter::GetDefaultBoundaries(), static_cast<std::size_t>(state.range(0)));
+  auto recorder = meter.NewDoubleValueRecorder("http_latency", "Request latency");
+  for (int64_t i = 0; i < state.range(0); ++i)
+  {
+    recorder->Record(static_cast<double>(i % 1000) / 7,
+                     std::map<std::string, std::string>{{"route", std::to_string(i)}});
+  }
+  auto records = meter.Collect(AggregationTemporality::Cumulative);
+
+  PrometheusSerializer serializer;
+  std::string out;
+  serializer.Serialize(records, out);
+  for (auto _ : state)
+  {
+    out.clear();
+    serializer.Serialize(records, out);
+    benchmark::DoNotOptimize(out.data());
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+  state.SetBytesProcessed(state.iterations() * out.size());
+}
+BENCHMARK(BM_SerializeHistogram)->Arg(1000)->Arg(50000)->Unit(benchmark::kMillisecond);
+
+}  // namespace
+BENCHMARK_MAIN();
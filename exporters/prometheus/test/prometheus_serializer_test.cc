@@ -0,0 +1,145 @@
+#include "opentelemetry/exporters/prometheus/prometheus_serializer.h"
+#include "opentelemetry/sdk/metrics/meter.h"
+
+#include <cstdlib>
+#include <limits>
+
+#include <gtest/gtest.h>
+
+OPENTELEMETRY_BEGIN_NAMESPACE
+namespace exporter
+{
+namespace prometheus
+{
+using sdk::metrics::AggregationTemporality;
+
+std::string Serialize(PrometheusSerializer &serializer, sdk::metrics::Meter &meter)
+{
+  std::string out;
+  serializer.Serialize(meter.Collect(AggregationTemporality::Cumulative), out);
+  return out;
+}
+
+template <class T>
+std::string Format(T value)
+{
+  std::string out;
+  PrometheusSerializer::AppendValue(value, out);
+  return out;
+}
+
+TEST(PrometheusSerializer, FormatsValues)
+{
+  EXPECT_EQ(Format(int64_t{0}), "0");
+  EXPECT_EQ(Format(int64_t{-42}), "-42");
+  EXPECT_EQ(Format(std::numeric_limits<int64_t>::min()), "-9223372036854775808");
+  EXPECT_EQ(Format(std::numeric_limits<uint64_t>::max()), "18446744073709551615");
+  EXPECT_EQ(Format(2.0), "2");
+  EXPECT_EQ(Format(-0.5), "-0.5");
+  EXPECT_EQ(Format(0.1), "0.1");
+  EXPECT_EQ(Format(123.456), "123.456");
+  EXPECT_EQ(Format(-0.00001), "-0.00001");
+  EXPECT_EQ(Format(1e300), "1.0000000000000001e+300");
+  EXPECT_EQ(Format(0.1 + 0.2), "0.30000000000000004");
+  EXPECT_EQ(Format(std::numeric_limits<double>::quiet_NaN()), "NaN");
+  EXPECT_EQ(Format(std::numeric_limits<double>::infinity()), "+Inf");
+  EXPECT_EQ(Format(-std::numeric_limits<double>::infinity()), "-Inf");
+
+  // Values that need every digit still read back exactly.
+  double third = 1.0 / 3;
+  EXPECT_EQ(std::strtod(Format(third).c_str(), nullptr), third);
+}
+
+TEST(PrometheusSerializer, CountersAndGauges)
+{
+  sdk::metrics::Meter meter;
+  meter.NewIntCounter("requests", "Served requests", "1")->Add(3, {{"method", "GET"}});
+  meter.NewDoubleUpDownCounter("queue_size", "Queued\nitems")->Add(-1.5);
+
+  PrometheusSerializer serializer;
+  EXPECT_EQ(Serialize(serializer, meter),
+            "# HELP queue_size Queued\\nitems\n"
+            "# TYPE queue_size gauge\n"
+            "queue_size -1.5\n"
+            "# HELP requests Served requests\n"
+            "# TYPE requests counter\n"
+            "requests{method=\"GET\"} 3\n");
+}
+
+TEST(PrometheusSerializer, Histogram)
+{
+  sdk::metrics::Meter meter({0.5, 10});
+  auto recorder = meter.NewIntValueRecorder("latency");
+  for (int64_t value : {5, 50, 500})
+  {
+    recorder->Record(value, {{"route", "/"}});
+  }
+
+  PrometheusSerializer serializer;
+  EXPECT_EQ(Serialize(serializer, meter),
+            "# HELP latency \n"
+            "# TYPE latency histogram\n"
+            "latency_bucket{route=\"/\",le=\"0.5\"} 0\n"
+            "latency_bucket{route=\"/\",le=\"10\"} 1\n"
+            "latency_bucket{route=\"/\",le=\"+Inf\"} 3\n"
+            "latency_sum{route=\"/\"} 555\n"
+            "latency_count{route=\"/\"} 3\n");
+}
+
+TEST(PrometheusSerializer, Summary)
+{
+  sdk::metrics::Meter meter;
+  auto recorder = meter.NewDoubleValueRecorder("size", "", "", sdk::metrics::DDSketchOptions());
+  recorder->Record(8);
+
+  PrometheusSerializer serializer;
+  auto out = Serialize(serializer, meter);
+  EXPECT_EQ(out.find("# HELP size \n# TYPE size summary\nsize{quantile=\"0\"} "), 0);
+  EXPECT_NE(out.find("\nsize{quantile=\"0.99\"} "), std::string::npos);
+  EXPECT_NE(out.find("\nsize{quantile=\"1\"} "), std::string::npos);
+  EXPECT_NE(out.find("\nsize_sum 8\nsize_count 1\n"), std::string::npos);
+}
+
+TEST(PrometheusSerializer, SanitizesNamesAndEscapesLabelValues)
+{
+  sdk::metrics::Meter meter;
+  meter.NewIntCounter("http.server.requests")->Add(1, {{"1st-key", "a\"b\\c\nd"}});
+
+  PrometheusSerializer serializer;
+  auto out = Serialize(serializer, meter);
+  EXPECT_NE(out.find("# TYPE http_server_requests counter\n"), std::string::npos);
+  EXPECT_NE(out.find("\nhttp_server_requests{_1st_key=\"a\\\"b\\\\c\\nd\"} 1\n"),
+            std::string::npos);
+}
+
+TEST(PrometheusSerializer, ReusesAndDropsCachedSeries)
+{
+  sdk::metrics::Meter meter;
+  auto counter = meter.NewIntCounter("requests");
+  counter->Add(1, {{"method", "GET"}});
+  {
+    auto bound = counter->Bind({{"method", "POST"}});
+    bound->Add(1);
+  }
+
+  PrometheusSerializer serializer;
+  Serialize(serializer, meter);
+  EXPECT_EQ(serializer.GetSeriesCount(), 2);
+
+  counter->Add(1, {{"method", "GET"}});
+  EXPECT_NE(Serialize(serializer, meter).find("requests{method=\"GET\"} 2\n"), std::string::npos);
+  EXPECT_EQ(serializer.GetSeriesCount(), 2);
+
+  // Once the unused label set is reclaimed, its series is no longer exposed nor cached.
+  std::string out;
+  for (std::size_t i = 0; i <= sdk::metrics::kDefaultMaxIdleCollections; ++i)
+  {
+    counter->Add(1, {{"method", "GET"}});
+    out = Serialize(serializer, meter);
+  }
+  EXPECT_EQ(out.find("POST"), std::string::npos);
+  EXPECT_EQ(serializer.GetSeriesCount(), 1);
+}
+}  // namespace prometheus
+}  // namespace exporter
+OPENTELEMETRY_END_NAMESPACE
@@ -0,0 +1,172 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <map>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <utility>
+
+#include "opentelemetry/nostd/string_view.h"
+#include "opentelemetry/version.h"
+
+OPENTELEMETRY_BEGIN_NAMESPACE
+namespace ext
+{
+namespace http
+{
+namespace server
+{
+/**
+ * A parsed HTTP request.
+ */
+struct HttpRequest
+{
+  std::string method;
+  // The request target without the query string, e.g. "/tracez".
+  std::string path;
+  // The raw query string without the leading '?', e.g. "name=foo".
+  std::string query;
+
+  /**
+   * @param key the name of a query parameter
+   * @return the percent-decoded value of the first query parameter named key, or an empty
+   * string if there is no such parameter
+   */
+  std::string GetQueryParameter(nostd::string_view key) const;
+};
+
+/**
+ * An HTTP response, filled in by a request handler.
+ */
+struct HttpResponse
+{
+  int code = 200;
+  std::string content_type = "text/plain";
+  std::string body;
+};
+
+/**
+ * Handles a request for a registered path. Handlers run on the server thread and must not
+ * block for long, since no other connection is served in the meantime. A handler that throws
+ * is answered with status 500.
+ */
+using HttpRequestHandler = std::function<void(const HttpRequest &, HttpResponse &)>;
+
+/**
+ * A minimal embedded HTTP/1.1 server meant for debugging pages such as zPages and for metric
+ * scrapes.
+ *
+ * By default the server only listens on the loopback interface. It serves all connections from
+ * a single thread using non-blocking sockets and epoll. Every response closes its connection,
+ * and connections that are not answered within a timeout, e.g. because the request is never
+ * completed, are closed as well. Only GET requests of at most kMaxRequestSize bytes are
+ * accepted.
+ */
+class HttpServer
+{
+public:
+  /**
+   * The maximum size of a request, including the request line and headers.
+   */
+  static const std::size_t kMaxRequestSize = 8192;
+
+  /**
+   * Initialize a server. No socket is opened until Start is called.
+   * @param port the port to listen on; 0 picks an ephemeral port
+   * @param address the IPv4 address to listen on, e.g. "0.0.0.0" for every interface
+   */
+  explicit HttpServer(uint16_t port = 0, std::string address = "127.0.0.1") noexcept
+      : port_(port), address_(std::move(address))
+  {}
+
+  /**
+   * Stops the server if it is running.
+   */
+  ~HttpServer() { Stop(); }
+
+  HttpServer(const HttpServer &) = delete;
+  HttpServer &operator=(const HttpServer &) = delete;
+
+  /**
+   * Register a handler for an exact path. Must be called before Start.
+   * @param path the request path, e.g. "/tracez"
+   * @param handler the handler serving path
+   */
+  void AddHandler(const std::string &path, HttpRequestHandler handler);
+
+  /**
+   * Set how long a connection is kept open, from when it is accepted until its response is
+   * sent; 10 seconds by default. Must be called before Start.
+   */
+  void SetConnectionTimeout(std::chrono::milliseconds timeout) noexcept
+  {
+    connection_timeout_ = timeout;
+  }
+
+  /**
+   * Open the listening socket and start serving on a background thread.
+   * @return true if the server was started; false if it is already running or the socket
+   * could not be set up
+   */
+  bool Start() noexcept;
+
+  /**
+   * Stop serving, close all connections and join the server thread.
+   */
+  void Stop() noexcept;
+
+  /**
+   * @return the port the server listens on; only meaningful after a successful Start
+   */
+  uint16_t GetPort() const noexcept { return port_; }
+
+private:
+  struct Connection
+  {
+    std::string input;
+    // The status line and headers of the response.
+    std::string output;
+    // The body of the response, moved out of the handler's response.
+    std::string body;
+    // The number of bytes of output and then body sent so far.
+    std::size_t written = 0;
+    // When the connection is closed even if it was not answered.
+    std::chrono::steady_clock::time_point deadline;
+  };
+
+  void Run() noexcept;
+  void Accept() noexcept;
+  void Read(int fd, Connection &connection) noexcept;
+  void Write(int fd, Connection &connection) noexcept;
+  void Close(int fd) noexcept;
+  void CloseExpired() noexcept;
+  void Respond(int fd, Connection &connection, HttpResponse &response) noexcept;
+  void HandleRequest(int fd, Connection &connection) noexcept;
+
+  uint16_t port_;
+  const std::string address_;
+  std::map<std::string, HttpRequestHandler> handlers_;
+  std::chrono::milliseconds connection_timeout_{std::chrono::seconds(10)};
+
+  int listen_fd_ = -1;
+  int epoll_fd_  = -1;
+  int stop_fd_   = -1;
+  std::atomic<bool> is_running_{false};
+  std::thread thread_;
+
+  // Only accessed from the server thread.
+  std::unordered_map<int, Connection> connections_;
+  // The deadlines of the connections, in the order they were accepted, which is also the order
+  // of their deadlines. Connections that were closed meanwhile are skipped once their deadline
+  // passed.
+  std::deque<std::pair<std::chrono::steady_clock::time_point, int>> deadlines_;
+};
+}  // namespace server
+}  // namespace http
+}  // namespace ext
+OPENTELEMETRY_END_NAMESPACE
@@ -0,0 +1,92 @@
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <memory>
+
+#include "opentelemetry/metrics/sync_instruments.h"
+#include "opentelemetry/nostd/shared_ptr.h"
+#include "opentelemetry/sdk/metrics/meter.h"
+#include "opentelemetry/sdk/trace/processor.h"
+#include "opentelemetry/sdk/trace/recordable.h"
+
+OPENTELEMETRY_BEGIN_NAMESPACE
+namespace ext
+{
+namespace span_metrics
+{
+/*
+ * The metrics recorded for every ended span: the number of spans, a counter, and their
+ * duration in milliseconds, a value recorder.
+ */
+const char kSpanCallsMetricName[]    = "span.calls";
+const char kSpanDurationMetricName[] = "span.duration";
+
+/*
+ * The labels of both metrics.
+ */
+const char kSpanNameLabelKey[]   = "span.name";
+const char kSpanKindLabelKey[]   = "span.kind";
+const char kStatusCodeLabelKey[] = "status.code";
+
+/*
+ * The span processor derives rate, error and duration (RED) metrics from ended spans, so they
+ * do not have to be computed from every exported span. Every ended span is counted and its
+ * duration recorded, labeled with its name, kind and status code, into instruments of a meter,
+ * which is exported on its own with a PushController or a pull exporter. The instruments are
+ * updated without binding them: their label sets are found without locking, and an update only
+ * writes to the striped cells of the calling thread, so threads ending spans concurrently don't
+ * contend on any shared reference count or counter.
+ *
+ * Optionally, the spans of one in every few traces are still passed on to another processor,
+ * e.g. to export sample traces. Traces are picked by their trace id, like the trace id ratio
+ * sampler does, so that every span of a picked trace is passed on, in every process. Only those
+ * spans get a recordable of that processor.
+ *
+ * Spans with too many distinct names end up in the overflow label set of the meter's
+ * cardinality limit.
+ */
+class SpanMetricsProcessor : public opentelemetry::sdk::trace::SpanProcessor
+{
+public:
+  /*
+   * Initialize a span processor.
+   * @param meter the meter to record the metrics with
+   * @param processor the processor to pass sample spans on to, or nullptr for none
+   * @param sample_interval the spans of one in this many traces, on average, are passed on to
+   * processor
+   */
+  explicit SpanMetricsProcessor(
+      std::shared_ptr<opentelemetry::sdk::metrics::Meter> meter,
+      std::shared_ptr<opentelemetry::sdk::trace::SpanProcessor> processor = nullptr,
+      uint64_t sample_interval                                         = 1) noexcept;
+
+  /*
+   * Create a recordable that keeps what the metrics are labeled with. It wraps a recordable of
+   * the downstream processor once the span is started, if it is passed on.
+   */
+  std::unique_ptr<opentelemetry::sdk::trace::Recordable> MakeRecordable() noexcept override;
+
+  void OnStart(opentelemetry::sdk::trace::Recordable &span) noexcept override;
+
+  /*
+   * Count the span and record its duration, then pass it on if it was sampled.
+   */
+  void OnEnd(std::unique_ptr<opentelemetry::sdk::trace::Recordable> &&span) noexcept override;
+
+  void ForceFlush(
+      std::chrono::microseconds timeout = std::chrono::microseconds(0)) noexcept override;
+
+  void Shutdown(
+      std::chrono::microseconds timeout = std::chrono::microseconds(0)) noexcept override;
+
+private:
+  const std::shared_ptr<opentelemetry::sdk::metrics::Meter> meter_;
+  const std::shared_ptr<opentelemetry::sdk::trace::SpanProcessor> processor_;
+  const uint64_t sample_threshold_;
+  nostd::shared_ptr<opentelemetry::metrics::Counter<int64_t>> calls_;
+  nostd::shared_ptr<opentelemetry::metrics::ValueRecorder<double>> durations_;
+};
+}  // namespace span_metrics
+}  // namespace ext
+OPENTELEMETRY_END_NAMESPACE
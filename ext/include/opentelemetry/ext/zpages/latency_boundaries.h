@@ -0,0 +1,67 @@
+#pragma once
+
+#include <array>
+#include <chrono>
+#include <cstddef>
+
+#include "opentelemetry/version.h"
+
+OPENTELEMETRY_BEGIN_NAMESPACE
+namespace ext
+{
+namespace zpages
+{
+/**
+ * The latency buckets used by TraceZ to group completed spans, following the
+ * boundaries used by the other zPages implementations.
+ */
+enum LatencyBoundary
+{
+  k0MicroTo10Micro,
+  k10MicroTo100Micro,
+  k100MicroTo1Milli,
+  k1MilliTo10Milli,
+  k10MilliTo100Milli,
+  k100MilliTo1Second,
+  k1SecondTo10Second,
+  k10SecondTo100Second,
+  k100SecondToMax
+};
+
+/**
+ * The number of latency buckets.
+ */
+const std::size_t kLatencyBoundaryCount = 9;
+
+/**
+ * The inclusive lower bound of each latency bucket, indexed by LatencyBoundary.
+ */
+const std::array<std::chrono::nanoseconds, kLatencyBoundaryCount> kLatencyBoundaries = {
+    std::chrono::nanoseconds(0),
+    std::chrono::nanoseconds(std::chrono::microseconds(10)),
+    std::chrono::nanoseconds(std::chrono::microseconds(100)),
+    std::chrono::nanoseconds(std::chrono::milliseconds(1)),
+    std::chrono::nanoseconds(std::chrono::milliseconds(10)),
+    std::chrono::nanoseconds(std::chrono::milliseconds(100)),
+    std::chrono::nanoseconds(std::chrono::seconds(1)),
+    std::chrono::nanoseconds(std::chrono::seconds(10)),
+    std::chrono::nanoseconds(std::chrono::seconds(100)),
+};
+
+/**
+ * Find the latency bucket a span of the given duration falls into.
+ * @param duration the duration of a completed span
+ * @return the latency bucket for duration
+ */
+inline LatencyBoundary FindLatencyBoundary(std::chrono::nanoseconds duration) noexcept
+{
+  std::size_t boundary = kLatencyBoundaryCount - 1;
+  while (boundary > 0 && duration < kLatencyBoundaries[boundary])
+  {
+    --boundary;
+  }
+  return static_cast<LatencyBoundary>(boundary);
+}
+}  // namespace zpages
+}  // namespace ext
+OPENTELEMETRY_END_NAMESPACE
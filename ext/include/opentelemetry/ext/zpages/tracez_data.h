@@ -0,0 +1,206 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "opentelemetry/ext/zpages/latency_boundaries.h"
+#include "opentelemetry/sdk/trace/span_data.h"
+
+OPENTELEMETRY_BEGIN_NAMESPACE
+namespace ext
+{
+namespace zpages
+{
+/*
+ * The maximum number of sample spans kept per latency or error bucket.
+ */
+const std::size_t kMaxNumberOfSampleSpans = 5;
+
+/*
+ * The span counts for a single span name. This is all the data needed to render
+ * the TraceZ overview and is read from atomic counters without copying any span.
+ */
+struct TracezSummary
+{
+  // Number of spans that have started but not yet ended.
+  uint64_t running_span_count = 0;
+
+  // Number of completed spans without error, per latency bucket.
+  std::array<uint64_t, kLatencyBoundaryCount> latency_span_count{};
+
+  // Number of completed spans with an error status.
+  uint64_t error_span_count = 0;
+};
+
+/*
+ * A point-in-time copy of the span statistics and sample spans for a single span name.
+ */
+struct TracezData
+{
+  // Number of spans that have started but not yet ended.
+  uint64_t running_span_count = 0;
+
+  // Number of completed spans without error, per latency bucket.
+  std::array<uint64_t, kLatencyBoundaryCount> latency_span_count{};
+
+  // Number of completed spans with an error status.
+  uint64_t error_span_count = 0;
+
+  // Copies of the most recent completed spans without error, per latency bucket.
+  std::array<std::vector<std::unique_ptr<opentelemetry::sdk::trace::SpanData>>,
+             kLatencyBoundaryCount>
+      sample_latency_spans;
+
+  // Copies of the most recent completed spans with an error status.
+  std::vector<std::unique_ptr<opentelemetry::sdk::trace::SpanData>> sample_error_spans;
+
+  // The running spans, with only their name, ids, kind and start time, which don't change
+  // while they run. Only filled in when a single span name is queried.
+  std::vector<std::unique_ptr<opentelemetry::sdk::trace::SpanData>> sample_running_spans;
+};
+
+/*
+ * A fixed-size ring of sample spans. Once full, adding a span evicts the oldest one.
+ *
+ * This class is thread-compatible.
+ */
+class SampleSpanRing
+{
+public:
+  /*
+   * Add a span to the ring.
+   * @param span the span to store
+   * @return the evicted span, or nullptr if the ring was not yet full
+   */
+  std::unique_ptr<opentelemetry::sdk::trace::SpanData> Add(
+      std::unique_ptr<opentelemetry::sdk::trace::SpanData> &&span) noexcept
+  {
+    auto &slot = samples_[next_ % kMaxNumberOfSampleSpans];
+    ++next_;
+    std::unique_ptr<opentelemetry::sdk::trace::SpanData> evicted = std::move(slot);
+    slot                                                       = std::move(span);
+    return evicted;
+  }
+
+  /*
+   * Append copies of the stored spans, oldest first, to samples.
+   */
+  void CopyTo(std::vector<std::unique_ptr<opentelemetry::sdk::trace::SpanData>> &samples) const
+  {
+    const std::size_t count = next_ < kMaxNumberOfSampleSpans ? next_ : kMaxNumberOfSampleSpans;
+    for (std::size_t i = next_ - count; i < next_; ++i)
+    {
+      samples.emplace_back(
+          new opentelemetry::sdk::trace::SpanData(*samples_[i % kMaxNumberOfSampleSpans]));
+    }
+  }
+
+private:
+  std::array<std::unique_ptr<opentelemetry::sdk::trace::SpanData>, kMaxNumberOfSampleSpans>
+      samples_;
+  std::size_t next_ = 0;
+};
+
+/*
+ * Tracks the running spans of a single span name and aggregates its completed spans
+ * into latency and error buckets. Counts are kept in atomics and can be read at any
+ * time without locking; only a bounded number of sample spans is retained per
+ * bucket, so memory usage does not grow with the number of completed spans.
+ *
+ * This class is thread-safe.
+ */
+class TracezSpanBuckets
+{
+public:
+  /*
+   * @param name the span name of the spans tracked
+   */
+  explicit TracezSpanBuckets(opentelemetry::nostd::string_view name) : name_(name) {}
+
+  /*
+   * Track a span that was just started. Its ids, kind and start time are copied here, as the
+   * span is not yet shared with other threads, so that snapshots never read a running span
+   * while it is changed.
+   * @param span the running span, which must stay alive until RemoveRunning is called
+   */
+  void AddRunning(opentelemetry::sdk::trace::SpanData *span) noexcept;
+
+  /*
+   * Stop tracking a span that was previously passed to AddRunning.
+   * @param span the span that ended
+   */
+  void RemoveRunning(opentelemetry::sdk::trace::SpanData *span) noexcept;
+
+  /*
+   * Count a completed span and keep it as a sample, evicting the oldest sample
+   * of its bucket if needed.
+   * @param span the completed span
+   */
+  void Add(std::unique_ptr<opentelemetry::sdk::trace::SpanData> &&span) noexcept;
+
+  /*
+   * @return the number of spans that have started but not yet ended
+   */
+  uint64_t GetRunningSpanCount() const noexcept
+  {
+    return running_span_count_.load(std::memory_order_relaxed);
+  }
+
+  /*
+   * @return the number of completed spans without error in the given latency bucket
+   */
+  uint64_t GetLatencySpanCount(LatencyBoundary boundary) const noexcept
+  {
+    return latency_span_count_[boundary].load(std::memory_order_relaxed);
+  }
+
+  /*
+   * @return the number of completed spans with an error status
+   */
+  uint64_t GetErrorSpanCount() const noexcept
+  {
+    return error_span_count_.load(std::memory_order_relaxed);
+  }
+
+  /*
+   * @return the current counts, read without locking
+   */
+  TracezSummary GetSummary() const noexcept;
+
+  /*
+   * @param include_running whether to also copy the ids, kind and start time of every running
+   * span
+   * @return a copy of the counts and sample spans currently held
+   */
+  TracezData GetSnapshot(bool include_running = false) const;
+
+private:
+  // What is known of a running span when it starts, which doesn't change while it runs.
+  struct RunningSpan
+  {
+    opentelemetry::trace::TraceId trace_id;
+    opentelemetry::trace::SpanId span_id;
+    opentelemetry::trace::SpanId parent_span_id;
+    opentelemetry::trace::SpanKind span_kind;
+    opentelemetry::core::SystemTimestamp start_time;
+  };
+
+  const std::string name_;
+  std::atomic<uint64_t> running_span_count_{0};
+  std::array<std::atomic<uint64_t>, kLatencyBoundaryCount> latency_span_count_{};
+  std::atomic<uint64_t> error_span_count_{0};
+
+  mutable std::mutex mtx_;
+  std::unordered_map<opentelemetry::sdk::trace::SpanData *, RunningSpan> running_spans_;
+  std::array<SampleSpanRing, kLatencyBoundaryCount> sample_latency_spans_;
+  SampleSpanRing sample_error_spans_;
+};
+}  // namespace zpages
+}  // namespace ext
+OPENTELEMETRY_END_NAMESPACE
@@ -0,0 +1,52 @@
+#pragma once
+
+#include <map>
+#include <memory>
+#include <string>
+
+#include "opentelemetry/ext/zpages/tracez_data.h"
+#include "opentelemetry/ext/zpages/tracez_processor.h"
+
+OPENTELEMETRY_BEGIN_NAMESPACE
+namespace ext
+{
+namespace zpages
+{
+/*
+ * The TraceZ data aggregator serves the data displayed by TraceZ. The span processor updates
+ * per-name counts incrementally as spans start and end, so the overview is built from
+ * precomputed atomic counters without copying any span or holding a lock per span. Spans are
+ * only copied when a single span name is inspected.
+ */
+class TracezDataAggregator
+{
+public:
+  /*
+   * Initialize a data aggregator.
+   * @param span_processor the processor the span data is read from. This must not be a nullptr.
+   */
+  explicit TracezDataAggregator(std::shared_ptr<TracezSpanProcessor> span_processor) noexcept
+      : tracez_span_processor_(std::move(span_processor))
+  {}
+
+  /*
+   * Returns the running, per latency bucket and error span counts of every span name seen so
+   * far. No span is copied and the processor-wide lock is only held to read the set of names.
+   * @return map from span name to its span counts
+   */
+  std::map<std::string, TracezSummary> GetSpanSummaries() const noexcept;
+
+  /*
+   * Returns the span counts, latency and error sample spans and a copy of every running span
+   * of a single span name. Only the running spans of that name are walked.
+   * @param name the span name to inspect
+   * @return the data for name; empty if no span with that name was started
+   */
+  TracezData GetSpanData(const std::string &name) const;
+
+private:
+  std::shared_ptr<TracezSpanProcessor> tracez_span_processor_;
+};
+}  // namespace zpages
+}  // namespace ext
+OPENTELEMETRY_END_NAMESPACE
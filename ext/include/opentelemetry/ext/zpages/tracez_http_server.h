@@ -0,0 +1,63 @@
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <string>
+
+#include "opentelemetry/ext/http/server/http_server.h"
+#include "opentelemetry/ext/zpages/tracez_data_aggregator.h"
+
+OPENTELEMETRY_BEGIN_NAMESPACE
+namespace ext
+{
+namespace zpages
+{
+/*
+ * Serves the TraceZ pages on the loopback interface:
+ *   /tracez              HTML overview of all span names
+ *   /tracez?name=<name>  HTML samples of a single span name
+ *   /tracez/api          JSON overview of all span names
+ *   /tracez/api?name=... JSON samples of a single span name
+ *
+ * Pages are rendered on the server thread from the data aggregator. The overview only reads
+ * precomputed counters; span copies are only made for the name being inspected, so serving a
+ * page never holds a lock that the span hot path waits on for more than a map lookup.
+ */
+class TracezHttpServer
+{
+public:
+  /*
+   * Initialize a TraceZ server. The server does not listen until Start is called.
+   * @param aggregator the aggregator the pages are rendered from. This must not be a nullptr.
+   * @param port the loopback port to listen on; 0 picks an ephemeral port
+   */
+  explicit TracezHttpServer(std::unique_ptr<TracezDataAggregator> &&aggregator,
+                            uint16_t port = 0);
+
+  /*
+   * Start serving on a background thread.
+   * @return true if the server was started
+   */
+  bool Start() noexcept { return server_.Start(); }
+
+  /*
+   * Stop serving and join the server thread.
+   */
+  void Stop() noexcept { server_.Stop(); }
+
+  /*
+   * @return the port the server listens on; only meaningful after a successful Start
+   */
+  uint16_t GetPort() const noexcept { return server_.GetPort(); }
+
+private:
+  void ServeHtml(const http::server::HttpRequest &request, http::server::HttpResponse &response);
+
+  void ServeJson(const http::server::HttpRequest &request, http::server::HttpResponse &response);
+
+  std::unique_ptr<TracezDataAggregator> data_aggregator_;
+  http::server::HttpServer server_;
+};
+}  // namespace zpages
+}  // namespace ext
+OPENTELEMETRY_END_NAMESPACE
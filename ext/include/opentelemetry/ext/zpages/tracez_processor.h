@@ -1,12 +1,16 @@
 #pragma once
 
 #include <chrono>
+#include <map>
 #include <memory>
 #include <mutex>
+#include <string>
+#include <unordered_map>
 #include <unordered_set>
 #include <vector>
 #include <utility>
 
+#include "opentelemetry/ext/zpages/tracez_data.h"
 #include "opentelemetry/sdk/trace/processor.h"
 #include "opentelemetry/sdk/trace/recordable.h"
 #include "opentelemetry/sdk/trace/span_data.h"
@@ -17,15 +21,17 @@ namespace ext
 namespace zpages
 {
 /*
- * The span processor passes and stores running and completed recordables (casted as span_data)
- * to be used by the TraceZ Data Aggregator.
+ * The span processor groups running and completed recordables (casted as span_data) by span
+ * name, to be used by the TraceZ Data Aggregator. Running recordables are tracked per name;
+ * completed recordables are aggregated on the fly into per-name latency and error buckets,
+ * which only keep a bounded number of sample spans.
  */
 class TracezSpanProcessor : public opentelemetry::sdk::trace::SpanProcessor {
  public:
 
   struct CollectedSpans {
     std::unordered_set<opentelemetry::sdk::trace::SpanData*> running;
-    std::vector<std::unique_ptr<opentelemetry::sdk::trace::SpanData>> completed;
+    std::map<std::string, TracezData> completed;
   };
 
   /*
@@ -43,29 +49,46 @@ class TracezSpanProcessor : public opentelemetry::sdk::trace::SpanProcessor {
   }
 
   /*
-   * OnStart is called when a span starts; the recordable is cast to span_data and added to running_spans.
+   * OnStart is called when a span starts; the recordable is cast to span_data and added to the
+   * running spans of its name.
    * @param span a recordable for a span that was just started
    */
   void OnStart(opentelemetry::sdk::trace::Recordable &span) noexcept override;
 
   /*
-   * OnEnd is called when a span ends; that span_data is moved from running_spans to
-   * completed_spans
+   * OnEnd is called when a span ends; that span_data is removed from running spans, counted
+   * in the latency or error bucket of its name and kept as a sample of that bucket, evicting
+   * the bucket's oldest sample once kMaxNumberOfSampleSpans samples are held.
    * @param span a recordable for a span that was ended
    */
   void OnEnd(std::unique_ptr<opentelemetry::sdk::trace::Recordable> &&span) noexcept override;
 
   /*
    * Returns a snapshot of all spans stored. This snapshot has a copy of the
-   * stored running_spans and gives ownership of completed spans to the caller.
-   * Stored completed_spans are cleared from the processor. Currently,
-   * copy-on-write is utilized where possible to minimize contention, but locks
-   * may be added in the future.
-   * @return snapshot of all currently running spans and newly completed spans
-   * (spans never sent while complete) at the time that the function is called
+   * stored running_spans and, per span name, the cumulative completed span
+   * counts and copies of the sample spans of each bucket. Sample spans are
+   * copied outside of the processor-wide lock, so OnStart and OnEnd are only
+   * blocked while the set of span names is read.
+   * @return snapshot of all currently running spans and the aggregated completed
+   * spans at the time that the function is called
    */
   CollectedSpans GetSpanSnapshot() noexcept;
 
+  /*
+   * Returns the span buckets of every span name seen so far. Only the set of names is read
+   * under the processor-wide lock; no span is copied.
+   * @return pairs of span name and span buckets. Buckets are never removed, so the pointers
+   * remain valid for the lifetime of the processor.
+   */
+  std::vector<std::pair<std::string, const TracezSpanBuckets*>> GetSpanBuckets() const noexcept;
+
+  /*
+   * Returns the span buckets of a single span name.
+   * @param name the span name to look up
+   * @return the span buckets for name, or nullptr if no span with that name was started
+   */
+  const TracezSpanBuckets* GetSpanBuckets(const std::string &name) const noexcept;
+
   /*
    * For now, does nothing. In the future, it
    * may send all ended spans that have not yet been sent to the aggregator.
@@ -85,8 +108,17 @@ class TracezSpanProcessor : public opentelemetry::sdk::trace::SpanProcessor {
   void Shutdown(std::chrono::microseconds timeout = std::chrono::microseconds(0)) noexcept override {}
 
  private:
+  /*
+   * Returns the span buckets for name, creating them if needed. Must be called with mtx_ held.
+   */
+  TracezSpanBuckets* GetOrCreateSpanBuckets(opentelemetry::nostd::string_view name);
+
   mutable std::mutex mtx_;
-  CollectedSpans spans_;
+  // Running spans, mapped to the buckets of the name they were started with.
+  std::unordered_map<opentelemetry::sdk::trace::SpanData*, TracezSpanBuckets*> running_;
+  // Entries are never removed, so pointers to the buckets stay valid for the
+  // lifetime of the processor.
+  std::unordered_map<std::string, std::unique_ptr<TracezSpanBuckets>> span_buckets_;
 };
 }  // namespace zpages
 }  // namespace ext
@@ -0,0 +1,453 @@
+#include "opentelemetry/ext/http/server/http_server.h"
+
+#include <arpa/inet.h>
+#include <fcntl.h>
+#include <netinet/in.h>
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include <cerrno>
+#include <cstring>
+
+OPENTELEMETRY_BEGIN_NAMESPACE
+namespace ext
+{
+namespace http
+{
+namespace server
+{
+namespace
+{
+const int kMaxEvents = 64;
+
+const char *GetReasonPhrase(int code) noexcept
+{
+  switch (code)
+  {
+    case 200:
+      return "OK";
+    case 400:
+      return "Bad Request";
+    case 404:
+      return "Not Found";
+    case 405:
+      return "Method Not Allowed";
+    case 431:
+      return "Request Header Fields Too Large";
+    default:
+      return "Internal Server Error";
+  }
+}
+
+int HexValue(char c) noexcept
+{
+  if (c >= '0' && c <= '9')
+  {
+    return c - '0';
+  }
+  if (c >= 'a' && c <= 'f')
+  {
+    return c - 'a' + 10;
+  }
+  if (c >= 'A' && c <= 'F')
+  {
+    return c - 'A' + 10;
+  }
+  return -1;
+}
+
+// Calls a handler, answering with status 500 if it throws, e.g. std::bad_alloc while rendering
+// a page, rather than terminating the process from the server thread.
+void CallHandler(const HttpRequestHandler &handler,
+                 const HttpRequest &request,
+                 HttpResponse &response) noexcept
+#if __EXCEPTIONS
+try
+#endif
+{
+  handler(request, response);
+}
+#if __EXCEPTIONS
+catch (...)
+{
+  response      = HttpResponse();
+  response.code = 500;
+}
+#endif
+
+std::string PercentDecode(nostd::string_view value)
+{
+  std::string decoded;
+  decoded.reserve(value.size());
+  for (std::size_t i = 0; i < value.size(); ++i)
+  {
+    if (value[i] == '+')
+    {
+      decoded.push_back(' ');
+    }
+    else if (value[i] == '%' && i + 2 < value.size() && HexValue(value[i + 1]) >= 0 &&
+             HexValue(value[i + 2]) >= 0)
+    {
+      decoded.push_back(static_cast<char>(HexValue(value[i + 1]) * 16 + HexValue(value[i + 2])));
+      i += 2;
+    }
+    else
+    {
+      decoded.push_back(value[i]);
+    }
+  }
+  return decoded;
+}
+}  // namespace
+
+std::string HttpRequest::GetQueryParameter(nostd::string_view key) const
+{
+  std::size_t param_start = 0;
+  while (param_start < query.size())
+  {
+    auto param_end = query.find('&', param_start);
+    if (param_end == std::string::npos)
+    {
+      param_end = query.size();
+    }
+    auto equals = query.find('=', param_start);
+    auto key_end = equals < param_end ? equals : param_end;
+    if (nostd::string_view(query.data() + param_start, key_end - param_start) == key)
+    {
+      return key_end == param_end
+                 ? std::string()
+                 : PercentDecode(
+                       nostd::string_view(query.data() + key_end + 1, param_end - key_end - 1));
+    }
+    param_start = param_end + 1;
+  }
+  return std::string();
+}
+
+void HttpServer::AddHandler(const std::string &path, HttpRequestHandler handler)
+{
+  handlers_[path] = std::move(handler);
+}
+
+bool HttpServer::Start() noexcept
+{
+  if (is_running_.exchange(true))
+  {
+    return false;
+  }
+
+  listen_fd_ = socket(AF_INET, SOCK_STREAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0);
+  epoll_fd_  = epoll_create1(EPOLL_CLOEXEC);
+  stop_fd_   = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+
+  int reuse = 1;
+  sockaddr_in address;
+  std::memset(&address, 0, sizeof(address));
+  address.sin_family      = AF_INET;
+  address.sin_port        = htons(port_);
+  socklen_t address_size  = sizeof(address);
+
+  epoll_event listen_event;
+  listen_event.events  = EPOLLIN;
+  listen_event.data.fd = listen_fd_;
+  epoll_event stop_event;
+  stop_event.events  = EPOLLIN;
+  stop_event.data.fd = stop_fd_;
+
+  if (listen_fd_ < 0 || epoll_fd_ < 0 || stop_fd_ < 0 ||
+      inet_pton(AF_INET, address_.c_str(), &address.sin_addr) != 1 ||
+      setsockopt(listen_fd_, SOL_SOCKET, SO_REUSEADDR, &reuse, sizeof(reuse)) != 0 ||
+      bind(listen_fd_, reinterpret_cast<sockaddr *>(&address), sizeof(address)) != 0 ||
+      listen(listen_fd_, SOMAXCONN) != 0 ||
+      getsockname(listen_fd_, reinterpret_cast<sockaddr *>(&address), &address_size) != 0 ||
+      epoll_ctl(epoll_fd_, EPOLL_CTL_ADD, listen_fd_, &listen_event) != 0 ||
+      epoll_ctl(epoll_fd_, EPOLL_CTL_ADD, stop_fd_, &stop_event) != 0)
+  {
+    for (int fd : {listen_fd_, epoll_fd_, stop_fd_})
+    {
+      if (fd >= 0)
+      {
+        close(fd);
+      }
+    }
+    listen_fd_ = epoll_fd_ = stop_fd_ = -1;
+    is_running_                       = false;
+    return false;
+  }
+
+  port_   = ntohs(address.sin_port);
+  thread_ = std::thread(&HttpServer::Run, this);
+  return true;
+}
+
+void HttpServer::Stop() noexcept
+{
+  if (!thread_.joinable())
+  {
+    return;
+  }
+  uint64_t value = 1;
+  if (write(stop_fd_, &value, sizeof(value)) < 0)
+  {
+    // The eventfd counter cannot overflow with a single write, so this does not happen.
+  }
+  thread_.join();
+
+  for (auto &connection : connections_)
+  {
+    close(connection.first);
+  }
+  connections_.clear();
+  deadlines_.clear();
+  close(listen_fd_);
+  close(epoll_fd_);
+  close(stop_fd_);
+  listen_fd_ = epoll_fd_ = stop_fd_ = -1;
+  is_running_                       = false;
+}
+
+void HttpServer::Run() noexcept
+{
+  epoll_event events[kMaxEvents];
+  while (true)
+  {
+    int timeout = -1;
+    if (!deadlines_.empty())
+    {
+      // Rounded up, so that the deadline has passed once the wait times out.
+      auto remaining = std::chrono::duration_cast<std::chrono::milliseconds>(
+                           deadlines_.front().first - std::chrono::steady_clock::now())
+                           .count() +
+                       1;
+      timeout = remaining < 0 ? 0 : static_cast<int>(remaining);
+    }
+    int count = epoll_wait(epoll_fd_, events, kMaxEvents, timeout);
+    if (count < 0)
+    {
+      if (errno == EINTR)
+      {
+        continue;
+      }
+      return;
+    }
+    for (int i = 0; i < count; ++i)
+    {
+      int fd = events[i].data.fd;
+      if (fd == stop_fd_)
+      {
+        return;
+      }
+      if (fd == listen_fd_)
+      {
+        Accept();
+        continue;
+      }
+      auto connection = connections_.find(fd);
+      if (connection == connections_.end())
+      {
+        continue;
+      }
+      if (events[i].events & (EPOLLERR | EPOLLHUP))
+      {
+        Close(fd);
+      }
+      else if (events[i].events & EPOLLIN)
+      {
+        Read(fd, connection->second);
+      }
+      else if (events[i].events & EPOLLOUT)
+      {
+        Write(fd, connection->second);
+      }
+    }
+    CloseExpired();
+  }
+}
+
+void HttpServer::Accept() noexcept
+{
+  while (true)
+  {
+    int fd = accept4(listen_fd_, nullptr, nullptr, SOCK_NONBLOCK | SOCK_CLOEXEC);
+    if (fd < 0)
+    {
+      return;
+    }
+    epoll_event event;
+    event.events  = EPOLLIN;
+    event.data.fd = fd;
+    if (epoll_ctl(epoll_fd_, EPOLL_CTL_ADD, fd, &event) != 0)
+    {
+      close(fd);
+      continue;
+    }
+    auto deadline             = std::chrono::steady_clock::now() + connection_timeout_;
+    connections_[fd].deadline = deadline;
+    deadlines_.emplace_back(deadline, fd);
+  }
+}
+
+void HttpServer::Read(int fd, Connection &connection) noexcept
+{
+  char buffer[4096];
+  bool is_closed = false;
+  while (!is_closed)
+  {
+    ssize_t count = read(fd, buffer, sizeof(buffer));
+    if (count > 0)
+    {
+      connection.input.append(buffer, static_cast<std::size_t>(count));
+      if (connection.input.size() > kMaxRequestSize)
+      {
+        HttpResponse response;
+        response.code = 431;
+        Respond(fd, connection, response);
+        return;
+      }
+      continue;
+    }
+    if (count < 0 && (errno == EAGAIN || errno == EWOULDBLOCK))
+    {
+      break;
+    }
+    if (count < 0 && errno == EINTR)
+    {
+      continue;
+    }
+    if (count < 0)
+    {
+      Close(fd);
+      return;
+    }
+    // The peer shut down its side; a complete request can still be answered.
+    is_closed = true;
+  }
+
+  if (connection.input.find("\r\n\r\n") != std::string::npos)
+  {
+    HandleRequest(fd, connection);
+  }
+  else if (is_closed)
+  {
+    Close(fd);
+  }
+}
+
+void HttpServer::HandleRequest(int fd, Connection &connection) noexcept
+{
+  HttpResponse response;
+  HttpRequest request;
+
+  // Request line: METHOD SP request-target SP HTTP-version
+  auto line_end   = connection.input.find("\r\n");
+  auto method_end = connection.input.find(' ');
+  auto target_end = connection.input.find(' ', method_end + 1);
+  if (method_end == std::string::npos || target_end == std::string::npos ||
+      target_end > line_end)
+  {
+    response.code = 400;
+    Respond(fd, connection, response);
+    return;
+  }
+  request.method     = connection.input.substr(0, method_end);
+  std::string target = connection.input.substr(method_end + 1, target_end - method_end - 1);
+  auto query_start   = target.find('?');
+  request.path       = target.substr(0, query_start);
+  if (query_start != std::string::npos)
+  {
+    request.query = target.substr(query_start + 1);
+  }
+
+  auto handler = handlers_.find(request.path);
+  if (request.method != "GET")
+  {
+    response.code = 405;
+  }
+  else if (handler == handlers_.end())
+  {
+    response.code = 404;
+  }
+  else
+  {
+    CallHandler(handler->second, request, response);
+  }
+  Respond(fd, connection, response);
+}
+
+void HttpServer::Respond(int fd, Connection &connection, HttpResponse &response) noexcept
+{
+  std::string &output = connection.output;
+  output.reserve(128);
+  output.append("HTTP/1.1 ");
+  output.append(std::to_string(response.code));
+  output.push_back(' ');
+  output.append(GetReasonPhrase(response.code));
+  output.append("\r\nContent-Type: ");
+  output.append(response.content_type);
+  output.append("\r\nContent-Length: ");
+  output.append(std::to_string(response.body.size()));
+  output.append("\r\nConnection: close\r\n\r\n");
+  // Large bodies such as metric scrapes are sent without being copied.
+  connection.body = std::move(response.body);
+
+  epoll_event event;
+  event.events  = EPOLLOUT;
+  event.data.fd = fd;
+  epoll_ctl(epoll_fd_, EPOLL_CTL_MOD, fd, &event);
+  Write(fd, connection);
+}
+
+void HttpServer::Write(int fd, Connection &connection) noexcept
+{
+  while (connection.written < connection.output.size() + connection.body.size())
+  {
+    bool is_header    = connection.written < connection.output.size();
+    auto &buffer      = is_header ? connection.output : connection.body;
+    std::size_t start = is_header ? connection.written
+                                  : connection.written - connection.output.size();
+    ssize_t count = send(fd, buffer.data() + start, buffer.size() - start, MSG_NOSIGNAL);
+    if (count < 0 && (errno == EAGAIN || errno == EWOULDBLOCK))
+    {
+      // Wait for EPOLLOUT.
+      return;
+    }
+    if (count < 0 && errno == EINTR)
+    {
+      continue;
+    }
+    if (count < 0)
+    {
+      break;
+    }
+    connection.written += static_cast<std::size_t>(count);
+  }
+  Close(fd);
+}
+
+void HttpServer::Close(int fd) noexcept
+{
+  epoll_ctl(epoll_fd_, EPOLL_CTL_DEL, fd, nullptr);
+  close(fd);
+  connections_.erase(fd);
+}
+
+void HttpServer::CloseExpired() noexcept
+{
+  auto now = std::chrono::steady_clock::now();
+  while (!deadlines_.empty() && deadlines_.front().first <= now)
+  {
+    // The connection may have been closed, and its descriptor reused by a later connection.
+    auto connection = connections_.find(deadlines_.front().second);
+    if (connection != connections_.end() && connection->second.deadline <= now)
+    {
+      Close(connection->first);
+    }
+    deadlines_.pop_front();
+  }
+}
+}  // namespace server
+}  // namespace http
+}  // namespace ext
+OPENTELEMETRY_END_NAMESPACE
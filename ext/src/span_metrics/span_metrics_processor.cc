@@ -0,0 +1,217 @@
+#include "opentelemetry/ext/span_metrics/span_metrics_processor.h"
+
+#include <array>
+#include <string>
+#include <utility>
+
+#include "opentelemetry/sdk/trace/samplers/trace_id_ratio.h"
+#include "opentelemetry/trace/key_value_iterable_view.h"
+
+OPENTELEMETRY_BEGIN_NAMESPACE
+namespace ext
+{
+namespace span_metrics
+{
+namespace
+{
+using opentelemetry::sdk::trace::Recordable;
+using opentelemetry::trace::CanonicalCode;
+using opentelemetry::trace::SpanKind;
+
+// Indexed by SpanKind.
+const char *const kSpanKindNames[] = {"internal", "server", "client", "producer", "consumer"};
+
+// Indexed by CanonicalCode.
+const char *const kStatusCodeNames[] = {
+    "OK", "CANCELLED", "UNKNOWN", "INVALID_ARGUMENT", "DEADLINE_EXCEEDED", "NOT_FOUND",
+    "ALREADY_EXISTS", "PERMISSION_DENIED", "RESOURCE_EXHAUSTED", "FAILED_PRECONDITION",
+    "ABORTED", "OUT_OF_RANGE", "UNIMPLEMENTED", "INTERNAL", "UNAVAILABLE", "DATA_LOSS",
+    "UNAUTHENTICATED"};
+
+/*
+ * Keeps the name, kind, status and duration of a span, and forwards every update to the
+ * recordable of the downstream processor if the trace of the span is sampled.
+ */
+class SpanMetricsRecordable final : public Recordable
+{
+public:
+  SpanMetricsRecordable(opentelemetry::sdk::trace::SpanProcessor *processor,
+                        uint64_t sample_threshold) noexcept
+      : processor_(processor), sample_threshold_(sample_threshold)
+  {}
+
+  void Init(const opentelemetry::sdk::trace::SpanStartData &data) noexcept override
+  {
+    name_.assign(data.name.data(), data.name.size());
+    span_kind_ = data.span_kind;
+    // Decided by the trace id, like the trace id ratio samplers, so that every span of a trace
+    // is passed on or none is.
+    if (processor_ != nullptr && sample_threshold_ != 0 &&
+        opentelemetry::sdk::trace::GetTraceIdRatioBits(data.trace_id) <= sample_threshold_)
+    {
+      sample_ = processor_->MakeRecordable();
+    }
+    if (sample_ != nullptr)
+    {
+      sample_->Init(data);
+    }
+  }
+
+  void SetIds(opentelemetry::trace::TraceId trace_id,
+              opentelemetry::trace::SpanId span_id,
+              opentelemetry::trace::SpanId parent_span_id) noexcept override
+  {
+    if (sample_ != nullptr)
+    {
+      sample_->SetIds(trace_id, span_id, parent_span_id);
+    }
+  }
+
+  void SetAttribute(nostd::string_view key, const common::AttributeValue &value) noexcept override
+  {
+    if (sample_ != nullptr)
+    {
+      sample_->SetAttribute(key, value);
+    }
+  }
+
+  void AddEvent(nostd::string_view name,
+                core::SystemTimestamp timestamp,
+                const opentelemetry::trace::KeyValueIterable &attributes) noexcept override
+  {
+    if (sample_ != nullptr)
+    {
+      sample_->AddEvent(name, timestamp, attributes);
+    }
+  }
+
+  void SetStatus(CanonicalCode code, nostd::string_view description) noexcept override
+  {
+    status_code_ = code;
+    if (sample_ != nullptr)
+    {
+      sample_->SetStatus(code, description);
+    }
+  }
+
+  void SetName(nostd::string_view name) noexcept override
+  {
+    name_.assign(name.data(), name.size());
+    if (sample_ != nullptr)
+    {
+      sample_->SetName(name);
+    }
+  }
+
+  void SetSpanKind(SpanKind span_kind) noexcept override
+  {
+    span_kind_ = span_kind;
+    if (sample_ != nullptr)
+    {
+      sample_->SetSpanKind(span_kind);
+    }
+  }
+
+  void SetStartTime(core::SystemTimestamp start_time) noexcept override
+  {
+    if (sample_ != nullptr)
+    {
+      sample_->SetStartTime(start_time);
+    }
+  }
+
+  void SetDuration(std::chrono::nanoseconds duration) noexcept override
+  {
+    duration_ = duration;
+    if (sample_ != nullptr)
+    {
+      sample_->SetDuration(duration);
+    }
+  }
+
+  opentelemetry::sdk::trace::SpanProcessor *const processor_;
+  const uint64_t sample_threshold_;
+  std::unique_ptr<Recordable> sample_;
+  std::string name_;
+  SpanKind span_kind_        = SpanKind::kInternal;
+  CanonicalCode status_code_ = CanonicalCode::OK;
+  std::chrono::nanoseconds duration_{0};
+};
+
+template <class T, std::size_t N>
+const char *GetName(const char *const (&names)[N], T value) noexcept
+{
+  auto index = static_cast<std::size_t>(value);
+  return index < N ? names[index] : "";
+}
+}  // namespace
+
+SpanMetricsProcessor::SpanMetricsProcessor(
+    std::shared_ptr<opentelemetry::sdk::metrics::Meter> meter,
+    std::shared_ptr<opentelemetry::sdk::trace::SpanProcessor> processor,
+    uint64_t sample_interval) noexcept
+    : meter_(std::move(meter)),
+      processor_(std::move(processor)),
+      sample_threshold_(opentelemetry::sdk::trace::GetProbabilityThreshold(
+          1.0 / static_cast<double>(sample_interval == 0 ? 1 : sample_interval))),
+      calls_(meter_->NewIntCounter(kSpanCallsMetricName, "The number of ended spans", "1")),
+      durations_(meter_->NewDoubleValueRecorder(kSpanDurationMetricName,
+                                                "The duration of ended spans", "ms"))
+{}
+
+std::unique_ptr<Recordable> SpanMetricsProcessor::MakeRecordable() noexcept
+{
+  return std::unique_ptr<Recordable>(
+      new SpanMetricsRecordable(processor_.get(), sample_threshold_));
+}
+
+void SpanMetricsProcessor::OnStart(Recordable &span) noexcept
+{
+  auto &sample = static_cast<SpanMetricsRecordable &>(span).sample_;
+  if (sample != nullptr)
+  {
+    processor_->OnStart(*sample);
+  }
+}
+
+void SpanMetricsProcessor::OnEnd(std::unique_ptr<Recordable> &&span) noexcept
+{
+  if (span == nullptr)
+  {
+    return;
+  }
+  auto &recordable = static_cast<SpanMetricsRecordable &>(*span);
+  std::array<std::pair<nostd::string_view, common::AttributeValue>, 3> labels = {
+      {{kSpanNameLabelKey, nostd::string_view(recordable.name_)},
+       {kSpanKindLabelKey, nostd::string_view(GetName(kSpanKindNames, recordable.span_kind_))},
+       {kStatusCodeLabelKey,
+        nostd::string_view(GetName(kStatusCodeNames, recordable.status_code_))}}};
+  opentelemetry::trace::KeyValueIterableView<decltype(labels)> label_view(labels);
+  calls_->Add(1, label_view);
+  durations_->Record(
+      std::chrono::duration<double, std::milli>(recordable.duration_).count(), label_view);
+
+  if (recordable.sample_ != nullptr)
+  {
+    processor_->OnEnd(std::move(recordable.sample_));
+  }
+}
+
+void SpanMetricsProcessor::ForceFlush(std::chrono::microseconds timeout) noexcept
+{
+  if (processor_ != nullptr)
+  {
+    processor_->ForceFlush(timeout);
+  }
+}
+
+void SpanMetricsProcessor::Shutdown(std::chrono::microseconds timeout) noexcept
+{
+  if (processor_ != nullptr)
+  {
+    processor_->Shutdown(timeout);
+  }
+}
+}  // namespace span_metrics
+}  // namespace ext
+OPENTELEMETRY_END_NAMESPACE
@@ -0,0 +1,96 @@
+#include "opentelemetry/ext/zpages/tracez_data.h"
+
+OPENTELEMETRY_BEGIN_NAMESPACE
+namespace ext
+{
+namespace zpages
+{
+
+void TracezSpanBuckets::AddRunning(opentelemetry::sdk::trace::SpanData *span) noexcept
+{
+  RunningSpan running = {span->GetTraceId(), span->GetSpanId(), span->GetParentSpanId(),
+                         span->GetSpanKind(), span->GetStartTime()};
+  running_span_count_.fetch_add(1, std::memory_order_relaxed);
+  std::lock_guard<std::mutex> lock(mtx_);
+  running_spans_.emplace(span, running);
+}
+
+void TracezSpanBuckets::RemoveRunning(opentelemetry::sdk::trace::SpanData *span) noexcept
+{
+  running_span_count_.fetch_sub(1, std::memory_order_relaxed);
+  std::lock_guard<std::mutex> lock(mtx_);
+  running_spans_.erase(span);
+}
+
+void TracezSpanBuckets::Add(std::unique_ptr<opentelemetry::sdk::trace::SpanData> &&span) noexcept
+{
+  std::unique_ptr<opentelemetry::sdk::trace::SpanData> evicted;
+  if (span->GetStatus() != opentelemetry::trace::CanonicalCode::OK)
+  {
+    error_span_count_.fetch_add(1, std::memory_order_relaxed);
+    std::lock_guard<std::mutex> lock(mtx_);
+    evicted = sample_error_spans_.Add(std::move(span));
+  }
+  else
+  {
+    auto boundary = FindLatencyBoundary(span->GetDuration());
+    latency_span_count_[boundary].fetch_add(1, std::memory_order_relaxed);
+    std::lock_guard<std::mutex> lock(mtx_);
+    evicted = sample_latency_spans_[boundary].Add(std::move(span));
+  }
+  // The evicted span, if any, is destroyed here, outside of the critical section.
+}
+
+TracezSummary TracezSpanBuckets::GetSummary() const noexcept
+{
+  TracezSummary summary;
+  summary.running_span_count = running_span_count_.load(std::memory_order_relaxed);
+  for (std::size_t boundary = 0; boundary < kLatencyBoundaryCount; ++boundary)
+  {
+    summary.latency_span_count[boundary] =
+        latency_span_count_[boundary].load(std::memory_order_relaxed);
+  }
+  summary.error_span_count = error_span_count_.load(std::memory_order_relaxed);
+  return summary;
+}
+
+TracezData TracezSpanBuckets::GetSnapshot(bool include_running) const
+{
+  TracezData data;
+  data.running_span_count = running_span_count_.load(std::memory_order_relaxed);
+  for (std::size_t boundary = 0; boundary < kLatencyBoundaryCount; ++boundary)
+  {
+    data.latency_span_count[boundary] =
+        latency_span_count_[boundary].load(std::memory_order_relaxed);
+  }
+  data.error_span_count = error_span_count_.load(std::memory_order_relaxed);
+
+  std::lock_guard<std::mutex> lock(mtx_);
+  for (std::size_t boundary = 0; boundary < kLatencyBoundaryCount; ++boundary)
+  {
+    sample_latency_spans_[boundary].CopyTo(data.sample_latency_spans[boundary]);
+  }
+  sample_error_spans_.CopyTo(data.sample_error_spans);
+  if (include_running)
+  {
+    data.sample_running_spans.reserve(running_spans_.size());
+    // Running spans are changed under their own lock, so only what was copied as they started
+    // is read here.
+    for (auto &span_running : running_spans_)
+    {
+      auto &running = span_running.second;
+      std::unique_ptr<opentelemetry::sdk::trace::SpanData> span(
+          new opentelemetry::sdk::trace::SpanData);
+      span->SetIds(running.trace_id, running.span_id, running.parent_span_id);
+      span->SetName(name_);
+      span->SetSpanKind(running.span_kind);
+      span->SetStartTime(running.start_time);
+      data.sample_running_spans.push_back(std::move(span));
+    }
+  }
+  return data;
+}
+
+}  // namespace zpages
+}  // namespace ext
+OPENTELEMETRY_END_NAMESPACE
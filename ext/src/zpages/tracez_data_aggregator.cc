@@ -0,0 +1,31 @@
+#include "opentelemetry/ext/zpages/tracez_data_aggregator.h"
+
+OPENTELEMETRY_BEGIN_NAMESPACE
+namespace ext
+{
+namespace zpages
+{
+
+std::map<std::string, TracezSummary> TracezDataAggregator::GetSpanSummaries() const noexcept
+{
+  std::map<std::string, TracezSummary> summaries;
+  for (auto &name_buckets : tracez_span_processor_->GetSpanBuckets())
+  {
+    summaries[name_buckets.first] = name_buckets.second->GetSummary();
+  }
+  return summaries;
+}
+
+TracezData TracezDataAggregator::GetSpanData(const std::string &name) const
+{
+  auto buckets = tracez_span_processor_->GetSpanBuckets(name);
+  if (buckets == nullptr)
+  {
+    return TracezData();
+  }
+  return buckets->GetSnapshot(true);
+}
+
+}  // namespace zpages
+}  // namespace ext
+OPENTELEMETRY_END_NAMESPACE
@@ -0,0 +1,295 @@
+#include "opentelemetry/ext/zpages/tracez_http_server.h"
+
+#include <cstdio>
+
+OPENTELEMETRY_BEGIN_NAMESPACE
+namespace ext
+{
+namespace zpages
+{
+namespace
+{
+using opentelemetry::sdk::trace::SpanData;
+using SpanSamples = std::vector<std::unique_ptr<SpanData>>;
+
+const char *const kLatencyBoundaryNames[kLatencyBoundaryCount] = {
+    "0us-10us", "10us-100us", "100us-1ms", "1ms-10ms", "10ms-100ms",
+    "100ms-1s", "1s-10s",     "10s-100s",  ">100s"};
+
+void AppendHtmlEscaped(std::string &out, nostd::string_view value)
+{
+  for (char c : value)
+  {
+    switch (c)
+    {
+      case '&':
+        out.append("&amp;");
+        break;
+      case '<':
+        out.append("&lt;");
+        break;
+      case '>':
+        out.append("&gt;");
+        break;
+      case '"':
+        out.append("&quot;");
+        break;
+      case '\'':
+        out.append("&#39;");
+        break;
+      default:
+        out.push_back(c);
+    }
+  }
+}
+
+void AppendUrlEncoded(std::string &out, nostd::string_view value)
+{
+  static const char kHexDigits[] = "0123456789ABCDEF";
+  for (char c : value)
+  {
+    if ((c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || (c >= '0' && c <= '9') || c == '-' ||
+        c == '_' || c == '.' || c == '~')
+    {
+      out.push_back(c);
+    }
+    else
+    {
+      out.push_back('%');
+      out.push_back(kHexDigits[static_cast<unsigned char>(c) >> 4]);
+      out.push_back(kHexDigits[static_cast<unsigned char>(c) & 0xf]);
+    }
+  }
+}
+
+void AppendJsonString(std::string &out, nostd::string_view value)
+{
+  out.push_back('"');
+  for (char c : value)
+  {
+    if (c == '"' || c == '\\')
+    {
+      out.push_back('\\');
+      out.push_back(c);
+    }
+    else if (static_cast<unsigned char>(c) < 0x20)
+    {
+      char escaped[7];
+      std::snprintf(escaped, sizeof(escaped), "\\u%04x", static_cast<unsigned char>(c));
+      out.append(escaped);
+    }
+    else
+    {
+      out.push_back(c);
+    }
+  }
+  out.push_back('"');
+}
+
+template <class Id>
+void AppendId(std::string &out, const Id &id)
+{
+  char buffer[2 * Id::kSize];
+  id.ToLowerBase16(buffer);
+  out.append(buffer, sizeof(buffer));
+}
+
+void AppendSpanJson(std::string &out, const SpanData &span)
+{
+  out.append("{\"name\":");
+  AppendJsonString(out, span.GetName());
+  out.append(",\"trace_id\":\"");
+  AppendId(out, span.GetTraceId());
+  out.append("\",\"span_id\":\"");
+  AppendId(out, span.GetSpanId());
+  out.append("\",\"parent_span_id\":\"");
+  AppendId(out, span.GetParentSpanId());
+  out.append("\",\"start_time_unix_nano\":");
+  out.append(std::to_string(span.GetStartTime().time_since_epoch().count()));
+  out.append(",\"duration_nano\":");
+  out.append(std::to_string(span.GetDuration().count()));
+  out.append(",\"status\":");
+  out.append(std::to_string(static_cast<int>(span.GetStatus())));
+  out.append(",\"description\":");
+  AppendJsonString(out, span.GetDescription());
+  out.push_back('}');
+}
+
+void AppendSpansJson(std::string &out, const SpanSamples &spans)
+{
+  out.push_back('[');
+  for (std::size_t i = 0; i < spans.size(); ++i)
+  {
+    if (i > 0)
+    {
+      out.push_back(',');
+    }
+    AppendSpanJson(out, *spans[i]);
+  }
+  out.push_back(']');
+}
+
+void AppendSpansHtml(std::string &out, const char *title, const SpanSamples &spans)
+{
+  out.append("<h3>");
+  out.append(title);
+  out.append("</h3>\n<table>\n<tr><th>Trace ID</th><th>Span ID</th><th>Parent Span ID</th>"
+             "<th>Start (ns since epoch)</th><th>Duration (ns)</th><th>Status</th>"
+             "<th>Description</th></tr>\n");
+  for (auto &span : spans)
+  {
+    out.append("<tr><td>");
+    AppendId(out, span->GetTraceId());
+    out.append("</td><td>");
+    AppendId(out, span->GetSpanId());
+    out.append("</td><td>");
+    AppendId(out, span->GetParentSpanId());
+    out.append("</td><td>");
+    out.append(std::to_string(span->GetStartTime().time_since_epoch().count()));
+    out.append("</td><td>");
+    out.append(std::to_string(span->GetDuration().count()));
+    out.append("</td><td>");
+    out.append(std::to_string(static_cast<int>(span->GetStatus())));
+    out.append("</td><td>");
+    AppendHtmlEscaped(out, span->GetDescription());
+    out.append("</td></tr>\n");
+  }
+  out.append("</table>\n");
+}
+
+const char kHtmlHeader[] =
+    "<!DOCTYPE html>\n<html>\n<head><meta charset=\"utf-8\"><title>TraceZ</title>"
+    "<style>table{border-collapse:collapse}th,td{border:1px solid #ccc;padding:2px 6px}"
+    "td{text-align:right}</style></head>\n<body>\n";
+
+const char kHtmlFooter[] = "</body>\n</html>\n";
+}  // namespace
+
+TracezHttpServer::TracezHttpServer(std::unique_ptr<TracezDataAggregator> &&aggregator,
+                                   uint16_t port)
+    : data_aggregator_(std::move(aggregator)), server_(port)
+{
+  server_.AddHandler("/tracez", [this](const http::server::HttpRequest &request,
+                                       http::server::HttpResponse &response) {
+    ServeHtml(request, response);
+  });
+  server_.AddHandler("/tracez/api", [this](const http::server::HttpRequest &request,
+                                           http::server::HttpResponse &response) {
+    ServeJson(request, response);
+  });
+}
+
+void TracezHttpServer::ServeHtml(const http::server::HttpRequest &request,
+                                 http::server::HttpResponse &response)
+{
+  std::string &out      = response.body;
+  response.content_type = "text/html; charset=utf-8";
+  out.append(kHtmlHeader);
+
+  auto name = request.GetQueryParameter("name");
+  if (name.empty())
+  {
+    auto summaries = data_aggregator_->GetSpanSummaries();
+    out.reserve(1024 + summaries.size() * 256);
+    out.append("<h1>TraceZ Summary</h1>\n<table>\n<tr><th>Span Name</th><th>Running</th>");
+    for (auto boundary_name : kLatencyBoundaryNames)
+    {
+      out.append("<th>");
+      AppendHtmlEscaped(out, boundary_name);
+      out.append("</th>");
+    }
+    out.append("<th>Errors</th></tr>\n");
+    for (auto &name_summary : summaries)
+    {
+      out.append("<tr><td><a href=\"/tracez?name=");
+      AppendUrlEncoded(out, name_summary.first);
+      out.append("\">");
+      AppendHtmlEscaped(out, name_summary.first);
+      out.append("</a></td><td>");
+      out.append(std::to_string(name_summary.second.running_span_count));
+      for (auto count : name_summary.second.latency_span_count)
+      {
+        out.append("</td><td>");
+        out.append(std::to_string(count));
+      }
+      out.append("</td><td>");
+      out.append(std::to_string(name_summary.second.error_span_count));
+      out.append("</td></tr>\n");
+    }
+    out.append("</table>\n");
+  }
+  else
+  {
+    auto data = data_aggregator_->GetSpanData(name);
+    out.append("<h1>TraceZ: ");
+    AppendHtmlEscaped(out, name);
+    out.append("</h1>\n<p><a href=\"/tracez\">Back to summary</a></p>\n");
+    AppendSpansHtml(out, "Running", data.sample_running_spans);
+    for (std::size_t boundary = 0; boundary < kLatencyBoundaryCount; ++boundary)
+    {
+      AppendSpansHtml(out, kLatencyBoundaryNames[boundary], data.sample_latency_spans[boundary]);
+    }
+    AppendSpansHtml(out, "Errors", data.sample_error_spans);
+  }
+  out.append(kHtmlFooter);
+}
+
+void TracezHttpServer::ServeJson(const http::server::HttpRequest &request,
+                                 http::server::HttpResponse &response)
+{
+  std::string &out      = response.body;
+  response.content_type = "application/json";
+
+  auto name = request.GetQueryParameter("name");
+  if (name.empty())
+  {
+    auto summaries = data_aggregator_->GetSpanSummaries();
+    out.reserve(2 + summaries.size() * 128);
+    out.push_back('[');
+    bool is_first = true;
+    for (auto &name_summary : summaries)
+    {
+      out.append(is_first ? "{\"name\":" : ",{\"name\":");
+      is_first = false;
+      AppendJsonString(out, name_summary.first);
+      out.append(",\"running\":");
+      out.append(std::to_string(name_summary.second.running_span_count));
+      out.append(",\"latency\":[");
+      for (std::size_t boundary = 0; boundary < kLatencyBoundaryCount; ++boundary)
+      {
+        if (boundary > 0)
+        {
+          out.push_back(',');
+        }
+        out.append(std::to_string(name_summary.second.latency_span_count[boundary]));
+      }
+      out.append("],\"error\":");
+      out.append(std::to_string(name_summary.second.error_span_count));
+      out.push_back('}');
+    }
+    out.push_back(']');
+  }
+  else
+  {
+    auto data = data_aggregator_->GetSpanData(name);
+    out.append("{\"name\":");
+    AppendJsonString(out, name);
+    out.append(",\"running\":");
+    AppendSpansJson(out, data.sample_running_spans);
+    out.append(",\"latency\":[");
+    for (std::size_t boundary = 0; boundary < kLatencyBoundaryCount; ++boundary)
+    {
+      if (boundary > 0)
+      {
+        out.push_back(',');
+      }
+      AppendSpansJson(out, data.sample_latency_spans[boundary]);
+    }
+    out.append("],\"error\":");
+    AppendSpansJson(out, data.sample_error_spans);
+    out.push_back('}');
+  }
+}
+}  // namespace zpages
+}  // namespace ext
+OPENTELEMETRY_END_NAMESPACE
@@ -5,34 +5,79 @@ namespace ext {
 namespace zpages {
 
   void TracezSpanProcessor::OnStart(opentelemetry::sdk::trace::Recordable &span) noexcept {
-    std::lock_guard<std::mutex> lock(mtx_);
-    spans_.running.insert(static_cast<opentelemetry::sdk::trace::SpanData*>(&span));
+    auto span_raw = static_cast<opentelemetry::sdk::trace::SpanData*>(&span);
+    TracezSpanBuckets *buckets;
+    {
+      std::lock_guard<std::mutex> lock(mtx_);
+      buckets = GetOrCreateSpanBuckets(span_raw->GetName());
+      running_[span_raw] = buckets;
+    }
+    buckets->AddRunning(span_raw);
   }
 
   void TracezSpanProcessor::OnEnd(std::unique_ptr<opentelemetry::sdk::trace::Recordable> &&span) noexcept {
     if (span == nullptr) return;
     auto span_raw = static_cast<opentelemetry::sdk::trace::SpanData*>(span.get());
-    std::lock_guard<std::mutex> lock(mtx_);
-    auto span_it = spans_.running.find(span_raw);
-    if (span_it != spans_.running.end()) {
-      spans_.running.erase(span_it);
-      spans_.completed.push_back(
-          std::unique_ptr<opentelemetry::sdk::trace::SpanData>(
-              static_cast<opentelemetry::sdk::trace::SpanData*>(span.release())));
+    TracezSpanBuckets *start_buckets;
+    TracezSpanBuckets *end_buckets;
+    {
+      std::lock_guard<std::mutex> lock(mtx_);
+      auto span_it = running_.find(span_raw);
+      if (span_it == running_.end()) return;
+      start_buckets = span_it->second;
+      running_.erase(span_it);
+
+      // The span may have been renamed while running; it completes under its final name.
+      end_buckets = GetOrCreateSpanBuckets(span_raw->GetName());
     }
+    start_buckets->RemoveRunning(span_raw);
+    end_buckets->Add(std::unique_ptr<opentelemetry::sdk::trace::SpanData>(
+        static_cast<opentelemetry::sdk::trace::SpanData*>(span.release())));
   }
 
 
   TracezSpanProcessor::CollectedSpans TracezSpanProcessor::GetSpanSnapshot() noexcept {
     CollectedSpans snapshot;
-    std::lock_guard<std::mutex> lock(mtx_);
-    snapshot.running = spans_.running;
-    snapshot.completed = std::move(spans_.completed);
-    spans_.completed.clear();
+    {
+      std::lock_guard<std::mutex> lock(mtx_);
+      snapshot.running.reserve(running_.size());
+      for (auto &span_buckets : running_) snapshot.running.insert(span_buckets.first);
+    }
+    for (auto &name_buckets : GetSpanBuckets()) {
+      snapshot.completed[name_buckets.first] = name_buckets.second->GetSnapshot();
+    }
     return snapshot;
   }
 
 
+  std::vector<std::pair<std::string, const TracezSpanBuckets*>>
+  TracezSpanProcessor::GetSpanBuckets() const noexcept {
+    std::vector<std::pair<std::string, const TracezSpanBuckets*>> span_buckets;
+    std::lock_guard<std::mutex> lock(mtx_);
+    span_buckets.reserve(span_buckets_.size());
+    for (auto &name_buckets : span_buckets_) {
+      span_buckets.emplace_back(name_buckets.first, name_buckets.second.get());
+    }
+    return span_buckets;
+  }
+
+
+  const TracezSpanBuckets* TracezSpanProcessor::GetSpanBuckets(
+      const std::string &name) const noexcept {
+    std::lock_guard<std::mutex> lock(mtx_);
+    auto name_it = span_buckets_.find(name);
+    return name_it == span_buckets_.end() ? nullptr : name_it->second.get();
+  }
+
+
+  TracezSpanBuckets* TracezSpanProcessor::GetOrCreateSpanBuckets(
+      opentelemetry::nostd::string_view name) {
+    auto &buckets = span_buckets_[std::string(name)];
+    if (buckets == nullptr) buckets.reset(new TracezSpanBuckets(name));
+    return buckets.get();
+  }
+
+
 }  // namespace zpages
 }  // namespace ext
 OPENTELEMETRY_END_NAMESPACE
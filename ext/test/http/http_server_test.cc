@@ -0,0 +1,182 @@
+#include "opentelemetry/ext/http/server/http_server.h"
+
+#include <gtest/gtest.h>
+
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <sys/time.h>
+#include <unistd.h>
+
+#include <chrono>
+#include <cstring>
+#include <new>
+#include <string>
+
+using opentelemetry::ext::http::server::HttpRequest;
+using opentelemetry::ext::http::server::HttpResponse;
+using opentelemetry::ext::http::server::HttpServer;
+
+namespace
+{
+/*
+ * Sends a raw request to the server on localhost and returns everything it answers until it
+ * closes the connection.
+ */
+std::string SendRequest(uint16_t port, const std::string &request)
+{
+  int fd = socket(AF_INET, SOCK_STREAM, 0);
+  sockaddr_in address;
+  std::memset(&address, 0, sizeof(address));
+  address.sin_family      = AF_INET;
+  address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+  address.sin_port        = htons(port);
+  if (connect(fd, reinterpret_cast<sockaddr *>(&address), sizeof(address)) != 0)
+  {
+    close(fd);
+    return "";
+  }
+  send(fd, request.data(), request.size(), MSG_NOSIGNAL);
+
+  std::string response;
+  char buffer[4096];
+  ssize_t count;
+  while ((count = read(fd, buffer, sizeof(buffer))) > 0)
+  {
+    response.append(buffer, count);
+  }
+  close(fd);
+  return response;
+}
+
+std::string Get(uint16_t port, const std::string &target)
+{
+  return SendRequest(port, "GET " + target + " HTTP/1.1\r\nHost: localhost\r\n\r\n");
+}
+
+std::string GetBody(const std::string &response)
+{
+  auto body_start = response.find("\r\n\r\n");
+  return body_start == std::string::npos ? "" : response.substr(body_start + 4);
+}
+}  // namespace
+
+class HttpServerTest : public ::testing::Test
+{
+protected:
+  void SetUp() override
+  {
+    server.AddHandler("/echo", [](const HttpRequest &request, HttpResponse &response) {
+      response.body = request.GetQueryParameter("value");
+    });
+    server.AddHandler("/throw", [](const HttpRequest &, HttpResponse &response) {
+      response.body = "partial";
+      throw std::bad_alloc();
+    });
+    ASSERT_TRUE(server.Start());
+    ASSERT_NE(server.GetPort(), 0);
+  }
+
+  HttpServer server;
+};
+
+TEST_F(HttpServerTest, ServesHandler)
+{
+  auto response = Get(server.GetPort(), "/echo?value=hello");
+  EXPECT_EQ(response.find("HTTP/1.1 200 OK\r\n"), 0);
+  EXPECT_NE(response.find("Content-Length: 5\r\n"), std::string::npos);
+  EXPECT_EQ(GetBody(response), "hello");
+}
+
+TEST_F(HttpServerTest, DecodesQueryParameters)
+{
+  EXPECT_EQ(GetBody(Get(server.GetPort(), "/echo?other=1&value=a%20b+c%2F")), "a b c/");
+  EXPECT_EQ(GetBody(Get(server.GetPort(), "/echo?values=1")), "");
+  EXPECT_EQ(GetBody(Get(server.GetPort(), "/echo")), "");
+}
+
+TEST_F(HttpServerTest, UnknownPath)
+{
+  EXPECT_EQ(Get(server.GetPort(), "/unknown").find("HTTP/1.1 404 Not Found\r\n"), 0);
+}
+
+TEST_F(HttpServerTest, UnsupportedMethod)
+{
+  auto response = SendRequest(server.GetPort(), "POST /echo HTTP/1.1\r\n\r\n");
+  EXPECT_EQ(response.find("HTTP/1.1 405 Method Not Allowed\r\n"), 0);
+}
+
+TEST_F(HttpServerTest, MalformedRequest)
+{
+  auto response = SendRequest(server.GetPort(), "GARBAGE\r\n\r\n");
+  EXPECT_EQ(response.find("HTTP/1.1 400 Bad Request\r\n"), 0);
+}
+
+TEST_F(HttpServerTest, RequestTooLarge)
+{
+  std::string request = "GET /echo HTTP/1.1\r\nX-Padding: ";
+  request.append(HttpServer::kMaxRequestSize, 'x');
+  request.append("\r\n\r\n");
+  EXPECT_EQ(SendRequest(server.GetPort(), request).find("HTTP/1.1 431"), 0);
+}
+
+TEST_F(HttpServerTest, ManySequentialRequests)
+{
+  for (int i = 0; i < 100; i++)
+  {
+    EXPECT_EQ(GetBody(Get(server.GetPort(), "/echo?value=" + std::to_string(i))),
+              std::to_string(i));
+  }
+}
+
+#if __EXCEPTIONS
+TEST_F(HttpServerTest, HandlerThrows)
+{
+  auto response = Get(server.GetPort(), "/throw");
+  EXPECT_EQ(response.find("HTTP/1.1 500 Internal Server Error\r\n"), 0);
+  EXPECT_EQ(GetBody(response), "");
+
+  // The server keeps serving.
+  EXPECT_EQ(GetBody(Get(server.GetPort(), "/echo?value=x")), "x");
+}
+#endif
+
+TEST_F(HttpServerTest, StopAndRestart)
+{
+  server.Stop();
+  EXPECT_EQ(Get(server.GetPort(), "/echo?value=x"), "");
+  ASSERT_TRUE(server.Start());
+  EXPECT_EQ(GetBody(Get(server.GetPort(), "/echo?value=x")), "x");
+}
+
+TEST(HttpServer, ClosesConnectionsPastTimeout)
+{
+  HttpServer server;
+  server.AddHandler("/echo", [](const HttpRequest &request, HttpResponse &response) {
+    response.body = request.GetQueryParameter("value");
+  });
+  server.SetConnectionTimeout(std::chrono::milliseconds(100));
+  ASSERT_TRUE(server.Start());
+
+  // A connection whose request is never completed is closed once the timeout passes.
+  int fd = socket(AF_INET, SOCK_STREAM, 0);
+  timeval receive_timeout = {5, 0};
+  setsockopt(fd, SOL_SOCKET, SO_RCVTIMEO, &receive_timeout, sizeof(receive_timeout));
+  sockaddr_in address;
+  std::memset(&address, 0, sizeof(address));
+  address.sin_family      = AF_INET;
+  address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+  address.sin_port        = htons(server.GetPort());
+  ASSERT_EQ(connect(fd, reinterpret_cast<sockaddr *>(&address), sizeof(address)), 0);
+  std::string partial_request = "GET /echo?value=x HTTP/1.1\r\n";
+  send(fd, partial_request.data(), partial_request.size(), MSG_NOSIGNAL);
+
+  auto start = std::chrono::steady_clock::now();
+  char buffer[64];
+  EXPECT_EQ(read(fd, buffer, sizeof(buffer)), 0);
+  EXPECT_LT(std::chrono::steady_clock::now() - start, std::chrono::seconds(5));
+  close(fd);
+
+  // Requests completed in time are still served.
+  EXPECT_EQ(GetBody(Get(server.GetPort(), "/echo?value=x")), "x");
+}
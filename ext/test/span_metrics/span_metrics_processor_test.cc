@@ -0,0 +1,240 @@
+#include "opentelemetry/ext/span_metrics/span_metrics_processor.h"
+
+#include <gtest/gtest.h>
+
+#include <map>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "opentelemetry/sdk/trace/span_data.h"
+#include "opentelemetry/sdk/trace/tracer.h"
+
+using namespace opentelemetry::ext::span_metrics;
+using opentelemetry::sdk::metrics::AggregationTemporality;
+using opentelemetry::sdk::metrics::HistogramValue;
+using opentelemetry::sdk::metrics::Meter;
+using opentelemetry::sdk::metrics::MetricRecord;
+using opentelemetry::sdk::trace::Recordable;
+using opentelemetry::sdk::trace::SpanData;
+using opentelemetry::trace::CanonicalCode;
+using opentelemetry::trace::SpanKind;
+
+namespace nostd = opentelemetry::nostd;
+
+/*
+ * A processor that keeps every span it is passed, as span data.
+ */
+class CollectingSpanProcessor : public opentelemetry::sdk::trace::SpanProcessor
+{
+public:
+  std::unique_ptr<Recordable> MakeRecordable() noexcept override
+  {
+    return std::unique_ptr<Recordable>(new SpanData);
+  }
+
+  void OnStart(Recordable &) noexcept override { ++started; }
+
+  void OnEnd(std::unique_ptr<Recordable> &&span) noexcept override
+  {
+    ended.emplace_back(static_cast<SpanData *>(span.release()));
+  }
+
+  void ForceFlush(std::chrono::microseconds) noexcept override {}
+
+  void Shutdown(std::chrono::microseconds) noexcept override {}
+
+  int started = 0;
+  std::vector<std::unique_ptr<SpanData>> ended;
+};
+
+/*
+ * Starts and ends a span of the given kind and status that lasts exactly duration.
+ */
+void RunSpan(opentelemetry::trace::Tracer &tracer,
+             nostd::string_view name,
+             SpanKind kind,
+             CanonicalCode status,
+             std::chrono::milliseconds duration)
+{
+  opentelemetry::trace::StartSpanOptions start_options;
+  start_options.start_steady_time = opentelemetry::core::SteadyTimestamp(std::chrono::seconds(1));
+  start_options.kind              = kind;
+  auto span                       = tracer.StartSpan(name, start_options);
+  span->SetStatus(status, "");
+
+  opentelemetry::trace::EndSpanOptions end_options;
+  end_options.end_steady_time =
+      opentelemetry::core::SteadyTimestamp(std::chrono::seconds(1) + duration);
+  span->End(end_options);
+}
+
+/*
+ * Collects the meter and returns the records of a metric by "name:kind:status" labels.
+ */
+std::map<std::string, MetricRecord> Collect(Meter &meter, const std::string &metric_name)
+{
+  std::map<std::string, MetricRecord> records;
+  for (auto &record : meter.Collect(AggregationTemporality::Cumulative))
+  {
+    if (record.descriptor->name != metric_name)
+    {
+      continue;
+    }
+    std::map<std::string, std::string> labels(record.labels.GetLabels().begin(),
+                                              record.labels.GetLabels().end());
+    records[labels[kSpanNameLabelKey] + ":" + labels[kSpanKindLabelKey] + ":" +
+            labels[kStatusCodeLabelKey]] = record;
+  }
+  return records;
+}
+
+TEST(SpanMetricsProcessor, RecordsRateErrorsAndDuration)
+{
+  auto meter     = std::make_shared<Meter>(std::vector<double>{10, 100});
+  auto processor = std::make_shared<SpanMetricsProcessor>(meter);
+  auto tracer    = std::make_shared<opentelemetry::sdk::trace::Tracer>(processor);
+
+  RunSpan(*tracer, "GET /", SpanKind::kServer, CanonicalCode::OK, std::chrono::milliseconds(5));
+  RunSpan(*tracer, "GET /", SpanKind::kServer, CanonicalCode::OK, std::chrono::milliseconds(50));
+  RunSpan(*tracer, "GET /", SpanKind::kServer, CanonicalCode::UNAVAILABLE,
+          std::chrono::milliseconds(500));
+  RunSpan(*tracer, "query", SpanKind::kClient, CanonicalCode::OK, std::chrono::milliseconds(1));
+
+  auto calls = Collect(*meter, kSpanCallsMetricName);
+  ASSERT_EQ(calls.size(), 3);
+  EXPECT_EQ(nostd::get<int64_t>(calls["GET /:server:OK"].value), 2);
+  EXPECT_EQ(nostd::get<int64_t>(calls["GET /:server:UNAVAILABLE"].value), 1);
+  EXPECT_EQ(nostd::get<int64_t>(calls["query:client:OK"].value), 1);
+
+  auto durations = Collect(*meter, kSpanDurationMetricName);
+  ASSERT_EQ(durations.size(), 3);
+  auto &histogram = nostd::get<HistogramValue>(durations["GET /:server:OK"].value);
+  EXPECT_EQ(histogram.count, 2);
+  EXPECT_EQ(histogram.sum, 55);
+  EXPECT_EQ(histogram.counts, (std::vector<uint64_t>{1, 1, 0}));
+  EXPECT_EQ(nostd::get<HistogramValue>(durations["GET /:server:UNAVAILABLE"].value).counts,
+            (std::vector<uint64_t>{0, 0, 1}));
+}
+
+TEST(SpanMetricsProcessor, PassesOnSampledSpans)
+{
+  auto meter      = std::make_shared<Meter>();
+  auto downstream = std::make_shared<CollectingSpanProcessor>();
+  auto processor  = std::make_shared<SpanMetricsProcessor>(meter, downstream);
+  auto tracer     = std::make_shared<opentelemetry::sdk::trace::Tracer>(processor);
+
+  for (int i = 0; i < 7; ++i)
+  {
+    RunSpan(*tracer, "work", SpanKind::kConsumer, CanonicalCode::INTERNAL,
+            std::chrono::milliseconds(2));
+  }
+
+  // With the default interval, every span is passed on, with everything that was recorded
+  // about it.
+  EXPECT_EQ(downstream->started, 7);
+  ASSERT_EQ(downstream->ended.size(), 7);
+  for (auto &span : downstream->ended)
+  {
+    EXPECT_EQ(span->GetName(), "work");
+    EXPECT_EQ(span->GetSpanKind(), SpanKind::kConsumer);
+    EXPECT_EQ(span->GetStatus(), CanonicalCode::INTERNAL);
+    EXPECT_EQ(span->GetDuration(), std::chrono::milliseconds(2));
+  }
+
+  // Every span is counted.
+  EXPECT_EQ(nostd::get<int64_t>(
+                Collect(*meter, kSpanCallsMetricName)["work:consumer:INTERNAL"].value),
+            7);
+}
+
+/*
+ * Starts and ends a span of the given trace on processor, without a tracer, so that spans can
+ * share a trace id.
+ */
+void RunSpanOfTrace(SpanMetricsProcessor &processor, const opentelemetry::trace::TraceId &trace_id)
+{
+  opentelemetry::sdk::trace::SpanStartData data = {};
+  data.trace_id                                 = trace_id;
+  data.name                                     = "work";
+  data.span_kind                                = SpanKind::kInternal;
+
+  auto span = processor.MakeRecordable();
+  span->Init(data);
+  processor.OnStart(*span);
+  processor.OnEnd(std::move(span));
+}
+
+TEST(SpanMetricsProcessor, PassesOnWholeSampledTraces)
+{
+  auto meter      = std::make_shared<Meter>();
+  auto downstream = std::make_shared<CollectingSpanProcessor>();
+  SpanMetricsProcessor processor(meter, downstream, 3);
+
+  // The first 8 bytes of the trace ids, read as a little-endian integer, are compared against
+  // a third of 2^64: 1 is sampled, 2^63 is not.
+  uint8_t sampled_id[opentelemetry::trace::TraceId::kSize]     = {1};
+  uint8_t not_sampled_id[opentelemetry::trace::TraceId::kSize] = {0, 0, 0, 0, 0, 0, 0, 0x80};
+  opentelemetry::trace::TraceId sampled(sampled_id);
+  opentelemetry::trace::TraceId not_sampled(not_sampled_id);
+
+  for (int i = 0; i < 4; ++i)
+  {
+    RunSpanOfTrace(processor, sampled);
+    RunSpanOfTrace(processor, not_sampled);
+  }
+
+  // Every span of the sampled trace is passed on, and none of the other.
+  EXPECT_EQ(downstream->started, 4);
+  ASSERT_EQ(downstream->ended.size(), 4);
+  for (auto &span : downstream->ended)
+  {
+    EXPECT_EQ(span->GetTraceId(), sampled);
+  }
+
+  // Every span is counted.
+  EXPECT_EQ(nostd::get<int64_t>(
+                Collect(*meter, kSpanCallsMetricName)["work:internal:OK"].value),
+            8);
+}
+
+TEST(SpanMetricsProcessor, ConcurrentSpans)
+{
+  auto meter     = std::make_shared<Meter>();
+  auto processor = std::make_shared<SpanMetricsProcessor>(meter);
+  auto tracer    = std::make_shared<opentelemetry::sdk::trace::Tracer>(processor);
+
+  const int kThreads = 8;
+  const int kSpans   = 1000;
+  std::vector<std::thread> threads;
+  for (int i = 0; i < kThreads; ++i)
+  {
+    threads.emplace_back([&tracer] {
+      for (int j = 0; j < kSpans; ++j)
+      {
+        RunSpan(*tracer, "work", SpanKind::kInternal, CanonicalCode::OK,
+                std::chrono::milliseconds(1));
+      }
+    });
+  }
+  for (auto &thread : threads)
+  {
+    thread.join();
+  }
+
+  EXPECT_EQ(
+      nostd::get<int64_t>(Collect(*meter, kSpanCallsMetricName)["work:internal:OK"].value),
+      kThreads * kSpans);
+  EXPECT_EQ(nostd::get<HistogramValue>(
+                Collect(*meter, kSpanDurationMetricName)["work:internal:OK"].value)
+                .count,
+            kThreads * kSpans);
+}
+
+TEST(SpanMetricsProcessor, IgnoresNullSpan)
+{
+  auto meter = std::make_shared<Meter>();
+  SpanMetricsProcessor processor(meter);
+  processor.OnEnd(nullptr);
+  EXPECT_TRUE(Collect(*meter, kSpanCallsMetricName).empty());
+}
@@ -0,0 +1,167 @@
+#include "opentelemetry/ext/zpages/tracez_data_aggregator.h"
+
+#include <gtest/gtest.h>
+
+#include <string>
+#include <thread>
+
+#include "opentelemetry/sdk/trace/tracer.h"
+
+using namespace opentelemetry::sdk::trace;
+using namespace opentelemetry::ext::zpages;
+
+/*
+ * Reduce code duplication by having single area with shared setup code
+ */
+class TracezDataAggregatorTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    processor = std::shared_ptr<TracezSpanProcessor>(new TracezSpanProcessor());
+    tracer = std::shared_ptr<opentelemetry::trace::Tracer>(new Tracer(processor));
+    aggregator = std::unique_ptr<TracezDataAggregator>(new TracezDataAggregator(processor));
+  }
+
+  std::shared_ptr<TracezSpanProcessor> processor;
+  std::shared_ptr<opentelemetry::trace::Tracer> tracer;
+  std::unique_ptr<TracezDataAggregator> aggregator;
+};
+
+
+/*
+ * Test that no summaries are reported when no spans were started.
+ */
+TEST_F(TracezDataAggregatorTest, NoSpans) {
+  EXPECT_EQ(aggregator->GetSpanSummaries().size(), 0);
+
+  auto data = aggregator->GetSpanData("span");
+  EXPECT_EQ(data.running_span_count, 0);
+  EXPECT_EQ(data.sample_running_spans.size(), 0);
+}
+
+
+/*
+ * Test that running counts follow spans as they start and end, per span name.
+ */
+TEST_F(TracezDataAggregatorTest, RunningSpanCounts) {
+  auto span1 = tracer->StartSpan("span1");
+  auto span2 = tracer->StartSpan("span1");
+  auto span3 = tracer->StartSpan("span2");
+
+  auto summaries = aggregator->GetSpanSummaries();
+  ASSERT_EQ(summaries.size(), 2);
+  EXPECT_EQ(summaries["span1"].running_span_count, 2);
+  EXPECT_EQ(summaries["span2"].running_span_count, 1);
+
+  span1->End();
+  span3->SetStatus(opentelemetry::trace::CanonicalCode::UNKNOWN, "error");
+  span3->End();
+
+  summaries = aggregator->GetSpanSummaries();
+  EXPECT_EQ(summaries["span1"].running_span_count, 1);
+  EXPECT_EQ(summaries["span2"].running_span_count, 0);
+  EXPECT_EQ(summaries["span2"].error_span_count, 1);
+
+  uint64_t span1_completed = 0;
+  for (auto count : summaries["span1"].latency_span_count) span1_completed += count;
+  EXPECT_EQ(span1_completed, 1);
+}
+
+
+/*
+ * Test that inspecting a single name copies what is known of its running spans at their start
+ * only.
+ */
+TEST_F(TracezDataAggregatorTest, RunningSpansOfOneName) {
+  opentelemetry::trace::StartSpanOptions options;
+  options.start_system_time =
+      opentelemetry::core::SystemTimestamp(std::chrono::nanoseconds(1000));
+  auto span1 = tracer->StartSpan("span1", {{"attr", 1}}, options);
+  auto span2 = tracer->StartSpan("span2");
+  span1->SetAttribute("attr2", 2);
+
+  auto data = aggregator->GetSpanData("span1");
+  EXPECT_EQ(data.running_span_count, 1);
+  ASSERT_EQ(data.sample_running_spans.size(), 1);
+  EXPECT_EQ(data.sample_running_spans[0]->GetName(), "span1");
+  EXPECT_TRUE(data.sample_running_spans[0]->GetTraceId().IsValid());
+  EXPECT_TRUE(data.sample_running_spans[0]->GetSpanId().IsValid());
+  EXPECT_EQ(data.sample_running_spans[0]->GetStartTime().time_since_epoch(),
+            std::chrono::nanoseconds(1000));
+  EXPECT_EQ(data.sample_running_spans[0]->GetAttributes().size(), 0);
+
+  span1->End();
+
+  data = aggregator->GetSpanData("span1");
+  EXPECT_EQ(data.running_span_count, 0);
+  EXPECT_EQ(data.sample_running_spans.size(), 0);
+}
+
+
+/*
+ * Test that a span renamed while running leaves the running spans of its original name and
+ * completes under its new name.
+ */
+TEST_F(TracezDataAggregatorTest, RenamedSpan) {
+  auto span = tracer->StartSpan("old");
+  span->UpdateName("new");
+  span->End();
+
+  auto summaries = aggregator->GetSpanSummaries();
+  EXPECT_EQ(summaries["old"].running_span_count, 0);
+  EXPECT_EQ(summaries["new"].running_span_count, 0);
+
+  uint64_t new_completed = 0;
+  for (auto count : summaries["new"].latency_span_count) new_completed += count;
+  EXPECT_EQ(new_completed, 1);
+}
+
+
+/*
+ * Test for thread safety when summaries are read while spans start and end.
+ */
+TEST_F(TracezDataAggregatorTest, SummariesThreadSafety) {
+  std::thread spans([this]() {
+    for (int i = 0; i < 500; i++) tracer->StartSpan("span")->End();
+  });
+  std::thread summaries([this]() {
+    for (int i = 0; i < 500; i++) {
+      aggregator->GetSpanSummaries();
+      aggregator->GetSpanData("span");
+    }
+  });
+
+  spans.join();
+  summaries.join();
+
+  auto summary = aggregator->GetSpanSummaries()["span"];
+  uint64_t completed = 0;
+  for (auto count : summary.latency_span_count) completed += count;
+  EXPECT_EQ(summary.running_span_count, 0);
+  EXPECT_EQ(completed, 500);
+}
+
+
+/*
+ * Test for thread safety when running spans are inspected while they are changed.
+ */
+TEST_F(TracezDataAggregatorTest, RunningSpansThreadSafety) {
+  auto span = tracer->StartSpan("span");
+  std::thread changes([&span]() {
+    for (int i = 0; i < 500; i++) {
+      span->SetAttribute("attr" + std::to_string(i), i);
+      span->AddEvent("event", {{"attr", i}});
+      span->UpdateName(i % 2 == 0 ? "renamed span" : "span");
+    }
+  });
+  std::thread snapshots([this]() {
+    for (int i = 0; i < 500; i++) {
+      auto data = aggregator->GetSpanData("span");
+      ASSERT_EQ(data.sample_running_spans.size(), 1);
+      EXPECT_EQ(data.sample_running_spans[0]->GetName(), "span");
+    }
+  });
+
+  changes.join();
+  snapshots.join();
+  span->End();
+}
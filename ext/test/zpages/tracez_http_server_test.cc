@@ -0,0 +1,129 @@
+#include "opentelemetry/ext/zpages/tracez_http_server.h"
+
+#include <gtest/gtest.h>
+
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include <cstring>
+
+#include "opentelemetry/sdk/trace/tracer.h"
+
+using namespace opentelemetry::sdk::trace;
+using namespace opentelemetry::ext::zpages;
+
+//////////////////////////////////// TEST HELPER FUNCTIONS //////////////////////////////
+
+/*
+ * Sends a GET request to the server on localhost and returns the response body.
+ */
+std::string GetBody(uint16_t port, const std::string &target) {
+  int fd = socket(AF_INET, SOCK_STREAM, 0);
+  sockaddr_in address;
+  std::memset(&address, 0, sizeof(address));
+  address.sin_family = AF_INET;
+  address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+  address.sin_port = htons(port);
+  if (connect(fd, reinterpret_cast<sockaddr *>(&address), sizeof(address)) != 0) {
+    close(fd);
+    return "";
+  }
+  std::string request = "GET " + target + " HTTP/1.1\r\nHost: localhost\r\n\r\n";
+  send(fd, request.data(), request.size(), MSG_NOSIGNAL);
+
+  std::string response;
+  char buffer[4096];
+  ssize_t count;
+  while ((count = read(fd, buffer, sizeof(buffer))) > 0) response.append(buffer, count);
+  close(fd);
+
+  auto body_start = response.find("\r\n\r\n");
+  return body_start == std::string::npos ? "" : response.substr(body_start + 4);
+}
+
+
+//////////////////////////////// TEST FIXTURE //////////////////////////////////////
+
+class TracezHttpServerTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    processor = std::shared_ptr<TracezSpanProcessor>(new TracezSpanProcessor());
+    tracer = std::shared_ptr<opentelemetry::trace::Tracer>(new Tracer(processor));
+    server = std::unique_ptr<TracezHttpServer>(new TracezHttpServer(
+        std::unique_ptr<TracezDataAggregator>(new TracezDataAggregator(processor))));
+    ASSERT_TRUE(server->Start());
+  }
+
+  std::shared_ptr<TracezSpanProcessor> processor;
+  std::shared_ptr<opentelemetry::trace::Tracer> tracer;
+  std::unique_ptr<TracezHttpServer> server;
+};
+
+
+///////////////////////////////////////// TESTS ///////////////////////////////////
+
+/*
+ * Test that the JSON overview lists the counts of every span name.
+ */
+TEST_F(TracezHttpServerTest, JsonSummary) {
+  EXPECT_EQ(GetBody(server->GetPort(), "/tracez/api"), "[]");
+
+  auto running = tracer->StartSpan("running");
+  auto failed = tracer->StartSpan("fail\"ed");
+  failed->SetStatus(opentelemetry::trace::CanonicalCode::INTERNAL, "oops");
+  failed->End();
+
+  EXPECT_EQ(GetBody(server->GetPort(), "/tracez/api"),
+            "[{\"name\":\"fail\\\"ed\",\"running\":0,\"latency\":[0,0,0,0,0,0,0,0,0],\"error\":1},"
+            "{\"name\":\"running\",\"running\":1,\"latency\":[0,0,0,0,0,0,0,0,0],\"error\":0}]");
+}
+
+
+/*
+ * Test that the JSON samples of a single name contain its running and error spans.
+ */
+TEST_F(TracezHttpServerTest, JsonSpanData) {
+  auto running = tracer->StartSpan("span name");
+  auto failed = tracer->StartSpan("span name");
+  failed->SetStatus(opentelemetry::trace::CanonicalCode::INTERNAL, "oops");
+  failed->End();
+
+  auto body = GetBody(server->GetPort(), "/tracez/api?name=span%20name");
+  EXPECT_EQ(body.find("{\"name\":\"span name\",\"running\":[{\"name\":\"span name\""), 0);
+  EXPECT_NE(body.find("\"error\":[{\"name\":\"span name\""), std::string::npos);
+  EXPECT_NE(body.find("\"status\":13,\"description\":\"oops\"}]}"), std::string::npos);
+}
+
+
+/*
+ * Test that the HTML overview links to each span name and escapes names.
+ */
+TEST_F(TracezHttpServerTest, HtmlSummary) {
+  tracer->StartSpan("<b>&")->End();
+
+  auto body = GetBody(server->GetPort(), "/tracez");
+  EXPECT_NE(body.find("<h1>TraceZ Summary</h1>"), std::string::npos);
+  EXPECT_NE(body.find("<a href=\"/tracez?name=%3Cb%3E%26\">&lt;b&gt;&amp;</a>"),
+            std::string::npos);
+}
+
+
+/*
+ * Test that the HTML page of a single name lists its sample spans.
+ */
+TEST_F(TracezHttpServerTest, HtmlSpanData) {
+  tracer->StartSpan("span")->End();
+
+  auto body = GetBody(server->GetPort(), "/tracez?name=span");
+  EXPECT_NE(body.find("<h1>TraceZ: span</h1>"), std::string::npos);
+  EXPECT_NE(body.find("<h3>Running</h3>"), std::string::npos);
+  EXPECT_NE(body.find("<h3>Errors</h3>"), std::string::npos);
+  auto row = body.find("<tr><td>");
+  ASSERT_NE(row, std::string::npos);
+  // The row starts with the generated trace id of the span.
+  auto trace_id = body.substr(row + 8, 32);
+  EXPECT_EQ(trace_id.find_first_not_of("0123456789abcdef"), std::string::npos);
+  EXPECT_NE(trace_id, std::string(32, '0'));
+}
@@ -15,22 +15,45 @@ using namespace opentelemetry::ext::zpages;
 
 /*
  * Helper function uses the current processor to update spans contained in completed_spans
- * and running_spans. completed_spans contains all spans (cumulative), unless marked otherwise
+ * and running_spans. completed_spans contains the sample spans of all latency and error
+ * buckets, which the processor retains across snapshots.
  */
 void UpdateSpans(std::shared_ptr<TracezSpanProcessor>& processor,
     std::vector<std::unique_ptr<opentelemetry::sdk::trace::SpanData>>& completed,
-    std::unordered_set<opentelemetry::sdk::trace::SpanData*>& running,
-    bool store_only_new_completed = false) {
+    std::unordered_set<opentelemetry::sdk::trace::SpanData*>& running) {
   auto spans = processor->GetSpanSnapshot();
   running = spans.running;
-  if (store_only_new_completed) {
-    completed.clear();
-    completed = std::move(spans.completed);
-  } else {
-    std::move(spans.completed.begin(), spans.completed.end(),
-            std::inserter(completed, completed.end()));
+  completed.clear();
+  for (auto &name_data : spans.completed) {
+    for (auto &samples : name_data.second.sample_latency_spans) {
+      std::move(samples.begin(), samples.end(), std::inserter(completed, completed.end()));
+    }
+    std::move(name_data.second.sample_error_spans.begin(),
+              name_data.second.sample_error_spans.end(),
+              std::inserter(completed, completed.end()));
   }
-  spans.completed.clear();
+}
+
+
+/*
+ * Helper function that starts and ends a span with the given name, using steady
+ * timestamps so that the span lasts exactly the given duration.
+ */
+void RunSpan(std::shared_ptr<opentelemetry::trace::Tracer>& tracer, const std::string& name,
+    std::chrono::nanoseconds duration,
+    opentelemetry::trace::CanonicalCode status = opentelemetry::trace::CanonicalCode::OK,
+    int64_t index = 0) {
+  opentelemetry::trace::StartSpanOptions start_options;
+  start_options.start_steady_time =
+      opentelemetry::core::SteadyTimestamp(std::chrono::seconds(1));
+  auto span = tracer->StartSpan(name, start_options);
+  span->SetAttribute("index", index);
+  span->SetStatus(status, "");
+
+  opentelemetry::trace::EndSpanOptions end_options;
+  end_options.end_steady_time =
+      opentelemetry::core::SteadyTimestamp(std::chrono::seconds(1) + duration);
+  span->End(end_options);
 }
 
 
@@ -151,9 +174,7 @@ class TracezProcessor : public ::testing::Test {
   void SetUp() override {
     processor = std::shared_ptr<TracezSpanProcessor>(new TracezSpanProcessor());
     tracer = std::shared_ptr<opentelemetry::trace::Tracer>(new Tracer(processor));
-    auto spans = processor->GetSpanSnapshot();
-    running = spans.running;
-    completed = std::move(spans.completed);
+    UpdateSpans(processor, completed, running);
 
     span_names = {"s0", "s2", "s1", "s1", "s"};
 
@@ -331,123 +352,99 @@ TEST_F(TracezProcessor, MultipleSpansOuterSplitCumulative) {
 
 
 /*
- * Test if a single span moves from running to completed at expected times.
- * Ensure correct behavior even when spans are discarded. Only new completed
- * spans are stored.
-*/
-TEST_F(TracezProcessor, OneSpanNewOnly) {
-  auto span = tracer->StartSpan(span_names[0]);
-  UpdateSpans(processor, completed, running, true);
-
-  EXPECT_TRUE(ContainsNames(span_names, running, 0, 1, true));
-  EXPECT_EQ(running.size(), 1);
-  EXPECT_EQ(completed.size(), 0);
-
-  span->End();
-  UpdateSpans(processor, completed, running, true);
-
-  EXPECT_TRUE(ContainsNames(span_names, completed, 0, 1, true));
-  EXPECT_EQ(running.size(), 0);
-  EXPECT_EQ(completed.size(), 1);
-
-  UpdateSpans(processor, completed, running, true);
-
-  EXPECT_EQ(running.size(), 0);
-  EXPECT_EQ(completed.size(), 0);
+ * Test that latency boundaries map durations onto the expected buckets, including
+ * the inclusive lower bounds and the open-ended last bucket.
+ */
+TEST(TracezLatencyBoundaries, FindLatencyBoundary) {
+  EXPECT_EQ(FindLatencyBoundary(std::chrono::nanoseconds(0)), k0MicroTo10Micro);
+  EXPECT_EQ(FindLatencyBoundary(std::chrono::microseconds(9)), k0MicroTo10Micro);
+  EXPECT_EQ(FindLatencyBoundary(std::chrono::microseconds(10)), k10MicroTo100Micro);
+  EXPECT_EQ(FindLatencyBoundary(std::chrono::milliseconds(5)), k1MilliTo10Milli);
+  EXPECT_EQ(FindLatencyBoundary(std::chrono::seconds(1)), k1SecondTo10Second);
+  EXPECT_EQ(FindLatencyBoundary(std::chrono::seconds(99)), k10SecondTo100Second);
+  EXPECT_EQ(FindLatencyBoundary(std::chrono::hours(1)), k100SecondToMax);
+  EXPECT_EQ(FindLatencyBoundary(std::chrono::nanoseconds(-1)), k0MicroTo10Micro);
 }
 
 
 /*
- * Test if multiple spans move from running to completed at expected times,
- * running/completed spans are split. Middle spans end first. Ensure correct
- * behavior even when multiple spans are discarded, even when span starting and
- * ending is non-sequential. Only new completed spans are stored.
+ * Test that a completed span is counted in the latency bucket matching its duration
+ * and kept as a sample of that bucket only.
  */
-TEST_F(TracezProcessor, MultipleSpansMiddleSplitNewOnly) {
-  for (const auto &name : span_names) span_vars.push_back(tracer->StartSpan(name));
-  UpdateSpans(processor, completed, running);
-
-  EXPECT_TRUE(ContainsNames(span_names, running, 0, 5, true)); // s0 s2 s1 s1 s
-  EXPECT_EQ(running.size(), span_names.size());
-  EXPECT_EQ(completed.size(), 0);
-
-  // End 4th span
-  span_vars[3]->End();
-  UpdateSpans(processor, completed, running, true);
-
-  EXPECT_TRUE(ContainsNames(span_names, running, 0, 3)); // s0 s2 s1
-  EXPECT_TRUE(ContainsNames(span_names, running, 4)); // + s
-  EXPECT_TRUE(ContainsNames(span_names, completed, 3, 4, true)); // s1
-  EXPECT_EQ(running.size(), 4);
-  EXPECT_EQ(completed.size(), 1);
-
-  // End 2nd and 3rd span
-  span_vars[1]->End();
-  span_vars[2]->End();
-  UpdateSpans(processor, completed, running, true);
-
-  EXPECT_TRUE(ContainsNames(span_names, running, 0, 1)); // s0
-  EXPECT_TRUE(ContainsNames(span_names, running, 4)); // + s
-  EXPECT_TRUE(ContainsNames(span_names, completed, 1, 3, true)); // s2 s1
-  EXPECT_EQ(running.size(), 2);
-  EXPECT_EQ(completed.size(), 2);
-
-  // End remaining Spans
-  span_vars[0]->End();
-  span_vars[4]->End();
-  UpdateSpans(processor, completed, running, true);
-
-  EXPECT_TRUE(ContainsNames(span_names, completed, 0, 1)); // s0
-  EXPECT_TRUE(ContainsNames(span_names, completed, 4)); // s
-  EXPECT_EQ(running.size(), 0);
-  EXPECT_EQ(completed.size(), 2);
+TEST_F(TracezProcessor, OneSpanLatencyBucket) {
+  RunSpan(tracer, span_names[0], std::chrono::milliseconds(5));
 
-  UpdateSpans(processor, completed, running, true);
+  auto spans = processor->GetSpanSnapshot();
+  ASSERT_EQ(spans.completed.size(), 1);
+  auto &data = spans.completed[span_names[0]];
 
-  EXPECT_EQ(running.size(), 0);
-  EXPECT_EQ(completed.size(), 0);
+  for (std::size_t boundary = 0; boundary < kLatencyBoundaryCount; boundary++) {
+    auto expected = boundary == k1MilliTo10Milli ? 1u : 0u;
+    EXPECT_EQ(data.latency_span_count[boundary], expected);
+    EXPECT_EQ(data.sample_latency_spans[boundary].size(), expected);
+  }
+  EXPECT_EQ(data.error_span_count, 0);
+  EXPECT_EQ(data.sample_error_spans.size(), 0);
+  EXPECT_EQ(data.sample_latency_spans[k1MilliTo10Milli][0]->GetName(), span_names[0]);
 }
 
 
 /*
- * Test if multiple spans move from running to completed at expected times,
- * running/completed spans are split. Ensure correct behavior even when
- * multiple spans are discarded, even when span starting and ending is
- * non-sequential. Only new completed spans are stored.
-*/
-TEST_F(TracezProcessor, MultipleSpansOuterSplitNewOnly) {
-  for (const auto &name : span_names) span_vars.push_back(tracer->StartSpan(name));
-
-  // End last span
-  span_vars[4]->End();
-  UpdateSpans(processor, completed, running, true);
-
-  EXPECT_TRUE(ContainsNames(span_names, running, 0, 4, true)); // s0 s2 s1 s1
-  EXPECT_TRUE(ContainsNames(span_names, completed, 4, 5, true)); // s
-  EXPECT_EQ(running.size(), 4);
-  EXPECT_EQ(completed.size(), 1);
-
-  // End first span
-  span_vars[0]->End();
-  UpdateSpans(processor, completed, running, true);
-
-  EXPECT_TRUE(ContainsNames(span_names, running, 1, 4, true)); // s2 s1 s1
-  EXPECT_TRUE(ContainsNames(span_names, completed, 0, 1, true)); // s0
-  EXPECT_EQ(running.size(), 3);
-  EXPECT_EQ(completed.size(), 1);
+ * Test that spans with an error status go to the error bucket rather than a
+ * latency bucket, and that spans are grouped by name.
+ */
+TEST_F(TracezProcessor, ErrorSpansBucketedByName) {
+  RunSpan(tracer, span_names[0], std::chrono::microseconds(1),
+          opentelemetry::trace::CanonicalCode::CANCELLED);
+  RunSpan(tracer, span_names[1], std::chrono::microseconds(1));
 
-  // End remaining middle spans
-  for (int i = 1; i < 4; i++) span_vars[i]->End();
-  UpdateSpans(processor, completed, running, true);
+  auto spans = processor->GetSpanSnapshot();
+  ASSERT_EQ(spans.completed.size(), 2);
+
+  auto &error_data = spans.completed[span_names[0]];
+  EXPECT_EQ(error_data.error_span_count, 1);
+  ASSERT_EQ(error_data.sample_error_spans.size(), 1);
+  EXPECT_EQ(error_data.sample_error_spans[0]->GetStatus(),
+            opentelemetry::trace::CanonicalCode::CANCELLED);
+  for (auto count : error_data.latency_span_count) EXPECT_EQ(count, 0);
+
+  auto &ok_data = spans.completed[span_names[1]];
+  EXPECT_EQ(ok_data.error_span_count, 0);
+  EXPECT_EQ(ok_data.latency_span_count[k0MicroTo10Micro], 1);
+}
 
-  EXPECT_TRUE(ContainsNames(span_names, completed, 1, 4, true)); // s2 s1 s1
-  EXPECT_EQ(running.size(), 0);
-  EXPECT_EQ(completed.size(), 3);
 
-  UpdateSpans(processor, completed, running, true);
+/*
+ * Test that counts keep growing while the number of retained samples per bucket is
+ * bounded, and that the most recent spans are the ones kept.
+ */
+TEST_F(TracezProcessor, SampleSpansBounded) {
+  const int num_spans = 100;
+  for (int i = 0; i < num_spans; i++) {
+    RunSpan(tracer, span_names[0], std::chrono::milliseconds(50),
+            opentelemetry::trace::CanonicalCode::OK, i);
+    RunSpan(tracer, span_names[0], std::chrono::milliseconds(50),
+            opentelemetry::trace::CanonicalCode::INTERNAL, i);
+  }
 
-  EXPECT_EQ(running.size(), 0);
-  EXPECT_EQ(completed.size(), 0);
+  for (int snapshot = 0; snapshot < 2; snapshot++) {
+    auto spans = processor->GetSpanSnapshot();
+    auto &data = spans.completed[span_names[0]];
+    EXPECT_EQ(data.latency_span_count[k10MilliTo100Milli], num_spans);
+    EXPECT_EQ(data.error_span_count, num_spans);
+
+    auto &samples = data.sample_latency_spans[k10MilliTo100Milli];
+    ASSERT_EQ(samples.size(), kMaxNumberOfSampleSpans);
+    ASSERT_EQ(data.sample_error_spans.size(), kMaxNumberOfSampleSpans);
+    for (std::size_t i = 0; i < kMaxNumberOfSampleSpans; i++) {
+      int64_t expected = num_spans - kMaxNumberOfSampleSpans + i;
+      EXPECT_EQ(opentelemetry::nostd::get<int64_t>(samples[i]->GetAttributes().at("index")),
+                expected);
+      EXPECT_EQ(opentelemetry::nostd::get<int64_t>(
+                    data.sample_error_spans[i]->GetAttributes().at("index")),
+                expected);
+    }
+  }
 }
 
 
@@ -0,0 +1,300 @@
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+#include "opentelemetry/version.h"
+
+OPENTELEMETRY_BEGIN_NAMESPACE
+namespace sdk
+{
+namespace metrics
+{
+/**
+ * The configuration of a DDSketch.
+ */
+struct DDSketchOptions
+{
+  // Not an aggregate, so a braced list of boundaries never converts to options.
+  DDSketchOptions() noexcept {}
+
+  // Every quantile estimate is within this relative error of a value of the sketched data.
+  double relative_accuracy = 0.01;
+
+  // The maximum number of bins kept for each of the positive and the negative values. Once
+  // reached, the bins of the values closest to zero are collapsed, so the relative accuracy
+  // guarantee is kept for the higher quantiles.
+  std::size_t max_bin_count = 2048;
+};
+
+/**
+ * A quantile sketch with bounded relative error, as described in "DDSketch: A Fast and
+ * Fully-Mergeable Quantile Sketch with Relative-Error Guarantees" (Masson et al., 2019).
+ *
+ * Values are counted in logarithmically sized bins, so the number of bins grows with the
+ * logarithm of the range of the values rather than with their number, and is capped by
+ * max_bin_count. Sketches with the same relative accuracy can be merged without loss, e.g. to
+ * combine the sketches of several threads or collection intervals.
+ *
+ * This class is thread-compatible.
+ */
+class DDSketch
+{
+public:
+  explicit DDSketch(const DDSketchOptions &options = DDSketchOptions()) noexcept
+      : relative_accuracy_{options.relative_accuracy},
+        gamma_{(1 + options.relative_accuracy) / (1 - options.relative_accuracy)},
+        multiplier_{1 / std::log(gamma_)},
+        min_indexable_value_{std::numeric_limits<double>::min() * gamma_},
+        positive_bins_{options.max_bin_count},
+        negative_bins_{options.max_bin_count}
+  {}
+
+  /**
+   * Add a value to the sketch. NaN and infinite values are ignored, as they have no bin.
+   */
+  void Add(double value) noexcept
+  {
+    if (!std::isfinite(value))
+    {
+      return;
+    }
+    if (value > min_indexable_value_)
+    {
+      positive_bins_.Add(GetIndex(value), 1);
+    }
+    else if (value < -min_indexable_value_)
+    {
+      negative_bins_.Add(GetIndex(-value), 1);
+    }
+    else
+    {
+      ++zero_count_;
+    }
+    ++count_;
+    sum_ += value;
+    min_ = std::min(min_, value);
+    max_ = std::max(max_, value);
+  }
+
+  /**
+   * Add the values of another sketch to this one.
+   * @param other a sketch with the same relative accuracy
+   * @return whether the sketches could be merged
+   */
+  bool Merge(const DDSketch &other) noexcept
+  {
+    if (other.gamma_ != gamma_)
+    {
+      return false;
+    }
+    positive_bins_.Merge(other.positive_bins_);
+    negative_bins_.Merge(other.negative_bins_);
+    zero_count_ += other.zero_count_;
+    count_ += other.count_;
+    sum_ += other.sum_;
+    min_ = std::min(min_, other.min_);
+    max_ = std::max(max_, other.max_);
+    return true;
+  }
+
+  /**
+   * @param quantile the quantile to estimate, between 0 and 1
+   * @return an estimate of the quantile, or NaN if the sketch is empty
+   */
+  double GetQuantile(double quantile) const noexcept
+  {
+    if (count_ == 0 || quantile < 0 || quantile > 1)
+    {
+      return std::numeric_limits<double>::quiet_NaN();
+    }
+    // The extremes are tracked exactly.
+    if (quantile == 0)
+    {
+      return min_;
+    }
+    if (quantile == 1)
+    {
+      return max_;
+    }
+    // The rank of the value to return, counted from zero.
+    double rank = quantile * static_cast<double>(count_ - 1);
+    double estimate;
+    uint64_t negative_count = negative_bins_.GetCount();
+    if (rank < negative_count)
+    {
+      // The negative bins are ordered by magnitude, so they are counted from the highest one.
+      estimate = -GetValue(negative_bins_.GetIndexAtRank(negative_count - 1 - rank));
+    }
+    else if (rank < negative_count + zero_count_)
+    {
+      estimate = 0;
+    }
+    else
+    {
+      estimate = GetValue(positive_bins_.GetIndexAtRank(rank - negative_count - zero_count_));
+    }
+    return std::max(min_, std::min(max_, estimate));
+  }
+
+  double GetRelativeAccuracy() const noexcept { return relative_accuracy_; }
+
+  uint64_t GetCount() const noexcept { return count_; }
+
+  double GetSum() const noexcept { return sum_; }
+
+  /**
+   * @return the smallest value added, or +infinity if the sketch is empty
+   */
+  double GetMin() const noexcept { return min_; }
+
+  /**
+   * @return the largest value added, or -infinity if the sketch is empty
+   */
+  double GetMax() const noexcept { return max_; }
+
+  /**
+   * @return the number of bins currently used, excluding the zero bin
+   */
+  std::size_t GetBinCount() const noexcept
+  {
+    return positive_bins_.GetBinCount() + negative_bins_.GetBinCount();
+  }
+
+private:
+  /**
+   * Bin counts for a contiguous range of bin indexes. When the range would exceed the maximum
+   * number of bins, the lowest bins are collapsed into the lowest bin that is kept.
+   */
+  class Bins
+  {
+  public:
+    explicit Bins(std::size_t max_bin_count) noexcept
+        : max_bin_count_{std::max<std::size_t>(max_bin_count, 1)}
+    {}
+
+    void Add(int32_t index, uint64_t count) noexcept
+    {
+      Extend(index, index);
+      bins_[std::max(index, offset_) - offset_] += count;
+      count_ += count;
+    }
+
+    void Merge(const Bins &other) noexcept
+    {
+      if (other.bins_.empty())
+      {
+        return;
+      }
+      Extend(other.offset_, other.offset_ + static_cast<int32_t>(other.bins_.size()) - 1);
+      for (std::size_t i = 0; i < other.bins_.size(); ++i)
+      {
+        int32_t index = std::max(other.offset_ + static_cast<int32_t>(i), offset_);
+        bins_[index - offset_] += other.bins_[i];
+      }
+      count_ += other.count_;
+    }
+
+    /**
+     * @return the index of the bin holding the value of the given rank, counted from zero
+     */
+    int32_t GetIndexAtRank(double rank) const noexcept
+    {
+      uint64_t cumulative = 0;
+      for (std::size_t i = 0; i < bins_.size(); ++i)
+      {
+        cumulative += bins_[i];
+        if (static_cast<double>(cumulative) > rank)
+        {
+          return offset_ + static_cast<int32_t>(i);
+        }
+      }
+      return offset_ + static_cast<int32_t>(bins_.size()) - 1;
+    }
+
+    uint64_t GetCount() const noexcept { return count_; }
+
+    std::size_t GetBinCount() const noexcept { return bins_.size(); }
+
+  private:
+    /**
+     * Make the bins cover [low, high] as well as the current range, collapsing the lowest bins
+     * if that range is too large.
+     */
+    void Extend(int32_t low, int32_t high) noexcept
+    {
+      if (bins_.empty())
+      {
+        offset_ = low;
+        bins_.assign(1, 0);
+      }
+      int32_t current_high = offset_ + static_cast<int32_t>(bins_.size()) - 1;
+      int64_t new_low      = std::min(low, offset_);
+      int64_t new_high     = std::max(high, current_high);
+      if (new_high - new_low + 1 > static_cast<int64_t>(max_bin_count_))
+      {
+        new_low = new_high - static_cast<int64_t>(max_bin_count_) + 1;
+      }
+      if (new_low == offset_ && new_high == current_high)
+      {
+        return;
+      }
+
+      std::vector<uint64_t> bins(static_cast<std::size_t>(new_high - new_low + 1));
+      for (std::size_t i = 0; i < bins_.size(); ++i)
+      {
+        int64_t index = std::max<int64_t>(offset_ + static_cast<int64_t>(i), new_low);
+        bins[static_cast<std::size_t>(index - new_low)] += bins_[i];
+      }
+      bins_.swap(bins);
+      offset_ = static_cast<int32_t>(new_low);
+    }
+
+    std::size_t max_bin_count_;
+    std::vector<uint64_t> bins_;
+    int32_t offset_ = 0;
+    uint64_t count_ = 0;
+  };
+
+  int32_t GetIndex(double value) const noexcept
+  {
+    // The index of the largest or smallest values overflows with a tiny relative accuracy, in
+    // which case they are kept in the outermost bins.
+    double index = std::ceil(std::log(value) * multiplier_);
+    if (index >= static_cast<double>(std::numeric_limits<int32_t>::max()))
+    {
+      return std::numeric_limits<int32_t>::max();
+    }
+    if (index <= static_cast<double>(std::numeric_limits<int32_t>::min()))
+    {
+      return std::numeric_limits<int32_t>::min();
+    }
+    return static_cast<int32_t>(index);
+  }
+
+  /**
+   * @return the value within the relative accuracy of every value of the bin
+   */
+  double GetValue(int32_t index) const noexcept
+  {
+    return 2 * std::pow(gamma_, index) / (gamma_ + 1);
+  }
+
+  double relative_accuracy_;
+  double gamma_;
+  double multiplier_;
+  double min_indexable_value_;
+  Bins positive_bins_;
+  Bins negative_bins_;
+  uint64_t zero_count_ = 0;
+  uint64_t count_      = 0;
+  double sum_          = 0;
+  double min_          = std::numeric_limits<double>::infinity();
+  double max_          = -std::numeric_limits<double>::infinity();
+};
+}  // namespace metrics
+}  // namespace sdk
+OPENTELEMETRY_END_NAMESPACE
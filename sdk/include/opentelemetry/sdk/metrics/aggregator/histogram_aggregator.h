@@ -0,0 +1,174 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "opentelemetry/sdk/metrics/aggregator/striped.h"
+#include "opentelemetry/sdk/metrics/aggregator/sum_aggregator.h"
+#include "opentelemetry/sdk/metrics/record.h"
+#include "opentelemetry/version.h"
+
+OPENTELEMETRY_BEGIN_NAMESPACE
+namespace sdk
+{
+namespace metrics
+{
+/**
+ * Find the histogram bucket of a value without data-dependent branches: the search always runs
+ * the same number of iterations for a given number of boundaries, and the comparison in each
+ * iteration compiles to a conditional move.
+ * @param boundaries the sorted bucket boundaries
+ * @param size the number of boundaries
+ * @param value the value to look up
+ * @return the number of boundaries less than value. Bucket i holds the values in
+ * (boundaries[i - 1], boundaries[i]].
+ */
+inline std::size_t FindHistogramBucket(const double *boundaries,
+                                       std::size_t size,
+                                       double value) noexcept
+{
+  if (size == 0)
+  {
+    return 0;
+  }
+  const double *base = boundaries;
+  while (size > 1)
+  {
+    std::size_t half = size / 2;
+    base             = base[half - 1] < value ? base + half : base;
+    size -= half;
+  }
+  return static_cast<std::size_t>(base - boundaries) + (*base < value);
+}
+
+/**
+ * Aggregates values into a histogram with explicit bucket boundaries.
+ *
+ * Every stripe has its own row of bucket counts, padded to whole cache lines. Update finds the
+ * bucket with FindHistogramBucket and increments it in the row of the calling thread with a
+ * relaxed atomic add. A checkpoint swaps every count with zero and adds up the rows, so updates
+ * are never blocked by collection. The sum of the values is kept in a striped SumAggregator.
+ *
+ * A histogram takes a row per stripe, of 8 bytes per bucket rounded up to a cache line, besides
+ * its sum: with the 11 buckets of the default boundaries, up to kMaxAggregatorStripeCount *
+ * (128 + 64) = 1.5 KB.
+ *
+ * Update is thread-safe. Checkpoint must not be called concurrently with itself.
+ *
+ * @tparam T the type of the values aggregated, either int64_t or double
+ */
+template <class T>
+class HistogramAggregator
+{
+public:
+  // The type of the values taken by Checkpoint.
+  using Value = HistogramValue;
+
+  /**
+   * @param boundaries the sorted bucket boundaries, shared by the aggregators of an instrument
+   */
+  explicit HistogramAggregator(std::shared_ptr<const std::vector<double>> boundaries)
+      : boundaries_{std::move(boundaries)},
+        bucket_count_{boundaries_->size() + 1},
+        row_size_{(bucket_count_ + kCountsPerCacheLine - 1) / kCountsPerCacheLine *
+                  kCountsPerCacheLine},
+        counts_{new std::atomic<uint64_t>[GetAggregatorStripeCount() * row_size_]()}
+  {}
+
+  /**
+   * Prepare bucket boundaries to be shared by aggregators: NaN boundaries are dropped and the
+   * others are sorted and deduplicated.
+   */
+  static std::shared_ptr<const std::vector<double>> MakeBoundaries(std::vector<double> boundaries)
+  {
+    boundaries.erase(std::remove_if(boundaries.begin(), boundaries.end(),
+                                    [](double boundary) { return boundary != boundary; }),
+                     boundaries.end());
+    std::sort(boundaries.begin(), boundaries.end());
+    boundaries.erase(std::unique(boundaries.begin(), boundaries.end()), boundaries.end());
+    return std::make_shared<const std::vector<double>>(std::move(boundaries));
+  }
+
+  /**
+   * Record a value. NaN values are ignored.
+   */
+  void Update(T value) noexcept
+  {
+    double double_value = static_cast<double>(value);
+    if (double_value != double_value)
+    {
+      return;
+    }
+    auto bucket = FindHistogramBucket(boundaries_->data(), bucket_count_ - 1, double_value);
+    AtomicAdd(counts_[GetThreadAggregatorStripe() * row_size_ + bucket], uint64_t{1});
+    sum_.Update(value);
+  }
+
+  /**
+   * Take the values recorded since the previous checkpoint. A value recorded concurrently with
+   * a checkpoint may have its count and its sum taken by consecutive checkpoints.
+   * @param temporality whether histogram is set to the values recorded since the previous
+   * checkpoint or since the aggregator was created
+   * @param histogram set to the histogram
+   * @return whether any value was recorded since the previous checkpoint
+   */
+  bool Checkpoint(AggregationTemporality temporality, HistogramValue &histogram)
+  {
+    histogram.boundaries = boundaries_;
+    histogram.counts.assign(bucket_count_, 0);
+    for (std::size_t stripe = 0; stripe < GetAggregatorStripeCount(); ++stripe)
+    {
+      for (std::size_t bucket = 0; bucket < bucket_count_; ++bucket)
+      {
+        histogram.counts[bucket] +=
+            counts_[stripe * row_size_ + bucket].exchange(0, std::memory_order_relaxed);
+      }
+    }
+    uint64_t delta_count = 0;
+    for (auto count : histogram.counts)
+    {
+      delta_count += count;
+    }
+    T sum;
+    sum_.Checkpoint(temporality, sum);
+    histogram.sum = static_cast<double>(sum);
+
+    if (temporality == AggregationTemporality::Cumulative)
+    {
+      // The cumulative counts are only kept by aggregators collected cumulatively.
+      cumulative_counts_.resize(bucket_count_);
+      for (std::size_t bucket = 0; bucket < bucket_count_; ++bucket)
+      {
+        cumulative_counts_[bucket] += histogram.counts[bucket];
+      }
+      histogram.counts = cumulative_counts_;
+      cumulative_count_ += delta_count;
+      histogram.count = cumulative_count_;
+    }
+    else
+    {
+      histogram.count = delta_count;
+    }
+    return delta_count != 0;
+  }
+
+private:
+  static const std::size_t kCountsPerCacheLine = kCacheLineSize / sizeof(std::atomic<uint64_t>);
+
+  const std::shared_ptr<const std::vector<double>> boundaries_;
+  const std::size_t bucket_count_;
+  const std::size_t row_size_;
+  std::unique_ptr<std::atomic<uint64_t>[]> counts_;
+  SumAggregator<T> sum_;
+  std::vector<uint64_t> cumulative_counts_;
+  uint64_t cumulative_count_ = 0;
+};
+
+template <class T>
+const std::size_t HistogramAggregator<T>::kCountsPerCacheLine;
+}  // namespace metrics
+}  // namespace sdk
+OPENTELEMETRY_END_NAMESPACE
@@ -0,0 +1,73 @@
+#pragma once
+
+#include "opentelemetry/sdk/metrics/record.h"
+#include "opentelemetry/version.h"
+
+OPENTELEMETRY_BEGIN_NAMESPACE
+namespace sdk
+{
+namespace metrics
+{
+/**
+ * Keeps the last value observed by an asynchronous instrument in the current collection.
+ *
+ * Observations are only made from the thread collecting the instrument, so no atomics are
+ * needed.
+ *
+ * This class is thread-compatible.
+ *
+ * @tparam T the type of the values observed, either int64_t or double
+ */
+template <class T>
+class LastValueAggregator
+{
+public:
+  /**
+   * Observe a value, replacing any value observed earlier in the same collection.
+   */
+  void Update(T value) noexcept
+  {
+    value_       = value;
+    is_observed_ = true;
+  }
+
+  /**
+   * Take the value of a gauge observed in the current collection.
+   * @param value set to the last observed value
+   * @return whether a value was observed since the previous checkpoint
+   */
+  bool Checkpoint(T &value) noexcept
+  {
+    value = value_;
+    return TakeObserved();
+  }
+
+  /**
+   * Take the value of a sum observed in the current collection.
+   * @param temporality whether value is set to the difference to the previously checkpointed
+   * sum or to the observed sum itself
+   * @param value set to the sum
+   * @return whether a value was observed since the previous checkpoint
+   */
+  bool CheckpointSum(AggregationTemporality temporality, T &value) noexcept
+  {
+    value = temporality == AggregationTemporality::Delta ? value_ - checkpointed_value_ : value_;
+    checkpointed_value_ = value_;
+    return TakeObserved();
+  }
+
+private:
+  bool TakeObserved() noexcept
+  {
+    bool is_observed = is_observed_;
+    is_observed_     = false;
+    return is_observed;
+  }
+
+  T value_              = 0;
+  T checkpointed_value_ = 0;
+  bool is_observed_     = false;
+};
+}  // namespace metrics
+}  // namespace sdk
+OPENTELEMETRY_END_NAMESPACE
@@ -0,0 +1,108 @@
+#pragma once
+
+#include <memory>
+#include <mutex>
+#include <utility>
+
+#include "opentelemetry/sdk/metrics/aggregator/ddsketch.h"
+#include "opentelemetry/sdk/metrics/aggregator/striped.h"
+#include "opentelemetry/sdk/metrics/record.h"
+#include "opentelemetry/version.h"
+
+OPENTELEMETRY_BEGIN_NAMESPACE
+namespace sdk
+{
+namespace metrics
+{
+/**
+ * Aggregates values into a DDSketch, for quantiles with bounded relative error over any range
+ * of values.
+ *
+ * Every stripe has its own sketch and lock. A thread only takes the lock of its own stripe,
+ * which is uncontended except while a checkpoint swaps the sketch of the stripe with an empty
+ * one. The sketches taken are merged once all the locks are released.
+ *
+ * A sketch aggregator takes a lock and a sketch per stripe, up to kMaxAggregatorStripeCount,
+ * besides its cumulative sketch. Every sketch takes 8 bytes per bin it uses, up to
+ * DDSketchOptions::max_bin_count for each sign.
+ *
+ * Update is thread-safe. Checkpoint must not be called concurrently with itself.
+ *
+ * @tparam T the type of the values aggregated, either int64_t or double
+ */
+template <class T>
+class SketchAggregator
+{
+public:
+  // The type of the values taken by Checkpoint.
+  using Value = DDSketch;
+
+  explicit SketchAggregator(const DDSketchOptions &options)
+      : options_(options), stripes_{new Stripe[GetAggregatorStripeCount()]}, cumulative_(options)
+  {
+    for (std::size_t i = 0; i < GetAggregatorStripeCount(); ++i)
+    {
+      stripes_[i].sketch = DDSketch(options_);
+    }
+  }
+
+  /**
+   * Record a value. NaN and infinite values are ignored.
+   */
+  void Update(T value) noexcept
+  {
+    auto &stripe = stripes_[GetThreadAggregatorStripe()];
+    std::lock_guard<std::mutex> lock(stripe.mtx);
+    stripe.sketch.Add(static_cast<double>(value));
+  }
+
+  /**
+   * Take the values recorded since the previous checkpoint.
+   * @param temporality whether sketch is set to the values recorded since the previous
+   * checkpoint or since the aggregator was created
+   * @param sketch set to the sketch
+   * @return whether any value was recorded since the previous checkpoint
+   */
+  bool Checkpoint(AggregationTemporality temporality, DDSketch &sketch)
+  {
+    DDSketch delta(options_);
+    for (std::size_t i = 0; i < GetAggregatorStripeCount(); ++i)
+    {
+      DDSketch taken(options_);
+      {
+        std::lock_guard<std::mutex> lock(stripes_[i].mtx);
+        std::swap(taken, stripes_[i].sketch);
+      }
+      delta.Merge(taken);
+    }
+    bool has_data = delta.GetCount() != 0;
+
+    if (temporality == AggregationTemporality::Cumulative)
+    {
+      // The cumulative sketch is only kept by aggregators collected cumulatively.
+      cumulative_.Merge(delta);
+      sketch = cumulative_;
+    }
+    else
+    {
+      sketch = std::move(delta);
+    }
+    return has_data;
+  }
+
+private:
+  struct Stripe
+  {
+    mutable std::mutex mtx;
+    DDSketch sketch;
+    // Keeps the locks of neighbouring stripes on different cache lines.
+    char padding[kCacheLineSize];
+  };
+
+  const DDSketchOptions options_;
+  std::unique_ptr<Stripe[]> stripes_;
+  DDSketch cumulative_;
+};
+}  // namespace metrics
+}  // namespace sdk
+OPENTELEMETRY_END_NAMESPACE
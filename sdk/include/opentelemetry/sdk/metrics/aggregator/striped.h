@@ -0,0 +1,104 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <thread>
+
+#include "opentelemetry/version.h"
+
+OPENTELEMETRY_BEGIN_NAMESPACE
+namespace sdk
+{
+namespace metrics
+{
+/**
+ * The size of a cache line. Striped cells are padded to this size so that threads updating
+ * different stripes never write to the same cache line.
+ */
+const std::size_t kCacheLineSize = 64;
+
+/**
+ * The maximum number of stripes state shared by threads is split into.
+ */
+const std::size_t kMaxStripeCount = 64;
+
+/**
+ * @return the number of stripes state shared by threads, such as that of an instrument, is split
+ * into: the smallest power of two that is at least the number of hardware threads, capped at
+ * kMaxStripeCount
+ */
+inline std::size_t GetStripeCount() noexcept
+{
+  static const std::size_t stripe_count = [] {
+    std::size_t hardware_threads = std::thread::hardware_concurrency();
+    std::size_t count            = 1;
+    while (count < hardware_threads && count < kMaxStripeCount)
+    {
+      count <<= 1;
+    }
+    return count;
+  }();
+  return stripe_count;
+}
+
+/**
+ * @return the stripe the calling thread updates. Threads are assigned stripes round-robin the
+ * first time they record a value, so up to GetStripeCount() threads never share a stripe.
+ */
+inline std::size_t GetThreadStripe() noexcept
+{
+  static std::atomic<std::size_t> next_stripe{0};
+  static thread_local const std::size_t stripe =
+      next_stripe.fetch_add(1, std::memory_order_relaxed) & (GetStripeCount() - 1);
+  return stripe;
+}
+
+/**
+ * The maximum number of stripes the aggregator of a single label set is split into. Every label
+ * set has its own aggregator, so this bounds the memory of a label set, as that of an aggregator
+ * grows with its stripes; threads beyond it share stripes.
+ */
+const std::size_t kMaxAggregatorStripeCount = 8;
+
+/**
+ * @return the number of stripes the aggregator of a label set is split into: GetStripeCount(),
+ * capped at kMaxAggregatorStripeCount
+ */
+inline std::size_t GetAggregatorStripeCount() noexcept
+{
+  return GetStripeCount() < kMaxAggregatorStripeCount ? GetStripeCount()
+                                                      : kMaxAggregatorStripeCount;
+}
+
+/**
+ * @return the stripe of the aggregator of a label set that the calling thread updates
+ */
+inline std::size_t GetThreadAggregatorStripe() noexcept
+{
+  return GetThreadStripe() & (GetAggregatorStripeCount() - 1);
+}
+
+/**
+ * Atomically add a value to an integer without ordering constraints.
+ */
+template <class T>
+inline void AtomicAdd(std::atomic<T> &target, T value) noexcept
+{
+  target.fetch_add(value, std::memory_order_relaxed);
+}
+
+/**
+ * Atomically add a value to a double without ordering constraints. std::atomic<double> has no
+ * fetch_add before C++20, so this uses a compare-and-swap loop.
+ */
+inline void AtomicAdd(std::atomic<double> &target, double value) noexcept
+{
+  double current = target.load(std::memory_order_relaxed);
+  while (!target.compare_exchange_weak(current, current + value, std::memory_order_relaxed,
+                                       std::memory_order_relaxed))
+  {
+  }
+}
+}  // namespace metrics
+}  // namespace sdk
+OPENTELEMETRY_END_NAMESPACE
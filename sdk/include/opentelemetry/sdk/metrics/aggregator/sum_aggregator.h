@@ -0,0 +1,91 @@
+#pragma once
+
+#include <atomic>
+#include <memory>
+
+#include "opentelemetry/sdk/metrics/aggregator/striped.h"
+#include "opentelemetry/sdk/metrics/record.h"
+#include "opentelemetry/version.h"
+
+OPENTELEMETRY_BEGIN_NAMESPACE
+namespace sdk
+{
+namespace metrics
+{
+/**
+ * Aggregates values into a sum.
+ *
+ * The sum is split into one cache-line sized cell per stripe. Update only touches the cell of
+ * the calling thread with a relaxed atomic add, so concurrent updates from different threads
+ * do not contend; the cells are summed when the value is collected.
+ *
+ * A sum takes a cache line per stripe, i.e. up to kMaxAggregatorStripeCount * kCacheLineSize =
+ * 512 bytes.
+ *
+ * This class is thread-safe.
+ *
+ * @tparam T the type of the values aggregated, either int64_t or double
+ */
+template <class T>
+class SumAggregator
+{
+public:
+  SumAggregator() : stripe_count_{GetAggregatorStripeCount()}, cells_{new Cell[stripe_count_]}
+  {}
+
+  /**
+   * Add a value to the sum.
+   */
+  void Update(T value) noexcept
+  {
+    Cell &cell = cells_[GetThreadAggregatorStripe()];
+    AtomicAdd(cell.value, value);
+    // Only written once per checkpoint, so that threads sharing a cell don't keep writing it.
+    if (!cell.is_updated.load(std::memory_order_relaxed))
+    {
+      cell.is_updated.store(true, std::memory_order_relaxed);
+    }
+  }
+
+  /**
+   * Take the values added since the previous checkpoint.
+   * @param temporality whether value is set to the sum of the values added since the previous
+   * checkpoint or since the aggregator was created
+   * @param value set to the sum
+   * @return whether a value was added since the previous checkpoint, even if the sum did not
+   * change
+   */
+  bool Checkpoint(AggregationTemporality temporality, T &value) noexcept
+  {
+    T delta         = 0;
+    bool is_updated = false;
+    for (std::size_t i = 0; i < stripe_count_; ++i)
+    {
+      if (cells_[i].is_updated.load(std::memory_order_relaxed))
+      {
+        cells_[i].is_updated.store(false, std::memory_order_relaxed);
+        is_updated = true;
+      }
+      delta += cells_[i].value.exchange(0, std::memory_order_relaxed);
+    }
+    cumulative_ += delta;
+    value = temporality == AggregationTemporality::Delta ? delta : cumulative_;
+    return is_updated;
+  }
+
+private:
+  struct Cell
+  {
+    std::atomic<T> value{0};
+    std::atomic<bool> is_updated{false};
+    char padding[kCacheLineSize - sizeof(std::atomic<T>) - sizeof(std::atomic<bool>)];
+  };
+
+  const std::size_t stripe_count_;
+  std::unique_ptr<Cell[]> cells_;
+  // The sum of every checkpoint so far.
+  T cumulative_ = 0;
+};
+}  // namespace metrics
+}  // namespace sdk
+OPENTELEMETRY_END_NAMESPACE
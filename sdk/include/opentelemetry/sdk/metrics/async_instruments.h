@@ -0,0 +1,140 @@
+#pragma once
+
+#include <mutex>
+#include <vector>
+
+#include "opentelemetry/metrics/async_instruments.h"
+#include "opentelemetry/sdk/metrics/aggregator/last_value_aggregator.h"
+#include "opentelemetry/sdk/metrics/instrument.h"
+#include "opentelemetry/sdk/metrics/label_set_map.h"
+#include "opentelemetry/version.h"
+
+OPENTELEMETRY_BEGIN_NAMESPACE
+namespace sdk
+{
+namespace metrics
+{
+namespace metrics_api = opentelemetry::metrics;
+namespace trace_api   = opentelemetry::trace;
+
+/**
+ * The ObserverResult passed to the callback of an asynchronous instrument. Observations are
+ * written straight into the label set entries of the instrument, which persist across
+ * collections: observing a label set that was already observed before neither locks nor
+ * allocates memory.
+ */
+template <class T>
+class LabelSetObserverResult final : public metrics_api::ObserverResult<T>
+{
+public:
+  explicit LabelSetObserverResult(LabelSetMap<LastValueAggregator<T>> &values) noexcept
+      : values_(values)
+  {}
+
+  using metrics_api::ObserverResult<T>::Observe;
+
+  void Observe(T value, const trace_api::KeyValueIterable &labels) noexcept override
+  {
+    values_.Update(labels,
+                   [value](LastValueAggregator<T> &aggregator) { aggregator.Update(value); });
+  }
+
+private:
+  LabelSetMap<LastValueAggregator<T>> &values_;
+};
+
+/**
+ * The SDK implementation of the asynchronous instruments. The callback is only called when the
+ * instrument is collected, so observing a value costs nothing between collections.
+ *
+ * Sums are reported like the sums of synchronous instruments: with delta temporality, as the
+ * difference to the sum observed in the previous collection. Gauges are always reported as
+ * observed. Label sets that were not observed in a collection are not reported, and are
+ * reclaimed like those of synchronous instruments.
+ *
+ * @tparam T the type of the values observed
+ * @tparam ApiObserver the instrument interface implemented
+ * @tparam kKind the kind of the instrument
+ */
+template <class T, class ApiObserver, metrics_api::InstrumentKind kKind>
+class Observer final : public ApiObserver, public Collectable
+{
+public:
+  /**
+   * @param callback called on every collection to observe the values, may be nullptr
+   * @param state passed to every call of the callback
+   * @param cardinality_limit the maximum number of label sets, beyond which observations with a
+   * new label set are folded into a single overflow label set
+   */
+  Observer(nostd::string_view name,
+           nostd::string_view description,
+           nostd::string_view unit,
+           metrics_api::ObserverCallback<T> callback,
+           void *state,
+           std::size_t cardinality_limit = kDefaultCardinalityLimit)
+      : descriptor_{new InstrumentDescriptor{std::string(name), std::string(description),
+                                             std::string(unit), kKind}},
+        callback_{callback},
+        state_{state},
+        values_(cardinality_limit),
+        result_(values_)
+  {}
+
+  nostd::string_view GetName() const noexcept override { return descriptor_->name; }
+
+  nostd::string_view GetDescription() const noexcept override { return descriptor_->description; }
+
+  nostd::string_view GetUnit() const noexcept override { return descriptor_->unit; }
+
+  void Collect(std::vector<MetricRecord> &records,
+               AggregationTemporality temporality,
+               std::size_t max_idle_collections) noexcept override
+  {
+    // Callbacks are never called concurrently.
+    std::lock_guard<std::mutex> lock(collect_mtx_);
+    if (callback_ != nullptr)
+    {
+      callback_(result_, state_);
+    }
+    values_.Collect(max_idle_collections, [&](const LabelSet &labels,
+                                              LastValueAggregator<T> &aggregator,
+                                              core::SystemTimestamp start_time) {
+      T value;
+      bool is_observed = kKind == metrics_api::InstrumentKind::ValueObserver
+                             ? aggregator.Checkpoint(value)
+                             : aggregator.CheckpointSum(temporality, value);
+      if (is_observed)
+      {
+        records.push_back(MetricRecord{descriptor_, labels, MetricValue(value), start_time});
+      }
+      return is_observed;
+    });
+  }
+
+  uint64_t GetFoldedCount() const noexcept override { return values_.GetFoldedCount(); }
+
+private:
+  const std::shared_ptr<const InstrumentDescriptor> descriptor_;
+  const metrics_api::ObserverCallback<T> callback_;
+  void *const state_;
+
+  std::mutex collect_mtx_;
+  LabelSetMap<LastValueAggregator<T>> values_;
+  LabelSetObserverResult<T> result_;
+};
+
+template <class T>
+using SumObserver =
+    Observer<T, metrics_api::SumObserver<T>, metrics_api::InstrumentKind::SumObserver>;
+
+template <class T>
+using UpDownSumObserver = Observer<T,
+                                   metrics_api::UpDownSumObserver<T>,
+                                   metrics_api::InstrumentKind::UpDownSumObserver>;
+
+template <class T>
+using ValueObserver =
+    Observer<T, metrics_api::ValueObserver<T>, metrics_api::InstrumentKind::ValueObserver>;
+}  // namespace metrics
+}  // namespace sdk
+OPENTELEMETRY_END_NAMESPACE
@@ -0,0 +1,96 @@
+#pragma once
+
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "opentelemetry/core/timestamp.h"
+#include "opentelemetry/sdk/metrics/exporter.h"
+#include "opentelemetry/sdk/metrics/meter.h"
+#include "opentelemetry/version.h"
+
+OPENTELEMETRY_BEGIN_NAMESPACE
+namespace sdk
+{
+namespace metrics
+{
+/**
+ * Collects a meter at a fixed interval on a background thread and pushes the records to an
+ * exporter, with the temporality the exporter asks for.
+ *
+ * Collection checkpoints every aggregator by swapping out the values recorded since the
+ * previous collection, so recording is never blocked while instruments are collected. Label
+ * sets that are no longer used and have been idle for a number of collections are reclaimed,
+ * so memory follows the number of label sets in use rather than every label set ever seen.
+ *
+ * The controller must be the only reader of its meter.
+ *
+ * This class is thread-safe.
+ */
+class PushController
+{
+public:
+  /**
+   * @param meter the meter to collect
+   * @param exporter the exporter the records are pushed to
+   * @param interval the time between two collections
+   * @param max_idle_collections the number of consecutive collections an unused label set is
+   * kept for after its last update
+   */
+  PushController(std::shared_ptr<Meter> meter,
+                 std::unique_ptr<MetricExporter> &&exporter,
+                 std::chrono::milliseconds interval,
+                 std::size_t max_idle_collections = kDefaultMaxIdleCollections) noexcept;
+
+  /**
+   * Stops the controller if it is still running.
+   */
+  ~PushController();
+
+  /**
+   * Start collecting on a background thread.
+   * @return whether the controller was started; it cannot be started twice
+   */
+  bool Start() noexcept;
+
+  /**
+   * Stop the background thread, export a final collection and shut down the exporter.
+   */
+  void Stop() noexcept;
+
+  /**
+   * Collect the meter and export the records right away, on the calling thread.
+   */
+  void Collect() noexcept;
+
+private:
+  void Run() noexcept;
+
+  const std::shared_ptr<Meter> meter_;
+  const std::unique_ptr<MetricExporter> exporter_;
+  const std::chrono::milliseconds interval_;
+  const std::size_t max_idle_collections_;
+  const AggregationTemporality temporality_;
+
+  // Guards the state of the background thread.
+  std::mutex mtx_;
+  std::condition_variable cv_;
+  std::thread thread_;
+  bool is_started_  = false;
+  bool is_stopping_ = false;
+  bool is_shutdown_ = false;
+
+  // Serializes collections.
+  std::mutex collect_mtx_;
+  core::SystemTimestamp start_time_;
+  core::SystemTimestamp last_collection_time_;
+  // Reused across collections to keep its capacity.
+  std::vector<MetricRecord> records_;
+};
+}  // namespace metrics
+}  // namespace sdk
+OPENTELEMETRY_END_NAMESPACE
@@ -0,0 +1,70 @@
+#pragma once
+
+#include <chrono>
+#include <vector>
+
+#include "opentelemetry/core/timestamp.h"
+#include "opentelemetry/sdk/metrics/record.h"
+#include "opentelemetry/version.h"
+
+OPENTELEMETRY_BEGIN_NAMESPACE
+namespace sdk
+{
+namespace metrics
+{
+/**
+ * ExportResult is returned as result of exporting a batch of metric records.
+ */
+enum class ExportResult
+{
+  /**
+   * Batch was successfully exported.
+   */
+  kSuccess = 0,
+  /**
+   * Exporting failed. The caller must not retry exporting the same batch; the
+   * batch must be dropped.
+   */
+  kFailure
+};
+
+/**
+ * MetricExporter defines the interface that protocol-specific metric exporters must implement.
+ */
+class MetricExporter
+{
+public:
+  virtual ~MetricExporter() = default;
+
+  /**
+   * @return the temporality of the records this exporter expects to be passed
+   */
+  virtual AggregationTemporality GetAggregationTemporality() const noexcept
+  {
+    return AggregationTemporality::Cumulative;
+  }
+
+  /**
+   * Exports a batch of metric records. This method must not be called concurrently for the
+   * same exporter instance.
+   * @param records the records collected from a meter
+   * @param start_time the start of the interval the records cover: the previous collection for
+   * delta temporality, or the start of collection for cumulative temporality, in which case the
+   * start time of every record, that of its series, is the one to report for it
+   * @param end_time the time the records were collected
+   */
+  virtual ExportResult Export(const std::vector<MetricRecord> &records,
+                              core::SystemTimestamp start_time,
+                              core::SystemTimestamp end_time) noexcept = 0;
+
+  /**
+   * Shut down the exporter.
+   * @param timeout an optional timeout, the default timeout of 0 means that no
+   * timeout is applied.
+   */
+  virtual void Shutdown(
+      std::chrono::microseconds timeout = std::chrono::microseconds(0)) noexcept = 0;
+};
+}  // namespace metrics
+}  // namespace sdk
+OPENTELEMETRY_END_NAMESPACE
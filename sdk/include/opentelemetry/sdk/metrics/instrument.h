@@ -0,0 +1,46 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "opentelemetry/sdk/metrics/record.h"
+#include "opentelemetry/version.h"
+
+OPENTELEMETRY_BEGIN_NAMESPACE
+namespace sdk
+{
+namespace metrics
+{
+/**
+ * The default number of consecutive collections an unused label set is kept for after its
+ * last update.
+ */
+const std::size_t kDefaultMaxIdleCollections = 5;
+
+/**
+ * Implemented by every SDK instrument so that a Meter can collect its values.
+ */
+class Collectable
+{
+public:
+  virtual ~Collectable() = default;
+
+  /**
+   * Checkpoint every label set of this instrument and append its value to records. With delta
+   * temporality, label sets without new data are not reported. Label sets that are no longer
+   * used and have been idle for max_idle_collections consecutive collections are reclaimed.
+   */
+  virtual void Collect(std::vector<MetricRecord> &records,
+                       AggregationTemporality temporality,
+                       std::size_t max_idle_collections) noexcept = 0;
+
+  /**
+   * @return the number of recordings and bindings whose new label set was folded into the
+   * overflow label set because the cardinality limit of this instrument was reached
+   */
+  virtual uint64_t GetFoldedCount() const noexcept = 0;
+};
+}  // namespace metrics
+}  // namespace sdk
+OPENTELEMETRY_END_NAMESPACE
@@ -0,0 +1,120 @@
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "opentelemetry/trace/key_value_iterable.h"
+#include "opentelemetry/version.h"
+
+OPENTELEMETRY_BEGIN_NAMESPACE
+namespace sdk
+{
+namespace metrics
+{
+/**
+ * The canonical form of the labels passed to an instrument: label values are converted to
+ * strings, labels are sorted by key, and only the last value of a repeated key is kept. Two
+ * label sets that differ only in order or in overwritten values are therefore equal.
+ *
+ * The labels are immutable and shared between copies, so copying a label set into every
+ * collected record does not allocate.
+ */
+class LabelSet
+{
+public:
+  using Label = std::pair<std::string, std::string>;
+
+  /**
+   * Create an empty label set.
+   */
+  LabelSet() noexcept = default;
+
+  /**
+   * Create the canonical form of labels.
+   * @param labels the labels passed to an instrument
+   */
+  explicit LabelSet(const opentelemetry::trace::KeyValueIterable &labels);
+
+  /**
+   * Create a label set from labels in canonical form.
+   * @param sorted_labels the labels, sorted by key and without repeated keys, e.g. by
+   * Canonicalize
+   * @param hash the hash of the labels, as returned by Canonicalize
+   */
+  LabelSet(std::vector<Label> sorted_labels, std::size_t hash);
+
+  /**
+   * Put labels in canonical form into a buffer, reusing the memory of the labels it holds, so
+   * that labels GetHash can't hash are looked up without allocating memory once the buffer is
+   * large enough.
+   * @param labels the labels passed to an instrument
+   * @param sorted_labels set to the labels, sorted by key and without repeated keys
+   * @return the hash of the labels
+   */
+  static std::size_t Canonicalize(const opentelemetry::trace::KeyValueIterable &labels,
+                                  std::vector<Label> &sorted_labels);
+
+  /**
+   * The maximum number of labels GetHash hashes without creating a label set.
+   */
+  static const std::size_t kMaxHashedLabelCount = 16;
+
+  /**
+   * Compute the hash of the label set that would be created from labels, without allocating
+   * memory.
+   * @param labels the labels passed to an instrument
+   * @param hash set to the hash
+   * @return false if a key is repeated or there are more than kMaxHashedLabelCount labels, in
+   * which case the hash is not computed and the label set must be created instead
+   */
+  static bool GetHash(const opentelemetry::trace::KeyValueIterable &labels,
+                      std::size_t &hash) noexcept;
+
+  /**
+   * Check whether this label set equals the one that would be created from labels, without
+   * allocating memory.
+   * @param labels labels for which GetHash succeeded
+   */
+  bool Equals(const opentelemetry::trace::KeyValueIterable &labels) const noexcept;
+
+  /**
+   * @return the labels, sorted by key
+   */
+  const std::vector<Label> &GetLabels() const noexcept
+  {
+    static const std::vector<Label> kEmptyLabels;
+    return labels_ == nullptr ? kEmptyLabels : *labels_;
+  }
+
+  /**
+   * @return a hash of the labels, computed once on construction. It does not depend on the
+   * order of the labels.
+   */
+  std::size_t GetHash() const noexcept { return hash_; }
+
+  bool operator==(const LabelSet &other) const noexcept
+  {
+    return hash_ == other.hash_ &&
+           (labels_ == other.labels_ || GetLabels() == other.GetLabels());
+  }
+
+  bool operator!=(const LabelSet &other) const noexcept { return !(*this == other); }
+
+  /**
+   * Hashes label sets for use in unordered containers.
+   */
+  struct Hash
+  {
+    std::size_t operator()(const LabelSet &label_set) const noexcept { return label_set.hash_; }
+  };
+
+private:
+  std::shared_ptr<const std::vector<Label>> labels_;
+  std::size_t hash_ = 0;
+};
+}  // namespace metrics
+}  // namespace sdk
+OPENTELEMETRY_END_NAMESPACE
@@ -0,0 +1,710 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "opentelemetry/core/timestamp.h"
+#include "opentelemetry/sdk/metrics/aggregator/striped.h"
+#include "opentelemetry/sdk/metrics/label_set.h"
+#include "opentelemetry/trace/key_value_iterable.h"
+#include "opentelemetry/trace/key_value_iterable_view.h"
+#include "opentelemetry/version.h"
+
+OPENTELEMETRY_BEGIN_NAMESPACE
+namespace sdk
+{
+namespace metrics
+{
+/**
+ * The default maximum number of label sets of an instrument.
+ */
+const std::size_t kDefaultCardinalityLimit = 2000;
+
+/**
+ * The label of the series that label sets beyond the cardinality limit are folded into.
+ */
+const char kOverflowLabelKey[] = "otel.metric.overflow";
+
+/**
+ * Interns the label sets of an instrument, mapping each one to its aggregator.
+ *
+ * Existing label sets are found without locking: an open-addressing index of the entries is
+ * probed with a hash computed straight from the labels passed to the instrument, so a lookup
+ * neither locks nor allocates memory. Only adding a label set takes a lock.
+ *
+ * The number of label sets is bounded by a cardinality limit. Once it is reached, the labels
+ * of a new label set are folded into a single overflow entry, labelled with kOverflowLabelKey,
+ * again without allocating memory, and the recording is counted.
+ *
+ * Update updates the aggregator of a label set while the index is probed, and so writes nothing
+ * that the threads updating the same label set share: the probe keeps the entry from being
+ * freed, and the entry is marked as used in a flag of the stripe of the updating thread. Bound
+ * instruments instead take a reference to the entry with Acquire, that must be given back with
+ * Release, and update the aggregator with no lookup at all for as long as they are bound. An
+ * entry is only reclaimed once it has no references left and it has been idle for a number of
+ * collections.
+ *
+ * Reclaimed entries are freed once no thread can still be probing them, which collections find
+ * out with epochs, so that threads that keep probing the index don't keep them from being freed
+ * for as long as one of them is probing at every collection. Updates that found an entry before
+ * it was reclaimed are collected right before it is freed. A label set that is used again after
+ * its entry was reclaimed gets a new entry, whose cumulative values start over from the entry's
+ * own start time.
+ *
+ * This class is thread-safe.
+ *
+ * @tparam Aggregator the aggregator of every label set
+ */
+template <class Aggregator>
+class LabelSetMap
+{
+public:
+  struct Entry
+  {
+    Entry(LabelSet label_set, Aggregator &&aggregator, core::SystemTimestamp start_time)
+        : labels{std::move(label_set)}, aggregator(std::move(aggregator)), start_time{start_time}
+    {
+      for (auto &flag : is_used)
+      {
+        flag.store(false, std::memory_order_relaxed);
+      }
+    }
+
+    /**
+     * @return the number of bound instruments that use this entry
+     */
+    uint64_t GetRefCount() const noexcept
+    {
+      return state.load(std::memory_order_relaxed) & kRefCountMask;
+    }
+
+    const LabelSet labels;
+    Aggregator aggregator;
+
+    // The time the entry was created, which the cumulative values of its aggregator count from.
+    const core::SystemTimestamp start_time;
+
+    // The reference count in the low 32 bits and the number of times the entry was acquired in
+    // the high 32 bits, which wraps around. kReclaimedState once the entry is reclaimed.
+    std::atomic<uint64_t> state{0};
+
+    // Whether the aggregator was updated by Update since the previous collection, by the stripe
+    // of the updating thread.
+    std::atomic<bool> is_used[kMaxAggregatorStripeCount];
+
+    // The number of consecutive collections in which the aggregator held no new data. Only
+    // accessed by the collecting thread.
+    std::size_t idle_collections = 0;
+  };
+
+  /**
+   * Create a map whose aggregators are default constructed.
+   * @param cardinality_limit the maximum number of label sets, excluding the overflow entry
+   */
+  explicit LabelSetMap(std::size_t cardinality_limit = kDefaultCardinalityLimit)
+      : LabelSetMap([] { return Aggregator(); }, cardinality_limit)
+  {}
+
+  /**
+   * Create a map whose aggregators are created by make_aggregator.
+   * @param cardinality_limit the maximum number of label sets, excluding the overflow entry
+   */
+  explicit LabelSetMap(std::function<Aggregator()> make_aggregator,
+                       std::size_t cardinality_limit = kDefaultCardinalityLimit)
+      : make_aggregator_{std::move(make_aggregator)},
+        cardinality_limit_{cardinality_limit},
+        stripes_{new Stripe[GetStripeCount()]},
+        index_{new Index(kMinIndexCapacity)},
+        overflow_{new Entry(MakeOverflowLabels(), make_aggregator_(), NowTimestamp())}
+  {}
+
+  ~LabelSetMap()
+  {
+    Index *index = index_.load(std::memory_order_relaxed);
+    for (std::size_t i = 0; i < index->capacity; ++i)
+    {
+      Entry *entry = index->slots[i].load(std::memory_order_relaxed);
+      if (entry != nullptr && entry != GetTombstone())
+      {
+        delete entry;
+      }
+    }
+    delete index;
+  }
+
+  /**
+   * Find the entry of a label set, creating it if needed, and take a reference to it. Beyond
+   * the cardinality limit, the overflow entry is returned for new label sets.
+   * @param labels the labels identifying the entry
+   * @return the entry, which stays valid until Release is called
+   */
+  Entry *Acquire(const opentelemetry::trace::KeyValueIterable &labels)
+  {
+    Entry *found = nullptr;
+    Entry *entry = FindOrAdd(labels, [&found](Entry &entry) {
+      if (!TryAcquire(entry))
+      {
+        return false;
+      }
+      found = &entry;
+      return true;
+    });
+    if (entry == nullptr)
+    {
+      return found;
+    }
+    if (entry == overflow_.get())
+    {
+      overflow_->state.fetch_add(kAcquisition + 1, std::memory_order_acquire);
+    }
+    return entry;
+  }
+
+  /**
+   * Update the aggregator of a label set, creating its entry if needed, without taking a
+   * reference to it. Beyond the cardinality limit, the overflow entry is updated for new label
+   * sets.
+   * @param labels the labels identifying the entry
+   * @param function called as function(Aggregator &) to update the aggregator
+   */
+  template <class Function>
+  void Update(const opentelemetry::trace::KeyValueIterable &labels, Function function)
+  {
+    // An existing entry is updated while it is found, so that it can't be freed meanwhile.
+    Entry *entry = FindOrAdd(labels, [&function](Entry &entry) {
+      UpdateEntry(entry, function);
+      return true;
+    });
+    if (entry == nullptr)
+    {
+      return;
+    }
+    UpdateEntry(*entry, function);
+    if (entry != overflow_.get())
+    {
+      Release(entry);
+    }
+  }
+
+  /**
+   * Give back a reference taken by Acquire.
+   */
+  static void Release(Entry *entry) noexcept
+  {
+    entry->state.fetch_sub(1, std::memory_order_release);
+  }
+
+  /**
+   * Call a function for every label set and its aggregator, then reclaim the entries that have
+   * no references and have been idle for max_idle_collections consecutive collections. The
+   * function is called once more for a reclaimed entry when it is freed, if it was updated
+   * after it was last collected. Collections are serialized; the aggregators are collected
+   * without holding any lock that Acquire or Update takes.
+   * @param max_idle_collections the number of collections an unreferenced entry is kept for
+   * after its last update
+   * @param function called as function(const LabelSet &, Aggregator &, core::SystemTimestamp
+   * start_time) and returns whether the aggregator held any new data
+   */
+  template <class Function>
+  void Collect(std::size_t max_idle_collections, Function function)
+  {
+    std::lock_guard<std::mutex> collect_lock(collect_mtx_);
+    // Only this thread removes entries or frees indexes, so the index can be walked without
+    // any lock. Entries added meanwhile may or may not be visited.
+    Index *index = index_.load(std::memory_order_acquire);
+    reclaimed_.clear();
+    for (std::size_t i = 0; i < index->capacity; ++i)
+    {
+      Entry *entry = index->slots[i].load(std::memory_order_acquire);
+      if (entry == nullptr || entry == GetTombstone())
+      {
+        continue;
+      }
+      // If the entry is unreferenced, every update of a bound instrument happened before this
+      // load.
+      uint64_t state = entry->state.load(std::memory_order_acquire);
+      bool is_used   = TakeUsed(*entry);
+      if (function(entry->labels, entry->aggregator, entry->start_time) || is_used)
+      {
+        entry->idle_collections = 0;
+      }
+      // Reclaiming fails if the entry was acquired since its state was loaded, as it may then
+      // hold an update that was not collected. Updates of threads that found it before it was
+      // reclaimed are collected when it is freed.
+      else if (++entry->idle_collections >= max_idle_collections &&
+               (state & kRefCountMask) == 0 &&
+               entry->state.compare_exchange_strong(state, kReclaimedState,
+                                                    std::memory_order_acq_rel))
+      {
+        reclaimed_.push_back(entry);
+      }
+    }
+    if (is_overflow_used_.load(std::memory_order_relaxed))
+    {
+      // The overflow entry is reported from its first use on.
+      function(overflow_->labels, overflow_->aggregator, overflow_->start_time);
+    }
+
+    std::unique_lock<std::mutex> lock(mtx_);
+    if (!reclaimed_.empty())
+    {
+      index = index_.load(std::memory_order_relaxed);
+      for (Entry *entry : reclaimed_)
+      {
+        Remove(*index, entry);
+        retired_entries_.push_back({epoch_.load(std::memory_order_relaxed),
+                                    std::unique_ptr<Entry>(entry)});
+      }
+      size_.store(size_.load(std::memory_order_relaxed) - reclaimed_.size(),
+                  std::memory_order_relaxed);
+    }
+    FreeRetired();
+    lock.unlock();
+
+    for (auto &entry : freed_entries_)
+    {
+      if (TakeUsed(*entry))
+      {
+        function(entry->labels, entry->aggregator, entry->start_time);
+      }
+    }
+    freed_entries_.clear();
+  }
+
+  /**
+   * @return the number of label sets currently interned, excluding the overflow entry
+   */
+  std::size_t size() const noexcept { return size_.load(std::memory_order_relaxed); }
+
+  /**
+   * @return the number of times a new label set was folded into the overflow entry because
+   * the cardinality limit was reached: once per recording without a bound instrument, and once
+   * per Bind
+   */
+  uint64_t GetFoldedCount() const noexcept
+  {
+    uint64_t count = 0;
+    for (std::size_t i = 0; i < GetStripeCount(); ++i)
+    {
+      count += stripes_[i].folded_count.load(std::memory_order_relaxed);
+    }
+    return count;
+  }
+
+private:
+  static const uint64_t kRefCountMask   = 0xffffffff;
+  static const uint64_t kAcquisition    = uint64_t{1} << 32;
+  static const uint64_t kReclaimedState = kRefCountMask;
+  static const std::size_t kMinIndexCapacity = 64;
+
+  /**
+   * An open-addressing hash table of entries with linear probing. Removed entries leave a
+   * tombstone so that probe sequences stay intact; the index is rebuilt once too many slots are
+   * in use.
+   */
+  struct Index
+  {
+    explicit Index(std::size_t capacity)
+        : capacity{capacity}, slots{new std::atomic<Entry *>[capacity]()}
+    {}
+
+    // A power of two.
+    const std::size_t capacity;
+    std::unique_ptr<std::atomic<Entry *>[]> slots;
+  };
+
+  struct Stripe
+  {
+    // The number of threads of the stripe currently probing the index, by the parity of the
+    // epoch they started probing in.
+    std::atomic<uint64_t> reader_counts[2];
+    std::atomic<uint64_t> folded_count{0};
+    char padding[kCacheLineSize - 3 * sizeof(std::atomic<uint64_t>)];
+
+    Stripe() noexcept
+    {
+      reader_counts[0].store(0, std::memory_order_relaxed);
+      reader_counts[1].store(0, std::memory_order_relaxed);
+    }
+  };
+
+  /**
+   * An entry or index that was removed from the index, and the epoch it was removed in.
+   */
+  template <class T>
+  struct Retired
+  {
+    uint64_t epoch;
+    std::unique_ptr<T> retired;
+  };
+
+  static Entry *GetTombstone() noexcept
+  {
+    static char tombstone;
+    return reinterpret_cast<Entry *>(&tombstone);
+  }
+
+  static core::SystemTimestamp NowTimestamp() noexcept
+  {
+    return core::SystemTimestamp(std::chrono::system_clock::now());
+  }
+
+  static LabelSet MakeOverflowLabels()
+  {
+    using Labels  = std::map<std::string, bool>;
+    Labels labels = {{kOverflowLabelKey, true}};
+    return LabelSet(opentelemetry::trace::KeyValueIterableView<Labels>(labels));
+  }
+
+  /**
+   * Take a reference to an entry unless it was reclaimed.
+   */
+  static bool TryAcquire(Entry &entry) noexcept
+  {
+    uint64_t state = entry.state.load(std::memory_order_relaxed);
+    do
+    {
+      if (state == kReclaimedState)
+      {
+        return false;
+      }
+    } while (!entry.state.compare_exchange_weak(state, state + kAcquisition + 1,
+                                                std::memory_order_acquire,
+                                                std::memory_order_relaxed));
+    return true;
+  }
+
+  /**
+   * Update the aggregator of an entry, then mark it as used.
+   */
+  template <class Function>
+  static void UpdateEntry(Entry &entry, Function &function)
+  {
+    function(entry.aggregator);
+    // Only written once per collection, so that threads sharing a stripe don't keep writing it.
+    auto &is_used = entry.is_used[GetThreadAggregatorStripe()];
+    if (!is_used.load(std::memory_order_relaxed))
+    {
+      is_used.store(true, std::memory_order_relaxed);
+    }
+  }
+
+  /**
+   * @return whether an entry was marked as used since this was last called for it
+   */
+  static bool TakeUsed(Entry &entry) noexcept
+  {
+    bool is_used = false;
+    for (std::size_t i = 0; i < GetAggregatorStripeCount(); ++i)
+    {
+      if (entry.is_used[i].load(std::memory_order_relaxed))
+      {
+        entry.is_used[i].store(false, std::memory_order_relaxed);
+        is_used = true;
+      }
+    }
+    return is_used;
+  }
+
+  /**
+   * Find the entry of a label set, calling on_found with it, and add it if it is not found.
+   * @param on_found called as on_found(Entry &) while the entry is found, returns whether the
+   * entry was taken, or whether to look on as it was reclaimed meanwhile
+   * @return nullptr if on_found took an entry, otherwise the entry added with a reference taken,
+   * or the overflow entry, without one
+   */
+  template <class Function>
+  Entry *FindOrAdd(const opentelemetry::trace::KeyValueIterable &labels, Function on_found)
+  {
+    std::size_t hash;
+    if (!LabelSet::GetHash(labels, hash))
+    {
+      // Repeated keys, or too many labels, need the canonical form of the labels to be found. It
+      // is built into a buffer of the thread, and only copied into a label set once it is added,
+      // so that no memory is allocated for label sets that are found or folded.
+      static thread_local std::vector<LabelSet::Label> sorted_labels;
+      hash = LabelSet::Canonicalize(labels, sorted_labels);
+      if (Probe(
+              hash,
+              [](const Entry &entry) { return entry.labels.GetLabels() == sorted_labels; },
+              on_found))
+      {
+        return nullptr;
+      }
+      if (size_.load(std::memory_order_relaxed) >= cardinality_limit_)
+      {
+        return Fold();
+      }
+      return Insert(LabelSet(sorted_labels, hash));
+    }
+
+    if (Probe(
+            hash, [&labels](const Entry &entry) { return entry.labels.Equals(labels); },
+            on_found))
+    {
+      return nullptr;
+    }
+    if (size_.load(std::memory_order_relaxed) >= cardinality_limit_)
+    {
+      return Fold();
+    }
+    return Insert(LabelSet(labels));
+  }
+
+  /**
+   * Find an entry without locking and call a function with it, which can't be freed until the
+   * function returns.
+   * @param hash the hash of the label set of the entry
+   * @param is_match called with the entries not reclaimed whose hash matches
+   * @param function called as function(Entry &) with the matching entries until it returns
+   * true
+   * @return whether function returned true
+   */
+  template <class Predicate, class Function>
+  bool Probe(std::size_t hash, Predicate is_match, Function &function)
+  {
+    // Announce the probe, so that entries and indexes are not freed while they may be read.
+    auto &reader_count =
+        stripes_[GetThreadStripe()].reader_counts[epoch_.load(std::memory_order_seq_cst) & 1];
+    reader_count.fetch_add(1, std::memory_order_seq_cst);
+    Index *index  = index_.load(std::memory_order_seq_cst);
+    bool is_found = false;
+    for (std::size_t i = hash & (index->capacity - 1);;
+         i       = (i + 1) & (index->capacity - 1))
+    {
+      Entry *entry = index->slots[i].load(std::memory_order_seq_cst);
+      if (entry == nullptr)
+      {
+        break;
+      }
+      if (entry != GetTombstone() && entry->labels.GetHash() == hash &&
+          entry->state.load(std::memory_order_seq_cst) != kReclaimedState && is_match(*entry) &&
+          function(*entry))
+      {
+        is_found = true;
+        break;
+      }
+    }
+    reader_count.fetch_sub(1, std::memory_order_release);
+    return is_found;
+  }
+
+  /**
+   * Count a new label set folded into the overflow entry.
+   * @return the overflow entry, without taking a reference to it
+   */
+  Entry *Fold() noexcept
+  {
+    stripes_[GetThreadStripe()].folded_count.fetch_add(1, std::memory_order_relaxed);
+    // The overflow entry is never reclaimed, and reported from its first use on.
+    if (!is_overflow_used_.load(std::memory_order_relaxed))
+    {
+      is_overflow_used_.store(true, std::memory_order_relaxed);
+    }
+    return overflow_.get();
+  }
+
+  /**
+   * Add the entry of a label set, unless another thread added it first or the cardinality
+   * limit was reached, and take a reference to it.
+   * @return the entry, or the overflow entry, without a reference taken
+   */
+  Entry *Insert(LabelSet &&label_set)
+  {
+    std::lock_guard<std::mutex> lock(mtx_);
+    std::size_t hash = label_set.GetHash();
+    Entry *entry     = nullptr;
+    auto acquire     = [&entry](Entry &found) {
+      if (!TryAcquire(found))
+      {
+        return false;
+      }
+      entry = &found;
+      return true;
+    };
+    if (Probe(
+            hash, [&label_set](const Entry &entry) { return entry.labels == label_set; },
+            acquire))
+    {
+      return entry;
+    }
+    if (size_.load(std::memory_order_relaxed) >= cardinality_limit_)
+    {
+      return Fold();
+    }
+
+    Index *index = index_.load(std::memory_order_relaxed);
+    if ((used_slot_count_ + 1) * 4 > index->capacity * 3)
+    {
+      index = Rebuild(*index);
+    }
+    entry = new Entry(std::move(label_set), make_aggregator_(), NowTimestamp());
+    entry->state.store(kAcquisition + 1, std::memory_order_relaxed);
+    std::size_t i = hash & (index->capacity - 1);
+    Entry *slot_entry;
+    while ((slot_entry = index->slots[i].load(std::memory_order_relaxed)) != nullptr &&
+           slot_entry != GetTombstone())
+    {
+      i = (i + 1) & (index->capacity - 1);
+    }
+    if (slot_entry == nullptr)
+    {
+      ++used_slot_count_;
+    }
+    index->slots[i].store(entry, std::memory_order_seq_cst);
+    size_.store(size_.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+    return entry;
+  }
+
+  /**
+   * Replace the index by one without tombstones and with room for more entries. The caller
+   * must hold mtx_.
+   */
+  Index *Rebuild(Index &index)
+  {
+    std::size_t capacity = kMinIndexCapacity;
+    while (capacity < 4 * (size_.load(std::memory_order_relaxed) + 1))
+    {
+      capacity *= 2;
+    }
+    Index *new_index = new Index(capacity);
+    used_slot_count_ = 0;
+    for (std::size_t i = 0; i < index.capacity; ++i)
+    {
+      Entry *entry = index.slots[i].load(std::memory_order_relaxed);
+      if (entry == nullptr || entry == GetTombstone())
+      {
+        continue;
+      }
+      std::size_t j = entry->labels.GetHash() & (capacity - 1);
+      while (new_index->slots[j].load(std::memory_order_relaxed) != nullptr)
+      {
+        j = (j + 1) & (capacity - 1);
+      }
+      new_index->slots[j].store(entry, std::memory_order_relaxed);
+      ++used_slot_count_;
+    }
+    index_.store(new_index, std::memory_order_seq_cst);
+    retired_indexes_.push_back(
+        {epoch_.load(std::memory_order_relaxed), std::unique_ptr<Index>(&index)});
+    return new_index;
+  }
+
+  /**
+   * Replace a reclaimed entry by a tombstone. The caller must hold mtx_.
+   */
+  static void Remove(Index &index, Entry *entry) noexcept
+  {
+    for (std::size_t i = entry->labels.GetHash() & (index.capacity - 1);;
+         i       = (i + 1) & (index.capacity - 1))
+    {
+      Entry *slot_entry = index.slots[i].load(std::memory_order_relaxed);
+      if (slot_entry == entry)
+      {
+        index.slots[i].store(GetTombstone(), std::memory_order_seq_cst);
+        return;
+      }
+      if (slot_entry == nullptr)
+      {
+        return;
+      }
+    }
+  }
+
+  /**
+   * Free the retired indexes that no thread can still be probing, and move such retired entries
+   * to freed_entries_, to be collected once more before they are freed. The caller must hold
+   * mtx_.
+   *
+   * Probes count themselves by the parity of the epoch they read when they start, and the epoch
+   * only advances once the probes of the previous one are done. Those that start afterwards
+   * cannot reach what was removed before, so what was removed in an epoch is freed once the
+   * epoch advanced twice: a probe that read a stale epoch is counted by either parity.
+   */
+  void FreeRetired()
+  {
+    while (!retired_entries_.empty() || !retired_indexes_.empty())
+    {
+      uint64_t epoch = epoch_.load(std::memory_order_relaxed);
+      for (std::size_t i = 0; i < GetStripeCount(); ++i)
+      {
+        if (stripes_[i].reader_counts[(epoch + 1) & 1].load(std::memory_order_seq_cst) != 0)
+        {
+          // Try again on the next collection. Only probes that started before the epoch
+          // advanced use this count, so it drains however many threads keep probing.
+          return;
+        }
+      }
+      auto end = FindBefore(retired_entries_, epoch);
+      for (auto it = retired_entries_.begin(); it != end; ++it)
+      {
+        freed_entries_.push_back(std::move(it->retired));
+      }
+      retired_entries_.erase(retired_entries_.begin(), end);
+      retired_indexes_.erase(retired_indexes_.begin(), FindBefore(retired_indexes_, epoch));
+      epoch_.store(epoch + 1, std::memory_order_seq_cst);
+    }
+  }
+
+  /**
+   * @return the end of what was retired at least two epochs before epoch
+   */
+  template <class T>
+  static typename std::vector<Retired<T>>::iterator FindBefore(std::vector<Retired<T>> &retired,
+                                                               uint64_t epoch) noexcept
+  {
+    auto end = retired.begin();
+    while (end != retired.end() && end->epoch + 2 <= epoch)
+    {
+      ++end;
+    }
+    return end;
+  }
+
+  const std::function<Aggregator()> make_aggregator_;
+  const std::size_t cardinality_limit_;
+  std::unique_ptr<Stripe[]> stripes_;
+  std::atomic<Index *> index_;
+  std::atomic<std::size_t> size_{0};
+  const std::unique_ptr<Entry> overflow_;
+  std::atomic<bool> is_overflow_used_{false};
+  // Advanced by collections, under mtx_, to free retired entries and indexes.
+  std::atomic<uint64_t> epoch_{0};
+
+  // Serializes adding and removing entries.
+  std::mutex mtx_;
+  // The number of index slots holding an entry or a tombstone.
+  std::size_t used_slot_count_ = 0;
+  // Ordered by epoch.
+  std::vector<Retired<Entry>> retired_entries_;
+  std::vector<Retired<Index>> retired_indexes_;
+  // The retired entries to free once the current collection collected them.
+  std::vector<std::unique_ptr<Entry>> freed_entries_;
+
+  std::mutex collect_mtx_;
+  // The entries reclaimed by the current collection, kept to reuse its capacity.
+  std::vector<Entry *> reclaimed_;
+};
+
+template <class Aggregator>
+const uint64_t LabelSetMap<Aggregator>::kRefCountMask;
+
+template <class Aggregator>
+const uint64_t LabelSetMap<Aggregator>::kAcquisition;
+
+template <class Aggregator>
+const uint64_t LabelSetMap<Aggregator>::kReclaimedState;
+
+template <class Aggregator>
+const std::size_t LabelSetMap<Aggregator>::kMinIndexCapacity;
+}  // namespace metrics
+}  // namespace sdk
+OPENTELEMETRY_END_NAMESPACE
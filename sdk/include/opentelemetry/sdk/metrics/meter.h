@@ -0,0 +1,211 @@
+#pragma once
+
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "opentelemetry/metrics/meter.h"
+#include "opentelemetry/sdk/metrics/aggregator/ddsketch.h"
+#include "opentelemetry/sdk/metrics/instrument.h"
+#include "opentelemetry/sdk/metrics/label_set_map.h"
+#include "opentelemetry/sdk/metrics/record.h"
+#include "opentelemetry/version.h"
+
+OPENTELEMETRY_BEGIN_NAMESPACE
+namespace sdk
+{
+namespace metrics
+{
+class Meter final : public opentelemetry::metrics::Meter
+{
+public:
+  /**
+   * Initialize a new meter whose value recorders use GetDefaultBoundaries().
+   */
+  Meter() noexcept;
+
+  /**
+   * Initialize a new meter.
+   * @param boundaries the default bucket boundaries of the histograms of value recorders
+   * @param cardinality_limit the maximum number of label sets of every instrument, beyond which
+   * recordings with a new label set are folded into a single overflow label set
+   */
+  explicit Meter(std::vector<double> boundaries,
+                 std::size_t cardinality_limit = kDefaultCardinalityLimit) noexcept;
+
+  /**
+   * @return the default bucket boundaries of the histograms of value recorders
+   */
+  static std::vector<double> GetDefaultBoundaries() noexcept;
+
+  nostd::shared_ptr<opentelemetry::metrics::Counter<int64_t>> NewIntCounter(
+      nostd::string_view name,
+      nostd::string_view description = "",
+      nostd::string_view unit        = "") noexcept override;
+
+  nostd::shared_ptr<opentelemetry::metrics::Counter<double>> NewDoubleCounter(
+      nostd::string_view name,
+      nostd::string_view description = "",
+      nostd::string_view unit        = "") noexcept override;
+
+  nostd::shared_ptr<opentelemetry::metrics::UpDownCounter<int64_t>> NewIntUpDownCounter(
+      nostd::string_view name,
+      nostd::string_view description = "",
+      nostd::string_view unit        = "") noexcept override;
+
+  nostd::shared_ptr<opentelemetry::metrics::UpDownCounter<double>> NewDoubleUpDownCounter(
+      nostd::string_view name,
+      nostd::string_view description = "",
+      nostd::string_view unit        = "") noexcept override;
+
+  nostd::shared_ptr<opentelemetry::metrics::ValueRecorder<int64_t>> NewIntValueRecorder(
+      nostd::string_view name,
+      nostd::string_view description = "",
+      nostd::string_view unit        = "") noexcept override;
+
+  nostd::shared_ptr<opentelemetry::metrics::ValueRecorder<double>> NewDoubleValueRecorder(
+      nostd::string_view name,
+      nostd::string_view description = "",
+      nostd::string_view unit        = "") noexcept override;
+
+  /**
+   * Creates a ValueRecorder that records int64_t values into histograms with the given bucket
+   * boundaries instead of the meter's default boundaries.
+   */
+  nostd::shared_ptr<opentelemetry::metrics::ValueRecorder<int64_t>> NewIntValueRecorder(
+      nostd::string_view name,
+      nostd::string_view description,
+      nostd::string_view unit,
+      std::vector<double> boundaries) noexcept;
+
+  /**
+   * Creates a ValueRecorder that records double values into histograms with the given bucket
+   * boundaries instead of the meter's default boundaries.
+   */
+  nostd::shared_ptr<opentelemetry::metrics::ValueRecorder<double>> NewDoubleValueRecorder(
+      nostd::string_view name,
+      nostd::string_view description,
+      nostd::string_view unit,
+      std::vector<double> boundaries) noexcept;
+
+  /**
+   * Creates a ValueRecorder that records int64_t values into a DDSketch per label set instead
+   * of a histogram.
+   */
+  nostd::shared_ptr<opentelemetry::metrics::ValueRecorder<int64_t>> NewIntValueRecorder(
+      nostd::string_view name,
+      nostd::string_view description,
+      nostd::string_view unit,
+      const DDSketchOptions &options) noexcept;
+
+  /**
+   * Creates a ValueRecorder that records double values into a DDSketch per label set instead
+   * of a histogram.
+   */
+  nostd::shared_ptr<opentelemetry::metrics::ValueRecorder<double>> NewDoubleValueRecorder(
+      nostd::string_view name,
+      nostd::string_view description,
+      nostd::string_view unit,
+      const DDSketchOptions &options) noexcept;
+
+  // Observer callbacks are called by Collect, on the collecting thread. Creating an observer with
+  // the name of an existing one returns the existing instrument, which keeps its callback.
+  nostd::shared_ptr<opentelemetry::metrics::SumObserver<int64_t>> NewIntSumObserver(
+      nostd::string_view name,
+      nostd::string_view description,
+      nostd::string_view unit,
+      opentelemetry::metrics::ObserverCallback<int64_t> callback,
+      void *state = nullptr) noexcept override;
+
+  nostd::shared_ptr<opentelemetry::metrics::SumObserver<double>> NewDoubleSumObserver(
+      nostd::string_view name,
+      nostd::string_view description,
+      nostd::string_view unit,
+      opentelemetry::metrics::ObserverCallback<double> callback,
+      void *state = nullptr) noexcept override;
+
+  nostd::shared_ptr<opentelemetry::metrics::UpDownSumObserver<int64_t>> NewIntUpDownSumObserver(
+      nostd::string_view name,
+      nostd::string_view description,
+      nostd::string_view unit,
+      opentelemetry::metrics::ObserverCallback<int64_t> callback,
+      void *state = nullptr) noexcept override;
+
+  nostd::shared_ptr<opentelemetry::metrics::UpDownSumObserver<double>> NewDoubleUpDownSumObserver(
+      nostd::string_view name,
+      nostd::string_view description,
+      nostd::string_view unit,
+      opentelemetry::metrics::ObserverCallback<double> callback,
+      void *state = nullptr) noexcept override;
+
+  nostd::shared_ptr<opentelemetry::metrics::ValueObserver<int64_t>> NewIntValueObserver(
+      nostd::string_view name,
+      nostd::string_view description,
+      nostd::string_view unit,
+      opentelemetry::metrics::ObserverCallback<int64_t> callback,
+      void *state = nullptr) noexcept override;
+
+  nostd::shared_ptr<opentelemetry::metrics::ValueObserver<double>> NewDoubleValueObserver(
+      nostd::string_view name,
+      nostd::string_view description,
+      nostd::string_view unit,
+      opentelemetry::metrics::ObserverCallback<double> callback,
+      void *state = nullptr) noexcept override;
+
+  /**
+   * Checkpoint every label set of every instrument created by this meter and collect its value.
+   * Records are ordered by instrument name. A meter should always be collected with the same
+   * temporality, and by a single reader: every collection takes the values recorded since the
+   * previous one.
+   * @param temporality whether to collect the values recorded since the previous collection or
+   * since each label set was first used. With delta temporality, label sets without new data
+   * are not reported.
+   * @param max_idle_collections the number of consecutive collections an unused label set is
+   * kept for after its last update
+   * @return the collected records
+   */
+  std::vector<MetricRecord> Collect(
+      AggregationTemporality temporality = AggregationTemporality::Cumulative,
+      std::size_t max_idle_collections   = kDefaultMaxIdleCollections) noexcept;
+
+  /**
+   * Collect like above, appending the records to a vector that can be reused across
+   * collections.
+   */
+  void Collect(std::vector<MetricRecord> &records,
+               AggregationTemporality temporality,
+               std::size_t max_idle_collections) noexcept;
+
+  /**
+   * @return the number of recordings and bindings, over every instrument of this meter, whose
+   * new label set was folded into the overflow label set because the cardinality limit of the
+   * instrument was reached
+   */
+  uint64_t GetFoldedCount() noexcept;
+
+private:
+  struct InstrumentEntry
+  {
+    // Identifies the SDK instrument class, so a name is only reused for the same class.
+    const void *type;
+    std::shared_ptr<void> instrument;
+    std::shared_ptr<Collectable> collectable;
+  };
+
+  template <class Instrument, class NoopInstrument, class ApiInstrument, class... Args>
+  nostd::shared_ptr<ApiInstrument> GetOrCreateInstrument(nostd::string_view name,
+                                                         nostd::string_view description,
+                                                         nostd::string_view unit,
+                                                         Args &&... args) noexcept;
+
+  const std::vector<double> boundaries_;
+  const std::size_t cardinality_limit_;
+
+  std::mutex mtx_;
+  std::map<std::string, InstrumentEntry> instruments_;
+};
+}  // namespace metrics
+}  // namespace sdk
+OPENTELEMETRY_END_NAMESPACE
@@ -0,0 +1,38 @@
+#pragma once
+
+#include <memory>
+
+#include "opentelemetry/metrics/meter_provider.h"
+#include "opentelemetry/nostd/shared_ptr.h"
+#include "opentelemetry/sdk/metrics/meter.h"
+
+OPENTELEMETRY_BEGIN_NAMESPACE
+namespace sdk
+{
+namespace metrics
+{
+class MeterProvider final : public opentelemetry::metrics::MeterProvider
+{
+public:
+  /**
+   * Initialize a new meter provider.
+   * @param meter The meter returned by GetMeter. A new meter is created if this is a nullptr.
+   */
+  explicit MeterProvider(std::shared_ptr<Meter> meter = nullptr) noexcept;
+
+  opentelemetry::nostd::shared_ptr<opentelemetry::metrics::Meter> GetMeter(
+      nostd::string_view library_name,
+      nostd::string_view library_version = "") noexcept override;
+
+  /**
+   * Obtain the SDK meter of this provider, e.g. to collect its metrics.
+   * @return The meter of this provider.
+   */
+  std::shared_ptr<Meter> GetSdkMeter() const noexcept;
+
+private:
+  std::shared_ptr<Meter> meter_;
+};
+}  // namespace metrics
+}  // namespace sdk
+OPENTELEMETRY_END_NAMESPACE
@@ -0,0 +1,79 @@
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "opentelemetry/core/timestamp.h"
+#include "opentelemetry/metrics/instrument.h"
+#include "opentelemetry/nostd/variant.h"
+#include "opentelemetry/sdk/metrics/aggregator/ddsketch.h"
+#include "opentelemetry/sdk/metrics/label_set.h"
+#include "opentelemetry/version.h"
+
+OPENTELEMETRY_BEGIN_NAMESPACE
+namespace sdk
+{
+namespace metrics
+{
+/**
+ * Identifies an instrument and describes the values it records.
+ */
+struct InstrumentDescriptor
+{
+  std::string name;
+  std::string description;
+  std::string unit;
+  opentelemetry::metrics::InstrumentKind kind;
+};
+
+/**
+ * Whether collected values cover the interval since the previous collection or everything
+ * recorded since the series was created.
+ */
+enum class AggregationTemporality
+{
+  Delta,
+  Cumulative
+};
+
+/**
+ * The distribution of the values recorded for a single label set.
+ */
+struct HistogramValue
+{
+  // The sorted bucket boundaries, shared by every histogram of an instrument. Bucket i holds the
+  // values in (boundaries[i - 1], boundaries[i]].
+  std::shared_ptr<const std::vector<double>> boundaries;
+
+  // The number of values in every bucket; there is one more bucket than there are boundaries.
+  std::vector<uint64_t> counts;
+
+  // The sum of the values.
+  double sum = 0;
+
+  // The number of values.
+  uint64_t count = 0;
+};
+
+/**
+ * The aggregated value of a single label set of an instrument.
+ */
+using MetricValue = nostd::variant<int64_t, double, HistogramValue, DDSketch>;
+
+/**
+ * The value of a single label set of an instrument at collection time.
+ */
+struct MetricRecord
+{
+  // Shared by every record of the instrument.
+  std::shared_ptr<const InstrumentDescriptor> descriptor;
+  LabelSet labels;
+  MetricValue value;
+  // The time the series of the label set was created, which its cumulative value counts from.
+  core::SystemTimestamp start_time;
+};
+}  // namespace metrics
+}  // namespace sdk
+OPENTELEMETRY_END_NAMESPACE
@@ -0,0 +1,335 @@
+#pragma once
+
+#include <atomic>
+#include <memory>
+#include <vector>
+
+#include "opentelemetry/metrics/sync_instruments.h"
+#include "opentelemetry/sdk/metrics/aggregator/histogram_aggregator.h"
+#include "opentelemetry/sdk/metrics/aggregator/sketch_aggregator.h"
+#include "opentelemetry/sdk/metrics/aggregator/sum_aggregator.h"
+#include "opentelemetry/sdk/metrics/instrument.h"
+#include "opentelemetry/sdk/metrics/label_set_map.h"
+#include "opentelemetry/version.h"
+
+OPENTELEMETRY_BEGIN_NAMESPACE
+namespace sdk
+{
+namespace metrics
+{
+namespace metrics_api = opentelemetry::metrics;
+namespace trace_api   = opentelemetry::trace;
+
+/**
+ * Checkpoint the sum of every label set of an instrument and append it to records.
+ * @param is_monotonic whether the sums only grow. The label set of a sum that does not is never
+ * reclaimed while it is collected cumulatively and its sum is not zero, as its value would be
+ * lost: a new entry counts from zero.
+ */
+template <class T>
+void CollectSums(LabelSetMap<SumAggregator<T>> &sums,
+                 const std::shared_ptr<const InstrumentDescriptor> &descriptor,
+                 AggregationTemporality temporality,
+                 bool is_monotonic,
+                 std::size_t max_idle_collections,
+                 std::vector<MetricRecord> &records) noexcept
+{
+  sums.Collect(max_idle_collections, [&](const LabelSet &labels, SumAggregator<T> &aggregator,
+                                          core::SystemTimestamp start_time) {
+    T sum;
+    bool has_data = aggregator.Checkpoint(temporality, sum);
+    if (has_data || temporality == AggregationTemporality::Cumulative)
+    {
+      records.push_back(MetricRecord{descriptor, labels, MetricValue(sum), start_time});
+    }
+    return has_data ||
+           (!is_monotonic && temporality == AggregationTemporality::Cumulative && sum != 0);
+  });
+}
+
+/**
+ * A sum instrument bound to the entry of a single label set.
+ *
+ * @tparam T the type of the values added
+ * @tparam ApiBound the bound instrument interface implemented
+ * @tparam kIsMonotonic whether negative values are ignored
+ */
+template <class T, class ApiBound, bool kIsMonotonic>
+class BoundSum final : public ApiBound
+{
+public:
+  using Sums = LabelSetMap<SumAggregator<T>>;
+
+  BoundSum(std::shared_ptr<Sums> sums, typename Sums::Entry *entry) noexcept
+      : sums_{std::move(sums)}, entry_{entry}
+  {}
+
+  ~BoundSum() override { Unbind(); }
+
+  void Add(T value) noexcept override
+  {
+    if ((kIsMonotonic && value < 0) || is_unbound_.load(std::memory_order_relaxed))
+    {
+      return;
+    }
+    entry_->aggregator.Update(value);
+  }
+
+  void Unbind() noexcept override
+  {
+    if (!is_unbound_.exchange(true))
+    {
+      Sums::Release(entry_);
+    }
+  }
+
+private:
+  // Keeps the entry alive even if the instrument is destroyed first.
+  const std::shared_ptr<Sums> sums_;
+  typename Sums::Entry *const entry_;
+  std::atomic<bool> is_unbound_{false};
+};
+
+template <class T>
+using BoundCounter = BoundSum<T, metrics_api::BoundCounter<T>, true>;
+
+template <class T>
+using BoundUpDownCounter = BoundSum<T, metrics_api::BoundUpDownCounter<T>, false>;
+
+/**
+ * The SDK implementation of Counter. Each label set is aggregated into a sum.
+ */
+template <class T>
+class Counter final : public metrics_api::Counter<T>, public Collectable
+{
+public:
+  /**
+   * @param cardinality_limit the maximum number of label sets, beyond which recordings with a
+   * new label set are folded into a single overflow label set
+   */
+  Counter(nostd::string_view name,
+          nostd::string_view description,
+          nostd::string_view unit,
+          std::size_t cardinality_limit = kDefaultCardinalityLimit)
+      : descriptor_{new InstrumentDescriptor{std::string(name), std::string(description),
+                                             std::string(unit),
+                                             metrics_api::InstrumentKind::Counter}},
+        sums_{new LabelSetMap<SumAggregator<T>>(cardinality_limit)}
+  {}
+
+  using metrics_api::Counter<T>::Add;
+  using metrics_api::Counter<T>::Bind;
+
+  void Add(T value, const trace_api::KeyValueIterable &labels) noexcept override
+  {
+    if (value < 0)
+    {
+      return;
+    }
+    sums_->Update(labels, [value](SumAggregator<T> &aggregator) { aggregator.Update(value); });
+  }
+
+  nostd::shared_ptr<metrics_api::BoundCounter<T>> Bind(
+      const trace_api::KeyValueIterable &labels) noexcept override
+  {
+    return nostd::shared_ptr<metrics_api::BoundCounter<T>>(
+        new BoundCounter<T>(sums_, sums_->Acquire(labels)));
+  }
+
+  nostd::string_view GetName() const noexcept override { return descriptor_->name; }
+
+  nostd::string_view GetDescription() const noexcept override { return descriptor_->description; }
+
+  nostd::string_view GetUnit() const noexcept override { return descriptor_->unit; }
+
+  void Collect(std::vector<MetricRecord> &records,
+               AggregationTemporality temporality,
+               std::size_t max_idle_collections) noexcept override
+  {
+    CollectSums(*sums_, descriptor_, temporality, true, max_idle_collections, records);
+  }
+
+  uint64_t GetFoldedCount() const noexcept override { return sums_->GetFoldedCount(); }
+
+private:
+  const std::shared_ptr<const InstrumentDescriptor> descriptor_;
+  const std::shared_ptr<LabelSetMap<SumAggregator<T>>> sums_;
+};
+
+/**
+ * The SDK implementation of UpDownCounter. Each label set is aggregated into a sum. Collected
+ * cumulatively, a label set is kept for as long as its sum is not zero, however long it is idle.
+ */
+template <class T>
+class UpDownCounter final : public metrics_api::UpDownCounter<T>, public Collectable
+{
+public:
+  /**
+   * @param cardinality_limit the maximum number of label sets, beyond which recordings with a
+   * new label set are folded into a single overflow label set
+   */
+  UpDownCounter(nostd::string_view name,
+                nostd::string_view description,
+                nostd::string_view unit,
+                std::size_t cardinality_limit = kDefaultCardinalityLimit)
+      : descriptor_{new InstrumentDescriptor{std::string(name), std::string(description),
+                                             std::string(unit),
+                                             metrics_api::InstrumentKind::UpDownCounter}},
+        sums_{new LabelSetMap<SumAggregator<T>>(cardinality_limit)}
+  {}
+
+  using metrics_api::UpDownCounter<T>::Add;
+  using metrics_api::UpDownCounter<T>::Bind;
+
+  void Add(T value, const trace_api::KeyValueIterable &labels) noexcept override
+  {
+    sums_->Update(labels, [value](SumAggregator<T> &aggregator) { aggregator.Update(value); });
+  }
+
+  nostd::shared_ptr<metrics_api::BoundUpDownCounter<T>> Bind(
+      const trace_api::KeyValueIterable &labels) noexcept override
+  {
+    return nostd::shared_ptr<metrics_api::BoundUpDownCounter<T>>(
+        new BoundUpDownCounter<T>(sums_, sums_->Acquire(labels)));
+  }
+
+  nostd::string_view GetName() const noexcept override { return descriptor_->name; }
+
+  nostd::string_view GetDescription() const noexcept override { return descriptor_->description; }
+
+  nostd::string_view GetUnit() const noexcept override { return descriptor_->unit; }
+
+  void Collect(std::vector<MetricRecord> &records,
+               AggregationTemporality temporality,
+               std::size_t max_idle_collections) noexcept override
+  {
+    CollectSums(*sums_, descriptor_, temporality, false, max_idle_collections, records);
+  }
+
+  uint64_t GetFoldedCount() const noexcept override { return sums_->GetFoldedCount(); }
+
+private:
+  const std::shared_ptr<const InstrumentDescriptor> descriptor_;
+  const std::shared_ptr<LabelSetMap<SumAggregator<T>>> sums_;
+};
+
+/**
+ * A ValueRecorder bound to the entry of a single label set.
+ */
+template <class T, class Aggregator>
+class BoundValueRecorder final : public metrics_api::BoundValueRecorder<T>
+{
+public:
+  using Aggregators = LabelSetMap<Aggregator>;
+
+  BoundValueRecorder(std::shared_ptr<Aggregators> aggregators,
+                     typename Aggregators::Entry *entry) noexcept
+      : aggregators_{std::move(aggregators)}, entry_{entry}
+  {}
+
+  ~BoundValueRecorder() override { Unbind(); }
+
+  void Record(T value) noexcept override
+  {
+    if (is_unbound_.load(std::memory_order_relaxed))
+    {
+      return;
+    }
+    entry_->aggregator.Update(value);
+  }
+
+  void Unbind() noexcept override
+  {
+    if (!is_unbound_.exchange(true))
+    {
+      Aggregators::Release(entry_);
+    }
+  }
+
+private:
+  // Keeps the entry alive even if the instrument is destroyed first.
+  const std::shared_ptr<Aggregators> aggregators_;
+  typename Aggregators::Entry *const entry_;
+  std::atomic<bool> is_unbound_{false};
+};
+
+/**
+ * The SDK implementation of ValueRecorder. Each label set is aggregated into a distribution:
+ * by default a histogram with explicit bucket boundaries, or a DDSketch.
+ *
+ * @tparam T the type of the values recorded
+ * @tparam Aggregator HistogramAggregator<T> or SketchAggregator<T>
+ */
+template <class T, class Aggregator = HistogramAggregator<T>>
+class ValueRecorder final : public metrics_api::ValueRecorder<T>, public Collectable
+{
+public:
+  using Aggregators = LabelSetMap<Aggregator>;
+
+  /**
+   * @param options the argument every aggregator is constructed with: the bucket boundaries
+   * of a HistogramAggregator or the DDSketchOptions of a SketchAggregator
+   * @param cardinality_limit the maximum number of label sets, beyond which recordings with a
+   * new label set are folded into a single overflow label set
+   */
+  template <class Options>
+  ValueRecorder(nostd::string_view name,
+                nostd::string_view description,
+                nostd::string_view unit,
+                Options options,
+                std::size_t cardinality_limit = kDefaultCardinalityLimit)
+      : descriptor_{new InstrumentDescriptor{std::string(name), std::string(description),
+                                             std::string(unit),
+                                             metrics_api::InstrumentKind::ValueRecorder}},
+        aggregators_{
+            new Aggregators([options] { return Aggregator(options); }, cardinality_limit)}
+  {}
+
+  using metrics_api::ValueRecorder<T>::Record;
+  using metrics_api::ValueRecorder<T>::Bind;
+
+  void Record(T value, const trace_api::KeyValueIterable &labels) noexcept override
+  {
+    aggregators_->Update(labels, [value](Aggregator &aggregator) { aggregator.Update(value); });
+  }
+
+  nostd::shared_ptr<metrics_api::BoundValueRecorder<T>> Bind(
+      const trace_api::KeyValueIterable &labels) noexcept override
+  {
+    return nostd::shared_ptr<metrics_api::BoundValueRecorder<T>>(
+        new BoundValueRecorder<T, Aggregator>(aggregators_, aggregators_->Acquire(labels)));
+  }
+
+  nostd::string_view GetName() const noexcept override { return descriptor_->name; }
+
+  nostd::string_view GetDescription() const noexcept override { return descriptor_->description; }
+
+  nostd::string_view GetUnit() const noexcept override { return descriptor_->unit; }
+
+  void Collect(std::vector<MetricRecord> &records,
+               AggregationTemporality temporality,
+               std::size_t max_idle_collections) noexcept override
+  {
+    aggregators_->Collect(max_idle_collections, [&](const LabelSet &labels,
+                                                    Aggregator &aggregator,
+                                                    core::SystemTimestamp start_time) {
+      typename Aggregator::Value value;
+      bool has_data = aggregator.Checkpoint(temporality, value);
+      if (has_data || temporality == AggregationTemporality::Cumulative)
+      {
+        records.push_back(
+            MetricRecord{descriptor_, labels, MetricValue(std::move(value)), start_time});
+      }
+      return has_data;
+    });
+  }
+
+  uint64_t GetFoldedCount() const noexcept override { return aggregators_->GetFoldedCount(); }
+
+private:
+  const std::shared_ptr<const InstrumentDescriptor> descriptor_;
+  const std::shared_ptr<Aggregators> aggregators_;
+};
+}  // namespace metrics
+}  // namespace sdk
+OPENTELEMETRY_END_NAMESPACE
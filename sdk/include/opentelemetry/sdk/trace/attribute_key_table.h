@@ -0,0 +1,95 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <mutex>
+#include <string>
+#include <unordered_set>
+
+#include "opentelemetry/nostd/string_view.h"
+#include "opentelemetry/version.h"
+
+OPENTELEMETRY_BEGIN_NAMESPACE
+namespace sdk
+{
+namespace trace
+{
+/**
+ * Hashes the characters of a string view, for the attribute key table and for the maps keyed by
+ * the attribute keys it interns.
+ */
+struct AttributeKeyHash
+{
+  std::size_t operator()(nostd::string_view key) const noexcept
+  {
+    // FNV-1a
+    uint64_t hash = 14695981039346656037ull;
+    for (char c : key)
+    {
+      hash ^= static_cast<unsigned char>(c);
+      hash *= 1099511628211ull;
+    }
+    return static_cast<std::size_t>(hash);
+  }
+};
+
+/**
+ * An append-only table of attribute keys, which interns every key once, so that recordables can
+ * store the view of the interned key instead of a copy of it. The interned keys are never freed
+ * or moved, and equal keys are interned to the same characters, so that the data pointer of an
+ * interned key identifies it, e.g. for exporters to cache the encoding of every key by.
+ *
+ * Keys are looked up and inserted without locking, in a fixed table with open addressing, which
+ * holds the few hundred keys that are usually used. Keys that don't fit it are kept in an
+ * overflow set behind a mutex, of at most kMaxOverflowKeys keys, so that unbounded keys, e.g.
+ * ones that embed ids, can't grow the table without limit. Keys beyond it are not interned.
+ */
+class AttributeKeyTable
+{
+public:
+  AttributeKeyTable() noexcept;
+
+  ~AttributeKeyTable();
+
+  AttributeKeyTable(const AttributeKeyTable &) = delete;
+  AttributeKeyTable &operator=(const AttributeKeyTable &) = delete;
+
+  /**
+   * The maximum number of keys kept in the overflow set, besides those in the table.
+   */
+  static const std::size_t kMaxOverflowKeys = 4096;
+
+  /**
+   * @return a view of the interned copy of key, which is valid as long as the table, or a view
+   * with a null data pointer if key is not interned and the table is full
+   */
+  nostd::string_view Intern(nostd::string_view key) noexcept;
+
+  /**
+   * @return the table that recordables intern attribute keys into, which is never destroyed
+   */
+  static AttributeKeyTable &GetGlobal() noexcept;
+
+private:
+  struct Entry
+  {
+    std::size_t hash;
+    std::string key;
+  };
+
+  // The number of slots of the table, a power of two, and the number of slots probed for a key
+  // before it is kept in the overflow set.
+  static const std::size_t kSlots     = 1024;
+  static const std::size_t kMaxProbes = 32;
+
+  std::atomic<Entry *> slots_[kSlots];
+
+  std::mutex overflow_mutex_;
+  std::deque<std::string> overflow_keys_;
+  std::unordered_set<nostd::string_view, AttributeKeyHash> overflow_;
+};
+}  // namespace trace
+}  // namespace sdk
+OPENTELEMETRY_END_NAMESPACE
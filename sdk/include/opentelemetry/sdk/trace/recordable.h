@@ -4,6 +4,8 @@
 #include "opentelemetry/core/timestamp.h"
 #include "opentelemetry/nostd/string_view.h"
 #include "opentelemetry/trace/canonical_code.h"
+#include "opentelemetry/trace/key_value_iterable.h"
+#include "opentelemetry/trace/span.h"
 #include "opentelemetry/trace/span_id.h"
 #include "opentelemetry/trace/trace_id.h"
 #include "opentelemetry/version.h"
@@ -14,6 +16,25 @@ namespace sdk
 namespace trace_api = opentelemetry::trace;
 namespace trace
 {
+/**
+ * What is known about a span as it starts.
+ */
+struct SpanStartData
+{
+  opentelemetry::trace::TraceId trace_id;
+  opentelemetry::trace::SpanId span_id;
+  opentelemetry::trace::SpanId parent_span_id;
+  nostd::string_view name;
+  trace_api::SpanKind span_kind;
+
+  // The attributes the span was started with, and those added by the sampler, which take
+  // precedence. Either can be nullptr.
+  const trace_api::KeyValueIterable *attributes;
+  const trace_api::KeyValueIterable *sampling_attributes;
+
+  core::SystemTimestamp start_time;
+};
+
 /**
  * Maintains a representation of a span in a format that can be processed by a recorder.
  *
@@ -24,6 +45,33 @@ class Recordable
 public:
   virtual ~Recordable() = default;
 
+  /**
+   * Initialize the span as it starts, at once rather than with a call to SetIds, SetName,
+   * SetSpanKind, SetAttribute for every attribute and SetStartTime, which is what this does by
+   * default. Recordables can override it to e.g. reserve storage for all attributes up front.
+   * @param data the ids, name, kind, attributes and start time of the span
+   */
+  virtual void Init(const SpanStartData &data) noexcept
+  {
+    SetIds(data.trace_id, data.span_id, data.parent_span_id);
+    SetName(data.name);
+    SetSpanKind(data.span_kind);
+    auto set_attribute = [this](nostd::string_view key,
+                                opentelemetry::common::AttributeValue value) noexcept {
+      SetAttribute(key, value);
+      return true;
+    };
+    if (data.attributes != nullptr)
+    {
+      data.attributes->ForEachKeyValue(set_attribute);
+    }
+    if (data.sampling_attributes != nullptr)
+    {
+      data.sampling_attributes->ForEachKeyValue(set_attribute);
+    }
+    SetStartTime(data.start_time);
+  }
+
   /**
    * Set a trace id, span id and parent span id for this span.
    * @param trace_id the trace id to set
@@ -46,8 +94,11 @@ class Recordable
    * Add an event to a span.
    * @param name the name of the event
    * @param timestamp the timestamp of the event
+   * @param attributes the attributes of the event
    */
-  virtual void AddEvent(nostd::string_view name, core::SystemTimestamp timestamp) noexcept = 0;
+  virtual void AddEvent(nostd::string_view name,
+                        core::SystemTimestamp timestamp,
+                        const trace_api::KeyValueIterable &attributes) noexcept = 0;
 
   /**
    * Set the status of the span.
@@ -63,6 +114,12 @@ class Recordable
    */
   virtual void SetName(nostd::string_view name) noexcept = 0;
 
+  /**
+   * Set the kind of the span.
+   * @param span_kind the kind to set
+   */
+  virtual void SetSpanKind(trace_api::SpanKind span_kind) noexcept = 0;
+
   /**
    * Set the start time of the span.
    * @param start_time the start time to set
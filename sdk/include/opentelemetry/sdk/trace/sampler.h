@@ -1,13 +1,12 @@
 #pragma once
 
 #include "opentelemetry/common/attribute_value.h"
+#include "opentelemetry/trace/key_value_iterable.h"
 #include "opentelemetry/trace/span.h"
 #include "opentelemetry/trace/trace_id.h"
 #include "opentelemetry/version.h"
 #include "opentelemetry/trace/span_context.h"
 
-#include <map>
-#include <memory>
 #include <string>
 
 OPENTELEMETRY_BEGIN_NAMESPACE
@@ -38,8 +37,10 @@ enum class Decision
 struct SamplingResult
 {
   Decision decision;
-  // A set of span Attributes that will also be added to the Span. Can be nullptr.
-  std::unique_ptr<const std::map<std::string, opentelemetry::common::AttributeValue>> attributes;
+  // A set of span Attributes that will also be added to the Span. Can be nullptr. They are not
+  // owned by the result and are added as the span starts, so they must be held by the sampler,
+  // e.g. as a KeyValueIterableView of a std::array member, and no allocation is needed.
+  const trace_api::KeyValueIterable *attributes;
 };
 
 /**
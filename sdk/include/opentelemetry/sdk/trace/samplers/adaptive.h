@@ -0,0 +1,99 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+
+#include "opentelemetry/sdk/trace/sampler.h"
+
+OPENTELEMETRY_BEGIN_NAMESPACE
+namespace sdk
+{
+namespace trace
+{
+namespace trace_api = opentelemetry::trace;
+
+/**
+ * The adaptive sampler keeps the number of sampled traces per second close to a target, however
+ * much traffic there is. It counts the root spans it is asked about, and after every adjustment
+ * interval sets its probability to the target divided by the observed rate of root spans, or 1
+ * if the rate is below the target. Spans with a local parent follow the parent's decision.
+ *
+ * Like the probability sampler, a root span is sampled by comparing the first 8 bytes of its
+ * trace id against a 64-bit threshold, which is published atomically whenever it changes. Root
+ * spans are counted in striped cells, so that threads sampling concurrently never write to the
+ * same cache line, and a thread only reads the clock on every kClockReadInterval-th root span it
+ * counts, to see whether the interval is over. The decision so costs little more than that of
+ * the probability sampler.
+ */
+class AdaptiveSampler : public Sampler
+{
+public:
+  /**
+   * @param target_spans_per_second the number of root spans to sample per second
+   * @param adjustment_interval how often the probability is adjusted to the observed traffic
+   */
+  explicit AdaptiveSampler(
+      double target_spans_per_second,
+      std::chrono::milliseconds adjustment_interval = std::chrono::seconds(1)) noexcept;
+
+  /**
+   * @return Returns either RECORD_AND_SAMPLE or NOT_RECORD based on the parent_context, or on
+   * the trace_id and the current probability for a root span
+   */
+  SamplingResult ShouldSample(const trace_api::SpanContext *parent_context,
+                              trace_api::TraceId trace_id,
+                              nostd::string_view name,
+                              trace_api::SpanKind span_kind,
+                              const trace_api::KeyValueIterable &attributes) noexcept override;
+
+  /**
+   * @return Description MUST be AdaptiveSampler{100.000000}
+   */
+  std::string GetDescription() const noexcept override;
+
+  /**
+   * @return the probability that a root span is currently sampled with
+   */
+  double GetProbability() const noexcept;
+
+  /**
+   * The number of root spans a thread counts between two reads of the clock.
+   */
+  static const uint64_t kClockReadInterval = 64;
+
+  /**
+   * The number of cells root spans are counted in. Threads are assigned cells round-robin.
+   */
+  static const std::size_t kStripeCount = 64;
+
+private:
+  /**
+   * Recompute the threshold if the adjustment interval is over.
+   */
+  void Adjust() noexcept;
+
+  const double target_spans_per_second_;
+  const int64_t adjustment_interval_;
+  const std::string description_;
+
+  // Root spans whose trace id, read as an integer, is at most the threshold are sampled.
+  std::atomic<uint64_t> threshold_;
+
+  // Fills a cache line.
+  struct Stripe
+  {
+    std::atomic<uint64_t> root_spans{0};
+    char padding[64 - sizeof(std::atomic<uint64_t>)];
+  };
+
+  // The number of root spans seen since the current interval started, by stripe.
+  std::unique_ptr<Stripe[]> stripes_;
+
+  // The steady clock time, in nanoseconds, at which the current interval started.
+  std::atomic<int64_t> interval_start_;
+};
+}  // namespace trace
+}  // namespace sdk
+OPENTELEMETRY_END_NAMESPACE
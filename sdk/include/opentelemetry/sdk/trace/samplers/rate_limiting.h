@@ -0,0 +1,71 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+
+#include "opentelemetry/sdk/trace/sampler.h"
+
+OPENTELEMETRY_BEGIN_NAMESPACE
+namespace sdk
+{
+namespace trace
+{
+namespace trace_api = opentelemetry::trace;
+
+/**
+ * The rate limiting sampler samples at most a given number of spans per second, so the volume of
+ * exported spans stays bounded when traffic spikes. Wrap it in a ParentOrElseSampler to limit
+ * traces rather than spans.
+ *
+ * Spans are admitted from a token bucket that holds up to one second worth of tokens. Taking a
+ * token is a single atomic decrement, without a lock. The clock is only read to refill the
+ * bucket once it is empty. Where a coarse monotonic clock is available, which is several times
+ * cheaper to read, rejected spans read it instead, and only read the steady clock once per tick
+ * of the coarse clock.
+ */
+class RateLimitingSampler : public Sampler
+{
+public:
+  /**
+   * @param max_spans_per_second the number of spans sampled per second, at least 1
+   */
+  explicit RateLimitingSampler(double max_spans_per_second) noexcept;
+
+  /**
+   * @return RECORD_AND_SAMPLE if a token was left in the bucket, NOT_RECORD otherwise
+   */
+  SamplingResult ShouldSample(const trace_api::SpanContext *parent_context,
+                              trace_api::TraceId trace_id,
+                              nostd::string_view name,
+                              trace_api::SpanKind span_kind,
+                              const trace_api::KeyValueIterable &attributes) noexcept override;
+
+  /**
+   * @return Description MUST be RateLimitingSampler{100.000000}
+   */
+  std::string GetDescription() const noexcept override;
+
+private:
+  /**
+   * Add the tokens accrued since the last refill to the bucket.
+   * @return whether any tokens were added
+   */
+  bool Refill() noexcept;
+
+  const double max_spans_per_second_;
+  const int64_t capacity_;
+  const std::string description_;
+
+  // The tokens left in the bucket. Once it is empty, every rejected span takes it one further
+  // below zero, until it is refilled from zero.
+  std::atomic<int64_t> tokens_;
+
+  // The steady clock time, in nanoseconds, up to which tokens were added to the bucket.
+  std::atomic<int64_t> refill_time_;
+
+  // The coarse clock time, in nanoseconds, at which the steady clock was last read.
+  std::atomic<int64_t> tick_;
+};
+}  // namespace trace
+}  // namespace sdk
+OPENTELEMETRY_END_NAMESPACE
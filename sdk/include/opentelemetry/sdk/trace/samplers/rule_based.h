@@ -0,0 +1,120 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "opentelemetry/sdk/trace/sampler.h"
+
+OPENTELEMETRY_BEGIN_NAMESPACE
+namespace sdk
+{
+namespace trace
+{
+namespace trace_api = opentelemetry::trace;
+
+/**
+ * A rule of a RuleBasedSampler: the probability that spans matching it are sampled with.
+ */
+struct SamplingRule
+{
+  // The span name to match: an exact name, a prefix followed by '*', or either "*" or an empty
+  // string for any name.
+  std::string span_name;
+
+  // An attribute the span must be started with, whose value is the given string, or an empty
+  // key for no attribute.
+  std::string attribute_key;
+  std::string attribute_value;
+
+  // The probability that a matching span is sampled with, 1.0 >= probability >= 0.0.
+  double probability;
+};
+
+/**
+ * The rule based sampler samples spans with the probability of the first rule they match, e.g.
+ * to never sample health checks but always sample checkouts, and spans that match no rule with
+ * a default probability. Like the probability sampler, a span is sampled by comparing its trace
+ * id against the threshold of the probability. Wrap it in a ParentOrElseSampler so that only
+ * root spans are matched against the rules.
+ *
+ * The rules are compiled once: the span names of rules without an attribute are merged into a
+ * radix trie, whose every node knows the first rule matched by names that end there or that
+ * leave the trie there, and the attributes of the other rules into a sorted table. Matching
+ * walks the trie along the span name and looks every string attribute up in the table, in a
+ * single pass over the attributes, without allocating memory.
+ */
+class RuleBasedSampler : public Sampler
+{
+public:
+  /**
+   * @param rules the rules, in the order they are matched in
+   * @param default_probability the probability for spans that match no rule
+   */
+  RuleBasedSampler(std::vector<SamplingRule> rules, double default_probability);
+
+  /**
+   * @return Returns either RECORD_AND_SAMPLE or NOT_RECORD based on the provided trace_id and
+   * the probability of the first rule matched by name and attributes
+   */
+  SamplingResult ShouldSample(const trace_api::SpanContext *parent_context,
+                              trace_api::TraceId trace_id,
+                              nostd::string_view name,
+                              trace_api::SpanKind span_kind,
+                              const trace_api::KeyValueIterable &attributes) noexcept override;
+
+  /**
+   * @return Description MUST be RuleBasedSampler{rules=3,default=0.010000}
+   */
+  std::string GetDescription() const noexcept override;
+
+  /**
+   * @return the index of the first rule that the span matches, or the number of rules if it
+   * matches none
+   */
+  std::size_t Match(nostd::string_view name,
+                    const trace_api::KeyValueIterable &attributes) const noexcept;
+
+private:
+  struct TrieNode
+  {
+    uint32_t first_edge;
+    uint32_t edge_count;
+
+    // The first rule without an attribute matched by names that end at this node, and by names
+    // that continue with a byte that has no edge.
+    uint32_t end_rule;
+    uint32_t exit_rule;
+  };
+
+  struct TrieEdge
+  {
+    // The first byte of the label, which is a part of labels_.
+    uint8_t byte;
+    uint32_t label_offset;
+    uint32_t label_size;
+    uint32_t child;
+  };
+
+  struct AttributeCondition
+  {
+    std::string key;
+    std::string value;
+
+    // The rules with this attribute, in ascending order.
+    std::vector<uint32_t> rules;
+  };
+
+  bool MatchesName(uint32_t rule, nostd::string_view name) const noexcept;
+
+  const std::vector<SamplingRule> rules_;
+  std::vector<uint64_t> thresholds_;
+  std::vector<TrieNode> nodes_;
+  std::vector<TrieEdge> edges_;
+  std::string labels_;
+  std::vector<AttributeCondition> conditions_;
+  std::string description_;
+};
+}  // namespace trace
+}  // namespace sdk
+OPENTELEMETRY_END_NAMESPACE
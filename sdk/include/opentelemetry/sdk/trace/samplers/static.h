@@ -0,0 +1,151 @@
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <string>
+#include <utility>
+
+#include "opentelemetry/sdk/trace/sampler.h"
+#include "opentelemetry/sdk/trace/samplers/trace_id_ratio.h"
+
+OPENTELEMETRY_BEGIN_NAMESPACE
+namespace sdk
+{
+namespace trace
+{
+namespace trace_api = opentelemetry::trace;
+
+/**
+ * The static samplers make the same decisions as the samplers of the same names, but are
+ * composed at compile time as template arguments of a StaticTracer or of each other. They have
+ * no virtual methods and are defined inline, so that a whole pipeline can be inlined into the
+ * tracer.
+ *
+ * Any type with these ShouldSample and GetDescription methods can be used as a static sampler.
+ */
+class StaticAlwaysOnSampler
+{
+public:
+  /**
+   * @return Always return Decision RECORD_AND_SAMPLE
+   */
+  SamplingResult ShouldSample(const trace_api::SpanContext * /*parent_context*/,
+                              trace_api::TraceId /*trace_id*/,
+                              nostd::string_view /*name*/,
+                              trace_api::SpanKind /*span_kind*/,
+                              const trace_api::KeyValueIterable & /*attributes*/) noexcept
+  {
+    return {Decision::RECORD_AND_SAMPLE, nullptr};
+  }
+
+  /**
+   * @return Description MUST be AlwaysOnSampler
+   */
+  std::string GetDescription() const noexcept { return "AlwaysOnSampler"; }
+};
+
+class StaticAlwaysOffSampler
+{
+public:
+  /**
+   * @return Always return Decision NOT_RECORD
+   */
+  SamplingResult ShouldSample(const trace_api::SpanContext * /*parent_context*/,
+                              trace_api::TraceId /*trace_id*/,
+                              nostd::string_view /*name*/,
+                              trace_api::SpanKind /*span_kind*/,
+                              const trace_api::KeyValueIterable & /*attributes*/) noexcept
+  {
+    return {Decision::NOT_RECORD, nullptr};
+  }
+
+  /**
+   * @return Description MUST be AlwaysOffSampler
+   */
+  std::string GetDescription() const noexcept { return "AlwaysOffSampler"; }
+};
+
+class StaticProbabilitySampler
+{
+public:
+  /**
+   * @param probability the share of traces to sample, 1.0 >= probability >= 0.0
+   */
+  explicit StaticProbabilitySampler(double probability) noexcept
+      : probability_(std::min(std::max(probability, 0.0), 1.0)),
+        threshold_(GetProbabilityThreshold(probability))
+  {}
+
+  /**
+   * @return Returns the decision of a local parent, or otherwise either RECORD_AND_SAMPLE or
+   * NOT_RECORD based on the trace id and the threshold of the probability
+   */
+  SamplingResult ShouldSample(const trace_api::SpanContext *parent_context,
+                              trace_api::TraceId trace_id,
+                              nostd::string_view /*name*/,
+                              trace_api::SpanKind /*span_kind*/,
+                              const trace_api::KeyValueIterable & /*attributes*/) noexcept
+  {
+    if (parent_context != nullptr && !parent_context->HasRemoteParent())
+    {
+      return {parent_context->IsSampled() ? Decision::RECORD_AND_SAMPLE : Decision::NOT_RECORD,
+              nullptr};
+    }
+    bool sampled = (GetTraceIdRatioBits(trace_id) <= threshold_) & (threshold_ != 0);
+    return {sampled ? Decision::RECORD_AND_SAMPLE : Decision::NOT_RECORD, nullptr};
+  }
+
+  /**
+   * @return Description MUST be ProbabilitySampler{0.000100}
+   */
+  std::string GetDescription() const noexcept
+  {
+    return "ProbabilitySampler{" + std::to_string(probability_) + "}";
+  }
+
+private:
+  double probability_;
+  uint64_t threshold_;
+};
+
+/**
+ * Respects the sampling decision of the parent span, and delegates to DelegateSampler for root
+ * spans.
+ */
+template <class DelegateSampler>
+class StaticParentOrElseSampler
+{
+public:
+  explicit StaticParentOrElseSampler(DelegateSampler delegate_sampler = DelegateSampler()) noexcept
+      : delegate_sampler_(std::move(delegate_sampler))
+  {}
+
+  SamplingResult ShouldSample(const trace_api::SpanContext *parent_context,
+                              trace_api::TraceId trace_id,
+                              nostd::string_view name,
+                              trace_api::SpanKind span_kind,
+                              const trace_api::KeyValueIterable &attributes) noexcept
+  {
+    if (parent_context == nullptr)
+    {
+      return delegate_sampler_.ShouldSample(parent_context, trace_id, name, span_kind,
+                                            attributes);
+    }
+    return {parent_context->IsSampled() ? Decision::RECORD_AND_SAMPLE : Decision::NOT_RECORD,
+            nullptr};
+  }
+
+  /**
+   * @return Description MUST be ParentOrElse{delegate_sampler_.getDescription()}
+   */
+  std::string GetDescription() const noexcept
+  {
+    return "ParentOrElse{" + delegate_sampler_.GetDescription() + "}";
+  }
+
+private:
+  DelegateSampler delegate_sampler_;
+};
+}  // namespace trace
+}  // namespace sdk
+OPENTELEMETRY_END_NAMESPACE
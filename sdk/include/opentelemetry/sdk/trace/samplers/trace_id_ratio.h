@@ -0,0 +1,56 @@
+#pragma once
+
+#include <cmath>
+#include <cstdint>
+
+#include "opentelemetry/trace/trace_id.h"
+#include "opentelemetry/version.h"
+
+OPENTELEMETRY_BEGIN_NAMESPACE
+namespace sdk
+{
+namespace trace
+{
+/**
+ * Samplers that sample a share of traces compare the first 8 bytes of the trace id, read as a
+ * little-endian integer on every platform, against a threshold. A trace is sampled if the
+ * integer is at most the threshold, so every sampler configured with the same probability makes
+ * the same decision for a trace, in every process.
+ *
+ * @param trace_id the trace id of a span
+ * @return the integer compared against the threshold
+ */
+inline uint64_t GetTraceIdRatioBits(const opentelemetry::trace::TraceId &trace_id) noexcept
+{
+  static_assert(opentelemetry::trace::TraceId::kSize >= 8,
+                "TraceID must be at least 8 bytes long.");
+  const uint8_t *bytes = trace_id.Id().data();
+  uint64_t bits        = 0;
+  for (int i = 7; i >= 0; --i)
+  {
+    bits = (bits << 8) | bytes[i];
+  }
+  return bits;
+}
+
+/**
+ * @param probability the share of traces to sample, 1.0 >= probability >= 0.0
+ * @return the threshold, exactly probability * 2^64, or UINT64_MAX for a probability of 1. A
+ * threshold of 0 samples no trace at all.
+ */
+inline uint64_t GetProbabilityThreshold(double probability) noexcept
+{
+  if (probability <= 0.0)
+  {
+    return 0;
+  }
+  if (probability >= 1.0)
+  {
+    return UINT64_MAX;
+  }
+  // Scaling by a power of two is exact, and the result is below 2^64.
+  return static_cast<uint64_t>(std::ldexp(probability, 64));
+}
+}  // namespace trace
+}  // namespace sdk
+OPENTELEMETRY_END_NAMESPACE
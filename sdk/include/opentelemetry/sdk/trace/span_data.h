@@ -1,10 +1,15 @@
 #pragma once
 
 #include <chrono>
+#include <cstddef>
+#include <forward_list>
+#include <string>
 #include <unordered_map>
+#include <utility>
 #include <vector>
 #include "opentelemetry/core/timestamp.h"
 #include "opentelemetry/nostd/string_view.h"
+#include "opentelemetry/sdk/trace/attribute_key_table.h"
 #include "opentelemetry/sdk/trace/recordable.h"
 #include "opentelemetry/trace/canonical_code.h"
 #include "opentelemetry/trace/span_id.h"
@@ -84,12 +89,148 @@ struct AttributeConverter
   }
 };
 
+/**
+ * The attributes of a SpanData, keyed by views of the keys interned in the global
+ * AttributeKeyTable, so that a key is not copied for every span. Keys that the table is too full
+ * to intern are viewed in copies owned by the SpanData.
+ */
+using SpanDataAttributes =
+    std::unordered_map<nostd::string_view, SpanDataAttributeValue, AttributeKeyHash>;
+
+/**
+ * An event of a SpanData. Its attributes are kept in a single vector, keyed by views of the keys
+ * interned in the global AttributeKeyTable, or of copies owned by the event if the table is full.
+ */
+class SpanDataEvent
+{
+public:
+  SpanDataEvent() = default;
+
+  /**
+   * Copies an event, viewing its attribute keys in the global AttributeKeyTable or in copies of
+   * its own, rather than in those owned by the original.
+   */
+  SpanDataEvent(const SpanDataEvent &other) noexcept
+      : name_{other.name_}, timestamp_{other.timestamp_}
+  {
+    attributes_.reserve(other.attributes_.size());
+    for (auto &attribute : other.attributes_)
+    {
+      attributes_.emplace_back(GetKey(attribute.first), attribute.second);
+    }
+  }
+
+  // Moving keeps the owned attribute keys where they are.
+  SpanDataEvent(SpanDataEvent &&) = default;
+  SpanDataEvent &operator=(SpanDataEvent &&) = default;
+
+  /**
+   * Get the name of this event
+   * @return the name of this event
+   */
+  nostd::string_view GetName() const noexcept { return name_; }
+
+  /**
+   * Get the timestamp of this event
+   * @return the timestamp of this event
+   */
+  core::SystemTimestamp GetTimestamp() const noexcept { return timestamp_; }
+
+  /**
+   * Get the attributes of this event
+   * @return the attributes of this event, in the order they were added in
+   */
+  const std::vector<std::pair<nostd::string_view, SpanDataAttributeValue>> &GetAttributes()
+      const noexcept
+  {
+    return attributes_;
+  }
+
+  /**
+   * Replace the name, timestamp and attributes of this event, reusing its storage.
+   */
+  void Assign(nostd::string_view name,
+              core::SystemTimestamp timestamp,
+              const trace_api::KeyValueIterable &attributes) noexcept
+  {
+    name_.assign(name.data(), name.size());
+    timestamp_ = timestamp;
+    attributes_.clear();
+    owned_keys_.clear();
+    attributes_.reserve(attributes.size());
+    attributes.ForEachKeyValue([this](nostd::string_view key,
+                                      common::AttributeValue value) noexcept {
+      attributes_.emplace_back(GetKey(key), nostd::visit(AttributeConverter{}, value));
+      return true;
+    });
+  }
+
+private:
+  nostd::string_view GetKey(nostd::string_view key) noexcept
+  {
+    auto interned = AttributeKeyTable::GetGlobal().Intern(key);
+    if (interned.data() == nullptr)
+    {
+      owned_keys_.emplace_front(key.data(), key.size());
+      interned = owned_keys_.front();
+    }
+    return interned;
+  }
+
+  std::forward_list<std::string> owned_keys_;
+  std::string name_;
+  core::SystemTimestamp timestamp_;
+  std::vector<std::pair<nostd::string_view, SpanDataAttributeValue>> attributes_;
+};
+
 /**
  * SpanData is a representation of all data collected by a span.
  */
 class SpanData final : public Recordable
 {
 public:
+  /**
+   * The default maximum number of events of a span.
+   */
+  static const std::size_t kDefaultMaxEvents = 128;
+
+  /**
+   * @param max_events the maximum number of events kept, after which every event that is added
+   * replaces the oldest one
+   */
+  explicit SpanData(std::size_t max_events = kDefaultMaxEvents) noexcept : max_events_{max_events}
+  {}
+
+  /**
+   * Copies a span, viewing its attribute keys in the global AttributeKeyTable or in copies of
+   * its own, rather than in those owned by the original.
+   */
+  SpanData(const SpanData &other) noexcept
+      : trace_id_{other.trace_id_},
+        span_id_{other.span_id_},
+        parent_span_id_{other.parent_span_id_},
+        start_time_{other.start_time_},
+        duration_{other.duration_},
+        name_{other.name_},
+        span_kind_{other.span_kind_},
+        status_code_{other.status_code_},
+        status_desc_{other.status_desc_},
+        max_events_{other.max_events_},
+        events_{other.events_},
+        first_event_{other.first_event_},
+        dropped_events_{other.dropped_events_}
+  {
+    attributes_.reserve(other.attributes_.size());
+    for (auto &attribute : other.attributes_)
+    {
+      SetAttributeValue(attribute.first, SpanDataAttributeValue(attribute.second));
+    }
+  }
+
+  // Moving keeps the owned attribute keys where they are.
+  SpanData(SpanData &&) = default;
+  SpanData &operator=(SpanData &&) = default;
+
   /**
    * Get the trace id for this span
    * @return the trace id for this span
@@ -114,6 +255,12 @@ class SpanData final : public Recordable
    */
   opentelemetry::nostd::string_view GetName() const noexcept { return name_; }
 
+  /**
+   * Get the kind of this span
+   * @return the kind of this span
+   */
+  opentelemetry::trace::SpanKind GetSpanKind() const noexcept { return span_kind_; }
+
   /**
    * Get the status for this span
    * @return the status for this span
@@ -142,11 +289,66 @@ class SpanData final : public Recordable
    * Get the attributes for this span
    * @return the attributes for this span
    */
-  const std::unordered_map<std::string, SpanDataAttributeValue> &GetAttributes() const noexcept
+  const SpanDataAttributes &GetAttributes() const noexcept
   {
     return attributes_;
   }
 
+  /**
+   * Get the number of events of this span, at most the maximum it was created with
+   * @return the number of events of this span
+   */
+  std::size_t GetEventCount() const noexcept { return events_.size(); }
+
+  /**
+   * Get an event of this span
+   * @param index the index of the event, from 0 for the oldest to GetEventCount() - 1 for the
+   * newest
+   * @return the event
+   */
+  const SpanDataEvent &GetEvent(std::size_t index) const noexcept
+  {
+    return events_[(first_event_ + index) % events_.size()];
+  }
+
+  /**
+   * Get the number of events that were dropped, as the maximum was exceeded
+   * @return the number of events dropped
+   */
+  std::size_t GetDroppedEventCount() const noexcept { return dropped_events_; }
+
+  void Init(const SpanStartData &data) noexcept override
+  {
+    trace_id_       = data.trace_id;
+    span_id_        = data.span_id;
+    parent_span_id_ = data.parent_span_id;
+    name_.assign(data.name.data(), data.name.size());
+    span_kind_  = data.span_kind;
+    start_time_ = data.start_time;
+
+    // Size the attributes once, for both sets of attributes.
+    std::size_t size = 0;
+    size += data.attributes != nullptr ? data.attributes->size() : 0;
+    size += data.sampling_attributes != nullptr ? data.sampling_attributes->size() : 0;
+    if (size == 0)
+    {
+      return;
+    }
+    attributes_.reserve(size);
+    auto set_attribute = [this](nostd::string_view key, common::AttributeValue value) noexcept {
+      SetAttributeValue(key, nostd::visit(converter_, value));
+      return true;
+    };
+    if (data.attributes != nullptr)
+    {
+      data.attributes->ForEachKeyValue(set_attribute);
+    }
+    if (data.sampling_attributes != nullptr)
+    {
+      data.sampling_attributes->ForEachKeyValue(set_attribute);
+    }
+  }
+
   void SetIds(opentelemetry::trace::TraceId trace_id,
               opentelemetry::trace::SpanId span_id,
               opentelemetry::trace::SpanId parent_span_id) noexcept override
@@ -158,13 +360,27 @@ class SpanData final : public Recordable
 
   void SetAttribute(nostd::string_view key, const common::AttributeValue &value) noexcept override
   {
-    attributes_[std::string(key)] = nostd::visit(converter_, value);
+    SetAttributeValue(key, nostd::visit(converter_, value));
   }
 
-  void AddEvent(nostd::string_view name, core::SystemTimestamp timestamp) noexcept override
+  void AddEvent(nostd::string_view name,
+                core::SystemTimestamp timestamp,
+                const trace_api::KeyValueIterable &attributes) noexcept override
   {
-    (void)name;
-    (void)timestamp;
+    if (events_.size() < max_events_)
+    {
+      events_.emplace_back();
+      events_.back().Assign(name, timestamp, attributes);
+      return;
+    }
+    ++dropped_events_;
+    if (max_events_ == 0)
+    {
+      return;
+    }
+    // The events are a ring once full: the oldest is overwritten, reusing its storage.
+    events_[first_event_].Assign(name, timestamp, attributes);
+    first_event_ = (first_event_ + 1) % max_events_;
   }
 
   void SetStatus(trace_api::CanonicalCode code, nostd::string_view description) noexcept override
@@ -175,6 +391,8 @@ class SpanData final : public Recordable
 
   void SetName(nostd::string_view name) noexcept override { name_ = std::string(name); }
 
+  void SetSpanKind(trace_api::SpanKind span_kind) noexcept override { span_kind_ = span_kind; }
+
   void SetStartTime(opentelemetry::core::SystemTimestamp start_time) noexcept override
   {
     start_time_ = start_time;
@@ -183,15 +401,39 @@ class SpanData final : public Recordable
   void SetDuration(std::chrono::nanoseconds duration) noexcept override { duration_ = duration; }
 
 private:
+  void SetAttributeValue(nostd::string_view key, SpanDataAttributeValue &&value) noexcept
+  {
+    auto interned = AttributeKeyTable::GetGlobal().Intern(key);
+    if (interned.data() == nullptr)
+    {
+      // The table is full: the key is copied, once per span.
+      auto it = attributes_.find(key);
+      if (it != attributes_.end())
+      {
+        it->second = std::move(value);
+        return;
+      }
+      owned_keys_.emplace_front(key.data(), key.size());
+      interned = owned_keys_.front();
+    }
+    attributes_[interned] = std::move(value);
+  }
+
   opentelemetry::trace::TraceId trace_id_;
   opentelemetry::trace::SpanId span_id_;
   opentelemetry::trace::SpanId parent_span_id_;
   core::SystemTimestamp start_time_;
   std::chrono::nanoseconds duration_{0};
   std::string name_;
+  opentelemetry::trace::SpanKind span_kind_{opentelemetry::trace::SpanKind::kInternal};
   opentelemetry::trace::CanonicalCode status_code_{opentelemetry::trace::CanonicalCode::OK};
   std::string status_desc_;
-  std::unordered_map<std::string, SpanDataAttributeValue> attributes_;
+  std::forward_list<std::string> owned_keys_;
+  SpanDataAttributes attributes_;
+  std::size_t max_events_;
+  std::vector<SpanDataEvent> events_;
+  std::size_t first_event_{0};
+  std::size_t dropped_events_{0};
   AttributeConverter converter_;
 };
 }  // namespace trace
@@ -0,0 +1,73 @@
+#pragma once
+
+#include <chrono>
+#include <utility>
+
+#include "opentelemetry/nostd/span.h"
+#include "opentelemetry/sdk/trace/exporter.h"
+
+OPENTELEMETRY_BEGIN_NAMESPACE
+namespace sdk
+{
+namespace trace
+{
+/**
+ * The static simple span processor passes finished recordables to its exporter as soon as they
+ * are finished, like the simple span processor, but is composed at compile time as the template
+ * argument of a StaticTracer.
+ *
+ * A static processor is any type with these members, none of them virtual:
+ *  - a recordable_type, which is default constructible, movable and has the methods of a
+ *    Recordable, e.g. SpanData. Spans of a StaticTracer hold it by value.
+ *  - OnStart(recordable_type &), OnEnd(recordable_type &&), ForceFlush and Shutdown, like the
+ *    methods of a SpanProcessor.
+ *
+ * The Exporter is in turn any type with a recordable_type, a method
+ * ExportResult Export(const nostd::span<recordable_type> &) and a method Shutdown, like the
+ * methods of a SpanExporter.
+ */
+template <class Exporter>
+class StaticSimpleSpanProcessor
+{
+public:
+  using recordable_type = typename Exporter::recordable_type;
+
+  /**
+   * Initialize a static simple span processor.
+   * @param exporter the exporter used by the span processor
+   */
+  explicit StaticSimpleSpanProcessor(Exporter exporter = Exporter()) noexcept
+      : exporter_(std::move(exporter))
+  {}
+
+  void OnStart(recordable_type & /*span*/) noexcept {}
+
+  void OnEnd(recordable_type &&span) noexcept
+  {
+    nostd::span<recordable_type> batch(&span, 1);
+    if (exporter_.Export(batch) == ExportResult::kFailure)
+    {
+      /* Once it is defined how the SDK does logging, an error should be
+       * logged in this case. */
+    }
+  }
+
+  void ForceFlush(std::chrono::microseconds /*timeout*/ = std::chrono::microseconds(0)) noexcept
+  {}
+
+  void Shutdown(std::chrono::microseconds timeout = std::chrono::microseconds(0)) noexcept
+  {
+    exporter_.Shutdown(timeout);
+  }
+
+  /**
+   * @return the exporter of this processor
+   */
+  Exporter &GetExporter() noexcept { return exporter_; }
+
+private:
+  Exporter exporter_;
+};
+}  // namespace trace
+}  // namespace sdk
+OPENTELEMETRY_END_NAMESPACE
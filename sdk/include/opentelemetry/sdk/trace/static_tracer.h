@@ -0,0 +1,212 @@
+#pragma once
+
+#include <chrono>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <utility>
+
+#include "opentelemetry/sdk/trace/tracer.h"
+
+OPENTELEMETRY_BEGIN_NAMESPACE
+namespace sdk
+{
+namespace trace
+{
+namespace trace_api = opentelemetry::trace;
+
+/**
+ * A tracer whose sampler and span processor are fixed at compile time, e.g.
+ * StaticTracer<StaticParentOrElseSampler<StaticProbabilitySampler>,
+ *              StaticSimpleSpanProcessor<MyExporter>>.
+ *
+ * It implements the trace_api::Tracer interface, but unlike the Tracer it holds its sampler and
+ * processor by value and calls them without virtual calls, so that the compiler can inline the
+ * whole pipeline from StartSpan to the exporter. Its spans hold their recordable by value instead
+ * of allocating it. The sampler and processor can't be replaced at runtime.
+ *
+ * The SamplerT is any type with the ShouldSample method of a Sampler, e.g. one of the static
+ * samplers, and the ProcessorT any type with the methods of a static processor, like the
+ * StaticSimpleSpanProcessor.
+ */
+template <class SamplerT, class ProcessorT>
+class StaticTracer final : public trace_api::Tracer,
+                           public std::enable_shared_from_this<StaticTracer<SamplerT, ProcessorT>>
+{
+public:
+  using recordable_type = typename ProcessorT::recordable_type;
+
+  /**
+   * Initialize a new static tracer.
+   * @param sampler the sampler of this tracer
+   * @param processor the span processor of this tracer
+   */
+  explicit StaticTracer(SamplerT sampler = SamplerT(), ProcessorT processor = ProcessorT()) noexcept
+      : sampler_(std::move(sampler)), processor_(std::move(processor))
+  {}
+
+  /**
+   * Obtain the sampler associated with this tracer.
+   * @return The sampler for this tracer.
+   */
+  SamplerT &GetSampler() noexcept { return sampler_; }
+
+  /**
+   * Obtain the span processor associated with this tracer.
+   * @return The span processor for this tracer.
+   */
+  ProcessorT &GetProcessor() noexcept { return processor_; }
+
+  nostd::unique_ptr<trace_api::Span> StartSpan(
+      nostd::string_view name,
+      const trace_api::KeyValueIterable &attributes,
+      const trace_api::StartSpanOptions &options = {}) noexcept override
+  {
+    auto trace_id        = GenerateTraceId();
+    auto sampling_result = sampler_.ShouldSample(nullptr, trace_id, name, options.kind, attributes);
+    if (sampling_result.decision == Decision::NOT_RECORD)
+    {
+      return nostd::unique_ptr<trace_api::Span>{
+          new (std::nothrow) trace_api::NoopSpan{this->shared_from_this()}};
+    }
+    return nostd::unique_ptr<trace_api::Span>{
+        new (std::nothrow) Span{this->shared_from_this(), name, attributes,
+                                sampling_result.attributes, options, trace_id, GenerateSpanId()}};
+  }
+
+  void ForceFlushWithMicroseconds(uint64_t timeout) noexcept override
+  {
+    processor_.ForceFlush(std::chrono::microseconds(timeout));
+  }
+
+  void CloseWithMicroseconds(uint64_t timeout) noexcept override
+  {
+    processor_.Shutdown(std::chrono::microseconds(timeout));
+  }
+
+private:
+  class Span final : public trace_api::Span
+  {
+  public:
+    Span(std::shared_ptr<StaticTracer> &&tracer,
+         nostd::string_view name,
+         const trace_api::KeyValueIterable &attributes,
+         const trace_api::KeyValueIterable *sampling_attributes,
+         const trace_api::StartSpanOptions &options,
+         trace_api::TraceId trace_id,
+         trace_api::SpanId span_id) noexcept
+        : tracer_{std::move(tracer)}
+    {
+      // Spans do not have a parent context yet, so every span is the root of its trace.
+      SpanStartData data = {trace_id,
+                            span_id,
+                            trace_api::SpanId(),
+                            name,
+                            options.kind,
+                            &attributes,
+                            sampling_attributes,
+                            options.start_system_time == core::SystemTimestamp()
+                                ? core::SystemTimestamp(std::chrono::system_clock::now())
+                                : options.start_system_time};
+      recordable_.Init(data);
+      start_steady_time_ = options.start_steady_time == core::SteadyTimestamp()
+                               ? core::SteadyTimestamp(std::chrono::steady_clock::now())
+                               : options.start_steady_time;
+
+      // Processors get to see the span's name, attributes and start time.
+      tracer_->processor_.OnStart(recordable_);
+    }
+
+    ~Span() override { End(); }
+
+    void SetAttribute(nostd::string_view key,
+                      const opentelemetry::common::AttributeValue &value) noexcept override
+    {
+      std::lock_guard<std::mutex> lock_guard{mu_};
+      if (recording_)
+      {
+        recordable_.SetAttribute(key, value);
+      }
+    }
+
+    void AddEvent(nostd::string_view name) noexcept override
+    {
+      AddEvent(name, core::SystemTimestamp(std::chrono::system_clock::now()));
+    }
+
+    void AddEvent(nostd::string_view name, core::SystemTimestamp timestamp) noexcept override
+    {
+      using NoAttributes =
+          nostd::span<const std::pair<nostd::string_view, opentelemetry::common::AttributeValue>>;
+      AddEvent(name, timestamp, trace_api::KeyValueIterableView<NoAttributes>(NoAttributes{}));
+    }
+
+    void AddEvent(nostd::string_view name,
+                  core::SystemTimestamp timestamp,
+                  const trace_api::KeyValueIterable &attributes) noexcept override
+    {
+      std::lock_guard<std::mutex> lock_guard{mu_};
+      if (recording_)
+      {
+        recordable_.AddEvent(name, timestamp, attributes);
+      }
+    }
+
+    void SetStatus(trace_api::CanonicalCode code, nostd::string_view description) noexcept override
+    {
+      std::lock_guard<std::mutex> lock_guard{mu_};
+      if (recording_)
+      {
+        recordable_.SetStatus(code, description);
+      }
+    }
+
+    void UpdateName(nostd::string_view name) noexcept override
+    {
+      std::lock_guard<std::mutex> lock_guard{mu_};
+      if (recording_)
+      {
+        recordable_.SetName(name);
+      }
+    }
+
+    void End(const trace_api::EndSpanOptions &options = {}) noexcept override
+    {
+      std::lock_guard<std::mutex> lock_guard{mu_};
+      if (!recording_)
+      {
+        return;
+      }
+      recording_ = false;
+
+      auto end_steady_time = options.end_steady_time == core::SteadyTimestamp()
+                                 ? core::SteadyTimestamp(std::chrono::steady_clock::now())
+                                 : options.end_steady_time;
+      recordable_.SetDuration(std::chrono::steady_clock::time_point(end_steady_time) -
+                              std::chrono::steady_clock::time_point(start_steady_time_));
+
+      tracer_->processor_.OnEnd(std::move(recordable_));
+    }
+
+    bool IsRecording() const noexcept override
+    {
+      std::lock_guard<std::mutex> lock_guard{mu_};
+      return recording_;
+    }
+
+    trace_api::Tracer &tracer() const noexcept override { return *tracer_; }
+
+  private:
+    std::shared_ptr<StaticTracer> tracer_;
+    mutable std::mutex mu_;
+    bool recording_ = true;
+    recordable_type recordable_;
+    core::SteadyTimestamp start_steady_time_;
+  };
+
+  SamplerT sampler_;
+  ProcessorT processor_;
+};
+}  // namespace trace
+}  // namespace sdk
+OPENTELEMETRY_END_NAMESPACE
@@ -0,0 +1,154 @@
+#pragma once
+
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <thread>
+
+#include "opentelemetry/sdk/trace/processor.h"
+#include "opentelemetry/sdk/trace/recordable.h"
+
+OPENTELEMETRY_BEGIN_NAMESPACE
+namespace sdk
+{
+namespace trace
+{
+/**
+ * The policies and limits of a tail sampling span processor.
+ */
+struct TailSamplingOptions
+{
+  /**
+   * How long the spans of a trace are buffered, counted from its first ended span, before a
+   * decision is made without its local root.
+   */
+  std::chrono::milliseconds decision_wait = std::chrono::seconds(30);
+
+  /**
+   * How often a background thread decides the traces of every shard whose decision wait ran
+   * out, so a trace is decided within this long after its decision wait even if no other span
+   * ends. Zero disables the thread.
+   */
+  std::chrono::milliseconds sweep_interval = std::chrono::seconds(1);
+
+  /**
+   * The maximum number of buffered spans. Once it is exceeded, the oldest traces are decided
+   * early with the spans they have.
+   */
+  std::size_t max_buffered_spans = 100000;
+
+  /**
+   * Keep every trace with a span whose status is not OK.
+   */
+  bool keep_errors = true;
+
+  /**
+   * Keep every trace with a span that lasted at least this long. Zero disables the policy.
+   */
+  std::chrono::nanoseconds latency_threshold = std::chrono::nanoseconds(0);
+
+  /**
+   * Keep this fraction of the remaining traces, chosen by trace id.
+   */
+  double probability = 0;
+};
+
+/**
+ * The tail sampling span processor decides whether to keep a trace once it has seen all of its
+ * spans, so that e.g. every trace with an error or a slow span is kept, unlike with a sampler,
+ * which decides when a span starts.
+ *
+ * Ended spans are buffered by trace id until the local root of the trace, the span without a
+ * parent, ends, or until the decision wait of the trace runs out. The trace is then kept if any
+ * policy of the options matches it, and only the spans of kept traces are passed on to another
+ * processor, e.g. a SimpleSpanProcessor. Spans that end after their trace was decided follow
+ * the decision, as long as it is still remembered.
+ *
+ * Buffered traces are spread over shards by trace id, each with its own lock, so spans of
+ * different traces rarely contend. Timed out traces are decided when another span of the same
+ * shard ends, and by a background thread that sweeps every shard at the sweep interval, and
+ * ForceFlush decides every buffered trace.
+ */
+class TailSamplingSpanProcessor : public SpanProcessor
+{
+public:
+  /**
+   * Initialize a tail sampling span processor.
+   * @param processor the processor to pass the spans of kept traces on to
+   * @param options the sampling policies and limits
+   */
+  explicit TailSamplingSpanProcessor(std::shared_ptr<SpanProcessor> processor,
+                                     const TailSamplingOptions &options = {}) noexcept;
+
+  /**
+   * Stops the background thread, without deciding the buffered traces.
+   */
+  ~TailSamplingSpanProcessor() override;
+
+  /**
+   * Create a recordable of the downstream processor, wrapped so that what the policies need is
+   * kept.
+   */
+  std::unique_ptr<Recordable> MakeRecordable() noexcept override;
+
+  void OnStart(Recordable &span) noexcept override;
+
+  /**
+   * Buffer the span with its trace, and decide the trace if the span is its local root.
+   */
+  void OnEnd(std::unique_ptr<Recordable> &&span) noexcept override;
+
+  /**
+   * Decide every buffered trace, then flush the downstream processor.
+   */
+  void ForceFlush(
+      std::chrono::microseconds timeout = std::chrono::microseconds(0)) noexcept override;
+
+  /**
+   * Stop the background thread, decide every buffered trace, then shut down the downstream
+   * processor.
+   */
+  void Shutdown(
+      std::chrono::microseconds timeout = std::chrono::microseconds(0)) noexcept override;
+
+  /**
+   * @return the number of spans waiting for the decision of their trace
+   */
+  std::size_t GetBufferedSpanCount() const noexcept;
+
+private:
+  struct Shard;
+
+  static const std::size_t kShardCount = 64;
+
+  bool ShouldKeep(opentelemetry::trace::TraceId trace_id,
+                  bool has_error,
+                  std::chrono::nanoseconds max_duration) const noexcept;
+
+  /**
+   * Decide the traces of every shard whose decision wait ran out.
+   */
+  void DecideTimedOutTraces() noexcept;
+
+  void RunSweeper() noexcept;
+
+  void StopSweeper() noexcept;
+
+  const std::shared_ptr<SpanProcessor> processor_;
+  const TailSamplingOptions options_;
+  const std::size_t max_buffered_spans_per_shard_;
+  const uint64_t probability_threshold_;
+  std::unique_ptr<Shard[]> shards_;
+
+  // Guards the state of the background thread.
+  std::mutex sweeper_mutex_;
+  std::condition_variable sweeper_cv_;
+  std::thread sweeper_;
+  bool is_stopping_ = false;
+};
+}  // namespace trace
+}  // namespace sdk
+OPENTELEMETRY_END_NAMESPACE
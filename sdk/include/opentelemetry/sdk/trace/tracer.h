@@ -7,6 +7,7 @@
 #include "opentelemetry/trace/noop.h"
 #include "opentelemetry/version.h"
 
+#include <cstddef>
 #include <memory>
 
 OPENTELEMETRY_BEGIN_NAMESPACE
@@ -14,6 +15,16 @@ namespace sdk
 {
 namespace trace
 {
+/**
+ * @return a new random trace id
+ */
+trace_api::TraceId GenerateTraceId() noexcept;
+
+/**
+ * @return a new random span id
+ */
+trace_api::SpanId GenerateSpanId() noexcept;
+
 class Tracer final : public trace_api::Tracer, public std::enable_shared_from_this<Tracer>
 {
 public:
@@ -44,16 +55,39 @@ class Tracer final : public trace_api::Tracer, public std::enable_shared_from_th
    */
   std::shared_ptr<Sampler> GetSampler() const noexcept;
 
+  /**
+   * Starts a span. Spans do not have a parent context yet, so every span starts a new trace,
+   * with a new trace id: processors that group spans by trace, such as
+   * TailSamplingSpanProcessor, only see traces of a single span for now.
+   */
   nostd::unique_ptr<trace_api::Span> StartSpan(
       nostd::string_view name,
       const trace_api::KeyValueIterable &attributes,
       const trace_api::StartSpanOptions &options = {}) noexcept override;
 
+  /**
+   * Starts a span in the storage, if it fits, and only allocates the recordable of the span, or
+   * nothing at all if the span is sampled out.
+   */
+  trace_api::Span *StartSpanInStorage(nostd::string_view name,
+                                      const trace_api::KeyValueIterable &attributes,
+                                      const trace_api::StartSpanOptions &options,
+                                      void *storage,
+                                      std::size_t storage_size) noexcept override;
+
   void ForceFlushWithMicroseconds(uint64_t timeout) noexcept override;
 
   void CloseWithMicroseconds(uint64_t timeout) noexcept override;
 
 private:
+  /**
+   * Starts a span in the storage, or on the heap if the storage is nullptr.
+   */
+  trace_api::Span *StartSpan(nostd::string_view name,
+                             const trace_api::KeyValueIterable &attributes,
+                             const trace_api::StartSpanOptions &options,
+                             void *storage) noexcept;
+
   opentelemetry::sdk::AtomicSharedPtr<SpanProcessor> processor_;
   const std::shared_ptr<Sampler> sampler_;
 };
@@ -0,0 +1,95 @@
+#include "opentelemetry/sdk/metrics/controller.h"
+
+OPENTELEMETRY_BEGIN_NAMESPACE
+namespace sdk
+{
+namespace metrics
+{
+PushController::PushController(std::shared_ptr<Meter> meter,
+                               std::unique_ptr<MetricExporter> &&exporter,
+                               std::chrono::milliseconds interval,
+                               std::size_t max_idle_collections) noexcept
+    : meter_{std::move(meter)},
+      exporter_{std::move(exporter)},
+      interval_{interval},
+      max_idle_collections_{max_idle_collections},
+      temporality_{exporter_->GetAggregationTemporality()},
+      start_time_{std::chrono::system_clock::now()},
+      last_collection_time_{start_time_}
+{}
+
+PushController::~PushController()
+{
+  Stop();
+}
+
+bool PushController::Start() noexcept
+{
+  std::lock_guard<std::mutex> lock(mtx_);
+  if (is_started_ || is_shutdown_)
+  {
+    return false;
+  }
+  is_started_ = true;
+  thread_     = std::thread(&PushController::Run, this);
+  return true;
+}
+
+void PushController::Stop() noexcept
+{
+  {
+    std::lock_guard<std::mutex> lock(mtx_);
+    if (is_shutdown_)
+    {
+      return;
+    }
+    is_shutdown_ = true;
+    is_stopping_ = true;
+  }
+  cv_.notify_all();
+  if (thread_.joinable())
+  {
+    thread_.join();
+  }
+
+  // Export what was recorded since the last collection.
+  Collect();
+  exporter_->Shutdown();
+}
+
+void PushController::Collect() noexcept
+{
+  std::lock_guard<std::mutex> lock(collect_mtx_);
+  records_.clear();
+  meter_->Collect(records_, temporality_, max_idle_collections_);
+  core::SystemTimestamp now = std::chrono::system_clock::now();
+  exporter_->Export(records_,
+                    temporality_ == AggregationTemporality::Delta ? last_collection_time_
+                                                                   : start_time_,
+                    now);
+  last_collection_time_ = now;
+}
+
+void PushController::Run() noexcept
+{
+  auto next_collection = std::chrono::steady_clock::now() + interval_;
+  std::unique_lock<std::mutex> lock(mtx_);
+  while (!cv_.wait_until(lock, next_collection, [this] { return is_stopping_; }))
+  {
+    lock.unlock();
+    Collect();
+    lock.lock();
+
+    // Collections keep a fixed rate; if one took longer than the interval, the missed ones are
+    // skipped rather than run back to back.
+    next_collection += interval_;
+    auto now = std::chrono::steady_clock::now();
+    if (next_collection < now)
+    {
+      next_collection = now + interval_;
+    }
+  }
+}
+}  // namespace metrics
+}  // namespace sdk
+OPENTELEMETRY_END_NAMESPACE
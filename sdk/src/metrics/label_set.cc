@@ -0,0 +1,234 @@
+#include "opentelemetry/sdk/metrics/label_set.h"
+
+#include <algorithm>
+#include <cinttypes>
+#include <cstdio>
+#include <type_traits>
+
+#include "opentelemetry/common/attribute_value.h"
+
+OPENTELEMETRY_BEGIN_NAMESPACE
+namespace sdk
+{
+namespace metrics
+{
+namespace
+{
+/**
+ * The size of the buffer numbers are formatted into; large enough for any 64-bit integer, and
+ * for any double in %.17g format.
+ */
+const std::size_t kMaxFormattedNumberSize = 32;
+
+/**
+ * Formats a label value into the string stored in a label set, passing it piece by piece to a
+ * function so that values can be hashed and compared without allocating memory. Arrays are
+ * formatted as their elements separated by commas.
+ */
+template <class Function>
+class LabelValueFormatter
+{
+public:
+  explicit LabelValueFormatter(Function &function) : function_(function) {}
+
+  void operator()(bool v) { function_(v ? "true" : "false"); }
+  void operator()(int v) { Format("%d", v); }
+  void operator()(int64_t v) { Format("%" PRId64, v); }
+  void operator()(unsigned int v) { Format("%u", v); }
+  void operator()(uint64_t v) { Format("%" PRIu64, v); }
+  // 17 significant digits tell every double apart.
+  void operator()(double v) { Format("%.17g", v); }
+  void operator()(nostd::string_view v) { function_(v); }
+
+  template <class T>
+  void operator()(nostd::span<const T> values)
+  {
+    for (std::size_t i = 0; i < values.size(); ++i)
+    {
+      if (i > 0)
+      {
+        function_(",");
+      }
+      (*this)(values[i]);
+    }
+  }
+
+private:
+  template <class T>
+  void Format(const char *format, T value)
+  {
+    char buffer[kMaxFormattedNumberSize];
+    int size = std::snprintf(buffer, sizeof(buffer), format, value);
+    function_(nostd::string_view(buffer, static_cast<std::size_t>(std::max(size, 0))));
+  }
+
+  Function &function_;
+};
+
+template <class Function>
+void FormatLabelValue(const common::AttributeValue &value, Function &&function)
+{
+  LabelValueFormatter<typename std::remove_reference<Function>::type> formatter(function);
+  nostd::visit(formatter, value);
+}
+
+const uint64_t kFnvOffsetBasis = 14695981039346656037ULL;
+const uint64_t kFnvPrime       = 1099511628211ULL;
+
+uint64_t AppendFnv(uint64_t hash, nostd::string_view bytes) noexcept
+{
+  for (char c : bytes)
+  {
+    hash = (hash ^ static_cast<unsigned char>(c)) * kFnvPrime;
+  }
+  return hash;
+}
+
+/**
+ * Hashes a single label. The hash of a label set is the sum of the hashes of its labels, so it
+ * does not depend on their order; the final mix spreads every label hash over all the bits.
+ */
+uint64_t HashLabel(nostd::string_view key, const common::AttributeValue &value) noexcept
+{
+  uint64_t hash = AppendFnv(kFnvOffsetBasis, key);
+  hash          = AppendFnv(hash, nostd::string_view("=", 1));
+  FormatLabelValue(value, [&hash](nostd::string_view piece) { hash = AppendFnv(hash, piece); });
+  hash ^= hash >> 33;
+  hash *= 0xff51afd7ed558ccdULL;
+  hash ^= hash >> 33;
+  hash *= 0xc4ceb9fe1a85ec53ULL;
+  hash ^= hash >> 33;
+  return hash;
+}
+}  // namespace
+
+const std::size_t LabelSet::kMaxHashedLabelCount;
+
+LabelSet::LabelSet(const opentelemetry::trace::KeyValueIterable &labels)
+{
+  if (labels.size() == 0)
+  {
+    return;
+  }
+  std::vector<Label> sorted_labels;
+  sorted_labels.reserve(labels.size());
+  hash_   = Canonicalize(labels, sorted_labels);
+  labels_ = std::make_shared<const std::vector<Label>>(std::move(sorted_labels));
+}
+
+LabelSet::LabelSet(std::vector<Label> sorted_labels, std::size_t hash) : hash_{hash}
+{
+  if (!sorted_labels.empty())
+  {
+    labels_ = std::make_shared<const std::vector<Label>>(std::move(sorted_labels));
+  }
+}
+
+std::size_t LabelSet::Canonicalize(const opentelemetry::trace::KeyValueIterable &labels,
+                                   std::vector<Label> &sorted_labels)
+{
+  std::size_t count = 0;
+  labels.ForEachKeyValue([&](nostd::string_view key, common::AttributeValue value) noexcept {
+    if (count == sorted_labels.size())
+    {
+      sorted_labels.emplace_back();
+    }
+    auto &label = sorted_labels[count++];
+    label.first.assign(key.data(), key.size());
+    label.second.clear();
+    FormatLabelValue(value, [&label](nostd::string_view piece) {
+      label.second.append(piece.data(), piece.size());
+    });
+    return true;
+  });
+
+  // Sort by key, keeping repeated keys in the order they were passed, with an insertion sort,
+  // which swaps the labels rather than allocating a buffer as std::stable_sort does.
+  auto by_key = [](const Label &a, const Label &b) { return a.first < b.first; };
+  auto begin  = sorted_labels.begin();
+  for (auto label = begin; label != begin + count; ++label)
+  {
+    std::rotate(std::upper_bound(begin, label, *label, by_key), label, label + 1);
+  }
+
+  // Keep the last value of every key.
+  std::size_t unique_count = 0;
+  for (std::size_t i = 0; i < count; ++i)
+  {
+    if (unique_count > 0 && sorted_labels[unique_count - 1].first == sorted_labels[i].first)
+    {
+      sorted_labels[unique_count - 1].second.swap(sorted_labels[i].second);
+    }
+    else
+    {
+      if (unique_count != i)
+      {
+        sorted_labels[unique_count].swap(sorted_labels[i]);
+      }
+      ++unique_count;
+    }
+  }
+  sorted_labels.resize(unique_count);
+
+  uint64_t hash = 0;
+  for (auto &label : sorted_labels)
+  {
+    hash += HashLabel(label.first, nostd::string_view(label.second));
+  }
+  return static_cast<std::size_t>(hash);
+}
+
+bool LabelSet::GetHash(const opentelemetry::trace::KeyValueIterable &labels,
+                       std::size_t &hash) noexcept
+{
+  if (labels.size() > kMaxHashedLabelCount)
+  {
+    return false;
+  }
+  nostd::string_view keys[kMaxHashedLabelCount];
+  std::size_t count = 0;
+  uint64_t sum      = 0;
+  bool is_complete  = labels.ForEachKeyValue(
+      [&](nostd::string_view key, common::AttributeValue value) noexcept {
+        if (count == kMaxHashedLabelCount || std::find(keys, keys + count, key) != keys + count)
+        {
+          return false;
+        }
+        keys[count++] = key;
+        sum += HashLabel(key, value);
+        return true;
+      });
+  hash = static_cast<std::size_t>(sum);
+  return is_complete;
+}
+
+bool LabelSet::Equals(const opentelemetry::trace::KeyValueIterable &labels) const noexcept
+{
+  auto &own_labels = GetLabels();
+  if (labels.size() != own_labels.size())
+  {
+    return false;
+  }
+  return labels.ForEachKeyValue([&](nostd::string_view key, common::AttributeValue value) noexcept {
+    auto label = std::lower_bound(own_labels.begin(), own_labels.end(), key,
+                                  [](const Label &label, nostd::string_view key) {
+                                    return nostd::string_view(label.first) < key;
+                                  });
+    if (label == own_labels.end() || label->first != key)
+    {
+      return false;
+    }
+    const std::string &expected = label->second;
+    std::size_t offset          = 0;
+    bool is_equal               = true;
+    FormatLabelValue(value, [&](nostd::string_view piece) {
+      is_equal = is_equal && offset + piece.size() <= expected.size() &&
+                 nostd::string_view(expected.data() + offset, piece.size()) == piece;
+      offset += piece.size();
+    });
+    return is_equal && offset == expected.size();
+  });
+}
+}  // namespace metrics
+}  // namespace sdk
+OPENTELEMETRY_END_NAMESPACE
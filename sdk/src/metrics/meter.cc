@@ -0,0 +1,280 @@
+#include "opentelemetry/sdk/metrics/meter.h"
+
+#include "opentelemetry/metrics/noop.h"
+#include "opentelemetry/sdk/metrics/async_instruments.h"
+#include "opentelemetry/sdk/metrics/sync_instruments.h"
+
+OPENTELEMETRY_BEGIN_NAMESPACE
+namespace sdk
+{
+namespace metrics
+{
+namespace metrics_api = opentelemetry::metrics;
+
+namespace
+{
+/**
+ * @return a distinct address for every instrument class
+ */
+template <class Instrument>
+const void *GetInstrumentType() noexcept
+{
+  static const char type = 0;
+  return &type;
+}
+}  // namespace
+
+Meter::Meter() noexcept
+    : boundaries_{GetDefaultBoundaries()}, cardinality_limit_{kDefaultCardinalityLimit}
+{}
+
+Meter::Meter(std::vector<double> boundaries, std::size_t cardinality_limit) noexcept
+    : boundaries_{std::move(boundaries)}, cardinality_limit_{cardinality_limit}
+{}
+
+std::vector<double> Meter::GetDefaultBoundaries() noexcept
+{
+  return {0, 5, 10, 25, 50, 75, 100, 250, 500, 1000};
+}
+
+template <class Instrument, class NoopInstrument, class ApiInstrument, class... Args>
+nostd::shared_ptr<ApiInstrument> Meter::GetOrCreateInstrument(nostd::string_view name,
+                                                              nostd::string_view description,
+                                                              nostd::string_view unit,
+                                                              Args &&... args) noexcept
+{
+  std::lock_guard<std::mutex> lock(mtx_);
+  auto &entry = instruments_[std::string(name.data(), name.size())];
+  if (entry.instrument == nullptr)
+  {
+    auto instrument = std::make_shared<Instrument>(name, description, unit,
+                                                   std::forward<Args>(args)..., cardinality_limit_);
+    entry.type        = GetInstrumentType<Instrument>();
+    entry.instrument  = instrument;
+    entry.collectable = instrument;
+  }
+  else if (entry.type != GetInstrumentType<Instrument>())
+  {
+    // The name is taken by an instrument of a different kind or value type.
+    return nostd::shared_ptr<ApiInstrument>(new NoopInstrument);
+  }
+  return nostd::shared_ptr<ApiInstrument>(
+      std::shared_ptr<ApiInstrument>(std::static_pointer_cast<Instrument>(entry.instrument)));
+}
+
+nostd::shared_ptr<metrics_api::Counter<int64_t>> Meter::NewIntCounter(
+    nostd::string_view name,
+    nostd::string_view description,
+    nostd::string_view unit) noexcept
+{
+  return GetOrCreateInstrument<Counter<int64_t>, metrics_api::NoopCounter<int64_t>,
+                               metrics_api::Counter<int64_t>>(name, description, unit);
+}
+
+nostd::shared_ptr<metrics_api::Counter<double>> Meter::NewDoubleCounter(
+    nostd::string_view name,
+    nostd::string_view description,
+    nostd::string_view unit) noexcept
+{
+  return GetOrCreateInstrument<Counter<double>, metrics_api::NoopCounter<double>,
+                               metrics_api::Counter<double>>(name, description, unit);
+}
+
+nostd::shared_ptr<metrics_api::UpDownCounter<int64_t>> Meter::NewIntUpDownCounter(
+    nostd::string_view name,
+    nostd::string_view description,
+    nostd::string_view unit) noexcept
+{
+  return GetOrCreateInstrument<UpDownCounter<int64_t>, metrics_api::NoopUpDownCounter<int64_t>,
+                               metrics_api::UpDownCounter<int64_t>>(name, description, unit);
+}
+
+nostd::shared_ptr<metrics_api::UpDownCounter<double>> Meter::NewDoubleUpDownCounter(
+    nostd::string_view name,
+    nostd::string_view description,
+    nostd::string_view unit) noexcept
+{
+  return GetOrCreateInstrument<UpDownCounter<double>, metrics_api::NoopUpDownCounter<double>,
+                               metrics_api::UpDownCounter<double>>(name, description, unit);
+}
+
+nostd::shared_ptr<metrics_api::ValueRecorder<int64_t>> Meter::NewIntValueRecorder(
+    nostd::string_view name,
+    nostd::string_view description,
+    nostd::string_view unit) noexcept
+{
+  return NewIntValueRecorder(name, description, unit, boundaries_);
+}
+
+nostd::shared_ptr<metrics_api::ValueRecorder<double>> Meter::NewDoubleValueRecorder(
+    nostd::string_view name,
+    nostd::string_view description,
+    nostd::string_view unit) noexcept
+{
+  return NewDoubleValueRecorder(name, description, unit, boundaries_);
+}
+
+nostd::shared_ptr<metrics_api::ValueRecorder<int64_t>> Meter::NewIntValueRecorder(
+    nostd::string_view name,
+    nostd::string_view description,
+    nostd::string_view unit,
+    std::vector<double> boundaries) noexcept
+{
+  return GetOrCreateInstrument<ValueRecorder<int64_t>, metrics_api::NoopValueRecorder<int64_t>,
+                               metrics_api::ValueRecorder<int64_t>>(
+      name, description, unit,
+      HistogramAggregator<int64_t>::MakeBoundaries(std::move(boundaries)));
+}
+
+nostd::shared_ptr<metrics_api::ValueRecorder<double>> Meter::NewDoubleValueRecorder(
+    nostd::string_view name,
+    nostd::string_view description,
+    nostd::string_view unit,
+    std::vector<double> boundaries) noexcept
+{
+  return GetOrCreateInstrument<ValueRecorder<double>, metrics_api::NoopValueRecorder<double>,
+                               metrics_api::ValueRecorder<double>>(
+      name, description, unit,
+      HistogramAggregator<double>::MakeBoundaries(std::move(boundaries)));
+}
+
+nostd::shared_ptr<metrics_api::ValueRecorder<int64_t>> Meter::NewIntValueRecorder(
+    nostd::string_view name,
+    nostd::string_view description,
+    nostd::string_view unit,
+    const DDSketchOptions &options) noexcept
+{
+  return GetOrCreateInstrument<ValueRecorder<int64_t, SketchAggregator<int64_t>>,
+                               metrics_api::NoopValueRecorder<int64_t>,
+                               metrics_api::ValueRecorder<int64_t>>(name, description, unit,
+                                                                    options);
+}
+
+nostd::shared_ptr<metrics_api::ValueRecorder<double>> Meter::NewDoubleValueRecorder(
+    nostd::string_view name,
+    nostd::string_view description,
+    nostd::string_view unit,
+    const DDSketchOptions &options) noexcept
+{
+  return GetOrCreateInstrument<ValueRecorder<double, SketchAggregator<double>>,
+                               metrics_api::NoopValueRecorder<double>,
+                               metrics_api::ValueRecorder<double>>(name, description, unit,
+                                                                   options);
+}
+
+nostd::shared_ptr<metrics_api::SumObserver<int64_t>> Meter::NewIntSumObserver(
+    nostd::string_view name,
+    nostd::string_view description,
+    nostd::string_view unit,
+    metrics_api::ObserverCallback<int64_t> callback,
+    void *state) noexcept
+{
+  return GetOrCreateInstrument<SumObserver<int64_t>, metrics_api::NoopSumObserver<int64_t>,
+                               metrics_api::SumObserver<int64_t>>(name, description, unit,
+                                                                  callback, state);
+}
+
+nostd::shared_ptr<metrics_api::SumObserver<double>> Meter::NewDoubleSumObserver(
+    nostd::string_view name,
+    nostd::string_view description,
+    nostd::string_view unit,
+    metrics_api::ObserverCallback<double> callback,
+    void *state) noexcept
+{
+  return GetOrCreateInstrument<SumObserver<double>, metrics_api::NoopSumObserver<double>,
+                               metrics_api::SumObserver<double>>(name, description, unit,
+                                                                 callback, state);
+}
+
+nostd::shared_ptr<metrics_api::UpDownSumObserver<int64_t>> Meter::NewIntUpDownSumObserver(
+    nostd::string_view name,
+    nostd::string_view description,
+    nostd::string_view unit,
+    metrics_api::ObserverCallback<int64_t> callback,
+    void *state) noexcept
+{
+  return GetOrCreateInstrument<UpDownSumObserver<int64_t>,
+                               metrics_api::NoopUpDownSumObserver<int64_t>,
+                               metrics_api::UpDownSumObserver<int64_t>>(name, description, unit,
+                                                                        callback, state);
+}
+
+nostd::shared_ptr<metrics_api::UpDownSumObserver<double>> Meter::NewDoubleUpDownSumObserver(
+    nostd::string_view name,
+    nostd::string_view description,
+    nostd::string_view unit,
+    metrics_api::ObserverCallback<double> callback,
+    void *state) noexcept
+{
+  return GetOrCreateInstrument<UpDownSumObserver<double>,
+                               metrics_api::NoopUpDownSumObserver<double>,
+                               metrics_api::UpDownSumObserver<double>>(name, description, unit,
+                                                                       callback, state);
+}
+
+nostd::shared_ptr<metrics_api::ValueObserver<int64_t>> Meter::NewIntValueObserver(
+    nostd::string_view name,
+    nostd::string_view description,
+    nostd::string_view unit,
+    metrics_api::ObserverCallback<int64_t> callback,
+    void *state) noexcept
+{
+  return GetOrCreateInstrument<ValueObserver<int64_t>, metrics_api::NoopValueObserver<int64_t>,
+                               metrics_api::ValueObserver<int64_t>>(name, description, unit,
+                                                                    callback, state);
+}
+
+nostd::shared_ptr<metrics_api::ValueObserver<double>> Meter::NewDoubleValueObserver(
+    nostd::string_view name,
+    nostd::string_view description,
+    nostd::string_view unit,
+    metrics_api::ObserverCallback<double> callback,
+    void *state) noexcept
+{
+  return GetOrCreateInstrument<ValueObserver<double>, metrics_api::NoopValueObserver<double>,
+                               metrics_api::ValueObserver<double>>(name, description, unit,
+                                                                   callback, state);
+}
+
+std::vector<MetricRecord> Meter::Collect(AggregationTemporality temporality,
+                                         std::size_t max_idle_collections) noexcept
+{
+  std::vector<MetricRecord> records;
+  Collect(records, temporality, max_idle_collections);
+  return records;
+}
+
+void Meter::Collect(std::vector<MetricRecord> &records,
+                    AggregationTemporality temporality,
+                    std::size_t max_idle_collections) noexcept
+{
+  std::vector<std::shared_ptr<Collectable>> collectables;
+  {
+    std::lock_guard<std::mutex> lock(mtx_);
+    collectables.reserve(instruments_.size());
+    for (auto &name_entry : instruments_)
+    {
+      collectables.push_back(name_entry.second.collectable);
+    }
+  }
+
+  // Instruments are collected outside of the lock so that creating instruments is not blocked.
+  for (auto &collectable : collectables)
+  {
+    collectable->Collect(records, temporality, max_idle_collections);
+  }
+}
+
+uint64_t Meter::GetFoldedCount() noexcept
+{
+  std::lock_guard<std::mutex> lock(mtx_);
+  uint64_t count = 0;
+  for (auto &name_entry : instruments_)
+  {
+    count += name_entry.second.collectable->GetFoldedCount();
+  }
+  return count;
+}
+}  // namespace metrics
+}  // namespace sdk
+OPENTELEMETRY_END_NAMESPACE
@@ -0,0 +1,26 @@
+#include "opentelemetry/sdk/metrics/meter_provider.h"
+
+OPENTELEMETRY_BEGIN_NAMESPACE
+namespace sdk
+{
+namespace metrics
+{
+MeterProvider::MeterProvider(std::shared_ptr<Meter> meter) noexcept
+    : meter_{meter != nullptr ? std::move(meter) : std::make_shared<Meter>()}
+{}
+
+opentelemetry::nostd::shared_ptr<opentelemetry::metrics::Meter> MeterProvider::GetMeter(
+    nostd::string_view library_name,
+    nostd::string_view library_version) noexcept
+{
+  return opentelemetry::nostd::shared_ptr<opentelemetry::metrics::Meter>(
+      std::shared_ptr<opentelemetry::metrics::Meter>(meter_));
+}
+
+std::shared_ptr<Meter> MeterProvider::GetSdkMeter() const noexcept
+{
+  return meter_;
+}
+}  // namespace metrics
+}  // namespace sdk
+OPENTELEMETRY_END_NAMESPACE
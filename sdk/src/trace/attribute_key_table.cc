@@ -0,0 +1,80 @@
+#include "opentelemetry/sdk/trace/attribute_key_table.h"
+
+OPENTELEMETRY_BEGIN_NAMESPACE
+namespace sdk
+{
+namespace trace
+{
+const std::size_t AttributeKeyTable::kMaxOverflowKeys;
+
+AttributeKeyTable::AttributeKeyTable() noexcept
+{
+  for (auto &slot : slots_)
+  {
+    slot.store(nullptr, std::memory_order_relaxed);
+  }
+}
+
+AttributeKeyTable::~AttributeKeyTable()
+{
+  for (auto &slot : slots_)
+  {
+    delete slot.load(std::memory_order_relaxed);
+  }
+}
+
+nostd::string_view AttributeKeyTable::Intern(nostd::string_view key) noexcept
+{
+  std::size_t hash = AttributeKeyHash{}(key);
+  Entry *inserted  = nullptr;
+  for (std::size_t probe = 0; probe < kMaxProbes; ++probe)
+  {
+    auto &slot   = slots_[(hash + probe) & (kSlots - 1)];
+    Entry *entry = slot.load(std::memory_order_acquire);
+    if (entry == nullptr)
+    {
+      if (inserted == nullptr)
+      {
+        inserted = new Entry{hash, std::string(key.data(), key.size())};
+      }
+      // Slots are never emptied, so a key that lost the race for this slot to an equal key
+      // finds it here, and one that lost it to another key probes on.
+      if (slot.compare_exchange_strong(entry, inserted, std::memory_order_acq_rel,
+                                       std::memory_order_acquire))
+      {
+        return inserted->key;
+      }
+    }
+    if (entry->hash == hash && nostd::string_view(entry->key) == key)
+    {
+      delete inserted;
+      return entry->key;
+    }
+  }
+  delete inserted;
+
+  // The key is only copied when it is added, so that looking up a kept key doesn't allocate.
+  std::lock_guard<std::mutex> lock(overflow_mutex_);
+  auto it = overflow_.find(key);
+  if (it != overflow_.end())
+  {
+    return *it;
+  }
+  if (overflow_.size() >= kMaxOverflowKeys)
+  {
+    return nostd::string_view();
+  }
+  // The strings of a deque are never moved, so the views of them stay valid.
+  overflow_keys_.emplace_back(key.data(), key.size());
+  return *overflow_.insert(nostd::string_view(overflow_keys_.back())).first;
+}
+
+AttributeKeyTable &AttributeKeyTable::GetGlobal() noexcept
+{
+  // Never destroyed, so that the keys stay valid for recordables destroyed at exit.
+  static AttributeKeyTable *table = new AttributeKeyTable;
+  return *table;
+}
+}  // namespace trace
+}  // namespace sdk
+OPENTELEMETRY_END_NAMESPACE
@@ -0,0 +1,108 @@
+#include "opentelemetry/sdk/trace/samplers/adaptive.h"
+
+#include <cmath>
+
+#include "opentelemetry/sdk/trace/samplers/trace_id_ratio.h"
+
+OPENTELEMETRY_BEGIN_NAMESPACE
+namespace sdk
+{
+namespace trace
+{
+namespace
+{
+int64_t GetSteadyNanoseconds() noexcept
+{
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(
+             std::chrono::steady_clock::now().time_since_epoch())
+      .count();
+}
+
+// The stripe of the thread plus one, or 0 until it is assigned one. Constant initialized, so
+// that it is read without a call to initialize it.
+thread_local std::size_t thread_stripe = 0;
+
+std::size_t GetThreadStripe() noexcept
+{
+  if (thread_stripe == 0)
+  {
+    static std::atomic<std::size_t> next_stripe{0};
+    thread_stripe =
+        next_stripe.fetch_add(1, std::memory_order_relaxed) % AdaptiveSampler::kStripeCount + 1;
+  }
+  return thread_stripe - 1;
+}
+}  // namespace
+
+AdaptiveSampler::AdaptiveSampler(double target_spans_per_second,
+                                 std::chrono::milliseconds adjustment_interval) noexcept
+    : target_spans_per_second_(target_spans_per_second),
+      adjustment_interval_(
+          std::chrono::duration_cast<std::chrono::nanoseconds>(adjustment_interval).count()),
+      description_("AdaptiveSampler{" + std::to_string(target_spans_per_second) + "}"),
+      threshold_(UINT64_MAX),
+      stripes_(new Stripe[kStripeCount]),
+      interval_start_(GetSteadyNanoseconds())
+{}
+
+SamplingResult AdaptiveSampler::ShouldSample(
+    const trace_api::SpanContext *parent_context,
+    trace_api::TraceId trace_id,
+    nostd::string_view /*name*/,
+    trace_api::SpanKind /*span_kind*/,
+    const trace_api::KeyValueIterable & /*attributes*/) noexcept
+{
+  if (parent_context && !parent_context->HasRemoteParent())
+  {
+    return {parent_context->IsSampled() ? Decision::RECORD_AND_SAMPLE : Decision::NOT_RECORD,
+            nullptr};
+  }
+
+  if (stripes_[GetThreadStripe()].root_spans.fetch_add(1, std::memory_order_relaxed) %
+          kClockReadInterval ==
+      kClockReadInterval - 1)
+  {
+    Adjust();
+  }
+
+  if (GetTraceIdRatioBits(trace_id) <= threshold_.load(std::memory_order_relaxed))
+  {
+    return {Decision::RECORD_AND_SAMPLE, nullptr};
+  }
+  return {Decision::NOT_RECORD, nullptr};
+}
+
+void AdaptiveSampler::Adjust() noexcept
+{
+  int64_t now            = GetSteadyNanoseconds();
+  int64_t interval_start = interval_start_.load(std::memory_order_relaxed);
+  if (now - interval_start < adjustment_interval_ ||
+      !interval_start_.compare_exchange_strong(interval_start, now, std::memory_order_relaxed))
+  {
+    return;
+  }
+
+  // Root spans counted by other threads while the interval is switched over end up in either.
+  uint64_t root_spans = 0;
+  for (std::size_t i = 0; i < kStripeCount; ++i)
+  {
+    root_spans += stripes_[i].root_spans.exchange(0, std::memory_order_relaxed);
+  }
+  double rate        = root_spans * 1e9 / (now - interval_start);
+  double probability = rate <= target_spans_per_second_ ? 1 : target_spans_per_second_ / rate;
+  threshold_.store(GetProbabilityThreshold(probability), std::memory_order_relaxed);
+}
+
+std::string AdaptiveSampler::GetDescription() const noexcept
+{
+  return description_;
+}
+
+double AdaptiveSampler::GetProbability() const noexcept
+{
+  uint64_t threshold = threshold_.load(std::memory_order_relaxed);
+  return threshold == UINT64_MAX ? 1 : std::ldexp(static_cast<double>(threshold), -64);
+}
+}  // namespace trace
+}  // namespace sdk
+OPENTELEMETRY_END_NAMESPACE
@@ -15,65 +15,17 @@
 
 #include "opentelemetry/sdk/trace/samplers/probability.h"
 
-#include <cmath>
-#include <cstdint>
-#include <stdexcept>
+#include "opentelemetry/sdk/trace/samplers/trace_id_ratio.h"
 
 namespace trace_api = opentelemetry::trace;
 
-namespace
-{
-  /**
-   * Converts a probability in [0, 1] to a threshold in [0, UINT64_MAX]
-   *
-   * @param probability a required value top be converted to uint64_t. is
-   * bounded by 1 >= probability >= 0.
-   * @return Returns threshold value computed after converting probability to
-   * uint64_t datatype
-   */
-  uint64_t CalculateThreshold(double probability) noexcept
-  {
-    if (probability <= 0.0) return 0; 
-    if (probability >= 1.0) return UINT64_MAX;
-    
-    // We can't directly return probability * UINT64_MAX.
-    //
-    // UINT64_MAX is (2^64)-1, but as a double rounds up to 2^64.
-    // For probabilities >= 1-(2^-54), the product wraps to zero!
-    // Instead, calculate the high and low 32 bits separately.
-    const double product = UINT32_MAX * probability;
-    double hi_bits, lo_bits = ldexp(modf(product, &hi_bits), 32) + product;
-    return (static_cast<uint64_t>(hi_bits) << 32) +
-           static_cast<uint64_t>(lo_bits);
-  }
-
-  /**
-   * @param trace_id a required value to be converted to uint64_t. trace_id must
-   * at least 8 bytes long
-   * @return Returns threshold value computed after converting trace_id to
-   * uint64_t datatype
-   */
-  uint64_t CalculateThresholdFromBuffer(const trace_api::TraceId& trace_id) noexcept
-  {
-    // We only use the first 8 bytes of TraceId.
-    static_assert(trace_api::TraceId::kSize >= 8, "TraceID must be at least 8 bytes long.");
-
-    uint64_t res = 0;
-    std::memcpy(&res, &trace_id, 8);
-
-    double probability = (double) res / UINT64_MAX;
-
-    return CalculateThreshold(probability);
-  }
-} // namespace
-
 OPENTELEMETRY_BEGIN_NAMESPACE
 namespace sdk
 {
 namespace trace
 {
 ProbabilitySampler::ProbabilitySampler(double probability)
-: threshold_(CalculateThreshold(probability))
+: threshold_(GetProbabilityThreshold(probability))
 {
     if (probability > 1.0) probability = 1.0;
     if (probability < 0.0) probability = 0.0;
@@ -95,14 +47,10 @@ SamplingResult ProbabilitySampler::ShouldSample(
     }
   }
 
-  if (threshold_ == 0) return { Decision::NOT_RECORD, nullptr };
-
-  if (CalculateThresholdFromBuffer(trace_id) <= threshold_)
-  {
-    return { Decision::RECORD_AND_SAMPLE, nullptr };
-  }
-
-  return { Decision::NOT_RECORD, nullptr };
+  // A plain integer comparison against the precomputed threshold, where a threshold of 0
+  // samples nothing.
+  bool sampled = (GetTraceIdRatioBits(trace_id) <= threshold_) & (threshold_ != 0);
+  return { sampled ? Decision::RECORD_AND_SAMPLE : Decision::NOT_RECORD, nullptr };
 }
 
 std::string ProbabilitySampler::GetDescription() const noexcept
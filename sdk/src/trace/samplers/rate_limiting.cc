@@ -0,0 +1,113 @@
+#include "opentelemetry/sdk/trace/samplers/rate_limiting.h"
+
+#include <algorithm>
+#include <chrono>
+#include <ctime>
+
+OPENTELEMETRY_BEGIN_NAMESPACE
+namespace sdk
+{
+namespace trace
+{
+namespace
+{
+int64_t GetSteadyNanoseconds() noexcept
+{
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(
+             std::chrono::steady_clock::now().time_since_epoch())
+      .count();
+}
+
+#ifdef CLOCK_MONOTONIC_COARSE
+// The coarse monotonic clock, which the kernel caches at every tick, so it is several times
+// cheaper to read than the steady clock, but only precise to a few milliseconds.
+int64_t GetCoarseNanoseconds() noexcept
+{
+  timespec now;
+  clock_gettime(CLOCK_MONOTONIC_COARSE, &now);
+  return static_cast<int64_t>(now.tv_sec) * 1000000000 + now.tv_nsec;
+}
+#endif
+}  // namespace
+
+RateLimitingSampler::RateLimitingSampler(double max_spans_per_second) noexcept
+    : max_spans_per_second_(std::max(max_spans_per_second, 1.0)),
+      capacity_(static_cast<int64_t>(max_spans_per_second_)),
+      description_("RateLimitingSampler{" + std::to_string(max_spans_per_second_) + "}"),
+      tokens_(capacity_),
+      refill_time_(GetSteadyNanoseconds()),
+      tick_(0)
+{}
+
+SamplingResult RateLimitingSampler::ShouldSample(
+    const trace_api::SpanContext * /*parent_context*/,
+    trace_api::TraceId /*trace_id*/,
+    nostd::string_view /*name*/,
+    trace_api::SpanKind /*span_kind*/,
+    const trace_api::KeyValueIterable & /*attributes*/) noexcept
+{
+  int64_t tokens = tokens_.fetch_sub(1, std::memory_order_relaxed);
+  if (tokens > 0)
+  {
+    return {Decision::RECORD_AND_SAMPLE, nullptr};
+  }
+
+  // The bucket is empty. Refill it by the time that passed, however few spans were rejected since
+  // it was last refilled, so that it is full again after a second without spans.
+#ifdef CLOCK_MONOTONIC_COARSE
+  // The steady clock is only read once the coarse clock ticked since it was last read, which
+  // delays a refill by at most a tick, without losing the tokens accrued meanwhile.
+  int64_t tick = GetCoarseNanoseconds();
+  if (tick == tick_.load(std::memory_order_relaxed))
+  {
+    return {Decision::NOT_RECORD, nullptr};
+  }
+  tick_.store(tick, std::memory_order_relaxed);
+#endif
+  if (Refill() && tokens_.fetch_sub(1, std::memory_order_relaxed) > 0)
+  {
+    return {Decision::RECORD_AND_SAMPLE, nullptr};
+  }
+  return {Decision::NOT_RECORD, nullptr};
+}
+
+bool RateLimitingSampler::Refill() noexcept
+{
+  int64_t now         = GetSteadyNanoseconds();
+  int64_t refill_time = refill_time_.load(std::memory_order_relaxed);
+  auto accrued = static_cast<int64_t>((now - refill_time) * max_spans_per_second_ / 1e9);
+  if (accrued <= 0)
+  {
+    return false;
+  }
+
+  // Advance the refill time by the time the added tokens took to accrue, so fractions of a
+  // token are not lost, unless the bucket overflowed.
+  int64_t new_refill_time =
+      accrued >= capacity_
+          ? now
+          : refill_time + static_cast<int64_t>(accrued * 1e9 / max_spans_per_second_);
+  if (!refill_time_.compare_exchange_strong(refill_time, new_refill_time,
+                                            std::memory_order_relaxed))
+  {
+    // Another thread refilled the bucket.
+    return false;
+  }
+
+  // Spans rejected in the meantime took the count below zero, which is not owed back.
+  int64_t tokens = tokens_.load(std::memory_order_relaxed);
+  while (!tokens_.compare_exchange_weak(tokens,
+                                        std::min(std::max(tokens, int64_t(0)) + accrued, capacity_),
+                                        std::memory_order_relaxed))
+  {
+  }
+  return true;
+}
+
+std::string RateLimitingSampler::GetDescription() const noexcept
+{
+  return description_;
+}
+}  // namespace trace
+}  // namespace sdk
+OPENTELEMETRY_END_NAMESPACE
@@ -0,0 +1,255 @@
+#include "opentelemetry/sdk/trace/samplers/rule_based.h"
+
+#include <algorithm>
+#include <cstring>
+#include <map>
+#include <utility>
+
+#include "opentelemetry/sdk/trace/samplers/trace_id_ratio.h"
+
+OPENTELEMETRY_BEGIN_NAMESPACE
+namespace sdk
+{
+namespace trace
+{
+namespace
+{
+bool IsAnyName(const std::string &span_name) noexcept
+{
+  return span_name.empty() || span_name == "*";
+}
+
+bool IsPrefix(const std::string &span_name) noexcept
+{
+  return !span_name.empty() && span_name.back() == '*';
+}
+
+bool StartsWith(nostd::string_view name, nostd::string_view prefix) noexcept
+{
+  return name.size() >= prefix.size() &&
+         std::memcmp(name.data(), prefix.data(), prefix.size()) == 0;
+}
+
+/**
+ * A trie node while the rules are compiled.
+ */
+struct BuildNode
+{
+  std::map<uint8_t, uint32_t> children;
+  uint32_t exact_rule;
+  uint32_t prefix_rule;
+};
+}  // namespace
+
+RuleBasedSampler::RuleBasedSampler(std::vector<SamplingRule> rules, double default_probability)
+    : rules_(std::move(rules))
+{
+  const auto no_rule = static_cast<uint32_t>(rules_.size());
+  for (auto &rule : rules_)
+  {
+    thresholds_.push_back(GetProbabilityThreshold(rule.probability));
+  }
+  thresholds_.push_back(GetProbabilityThreshold(default_probability));
+
+  default_probability = std::min(std::max(default_probability, 0.0), 1.0);
+  description_        = "RuleBasedSampler{rules=" + std::to_string(rules_.size()) +
+                 ",default=" + std::to_string(default_probability) + "}";
+
+  std::vector<BuildNode> trie(1, BuildNode{{}, no_rule, no_rule});
+  uint32_t any_name_rule = no_rule;
+  for (uint32_t i = 0; i < no_rule; ++i)
+  {
+    const auto &rule = rules_[i];
+    if (!rule.attribute_key.empty())
+    {
+      auto condition = std::find_if(conditions_.begin(), conditions_.end(),
+                                    [&](const AttributeCondition &condition) {
+                                      return condition.key == rule.attribute_key &&
+                                             condition.value == rule.attribute_value;
+                                    });
+      if (condition == conditions_.end())
+      {
+        conditions_.push_back({rule.attribute_key, rule.attribute_value, {}});
+        condition = conditions_.end() - 1;
+      }
+      condition->rules.push_back(i);
+      continue;
+    }
+    if (IsAnyName(rule.span_name))
+    {
+      any_name_rule = std::min(any_name_rule, i);
+      continue;
+    }
+
+    bool prefix      = IsPrefix(rule.span_name);
+    std::size_t size = rule.span_name.size() - (prefix ? 1 : 0);
+    uint32_t node    = 0;
+    for (std::size_t j = 0; j < size; ++j)
+    {
+      auto byte  = static_cast<uint8_t>(rule.span_name[j]);
+      auto child = trie[node].children.find(byte);
+      if (child == trie[node].children.end())
+      {
+        trie[node].children[byte] = static_cast<uint32_t>(trie.size());
+        trie.push_back(BuildNode{{}, no_rule, no_rule});
+        node = static_cast<uint32_t>(trie.size() - 1);
+      }
+      else
+      {
+        node = child->second;
+      }
+    }
+    auto &node_rule = prefix ? trie[node].prefix_rule : trie[node].exact_rule;
+    node_rule       = std::min(node_rule, i);
+  }
+
+  std::sort(conditions_.begin(), conditions_.end(),
+            [](const AttributeCondition &a, const AttributeCondition &b) {
+              return a.key != b.key ? a.key < b.key : a.value < b.value;
+            });
+
+  // Lay the trie out flat, every node with its edges next to each other and in byte order.
+  // Chains of nodes without rules and with a single child are merged into the label of a single
+  // edge. The prefix rules of a node apply to all of its descendants.
+  struct Visit
+  {
+    uint32_t trie_node;
+    uint32_t node;
+    uint32_t inherited_rule;
+  };
+  nodes_.emplace_back();
+  std::vector<Visit> stack{{0, 0, any_name_rule}};
+  while (!stack.empty())
+  {
+    auto visit     = stack.back();
+    auto &children = trie[visit.trie_node].children;
+    auto exit_rule = std::min(visit.inherited_rule, trie[visit.trie_node].prefix_rule);
+    nodes_[visit.node] = {static_cast<uint32_t>(edges_.size()),
+                          static_cast<uint32_t>(children.size()),
+                          std::min(exit_rule, trie[visit.trie_node].exact_rule), exit_rule};
+    stack.pop_back();
+    for (auto &child : children)
+    {
+      auto label_offset = static_cast<uint32_t>(labels_.size());
+      auto trie_node    = child.second;
+      labels_.push_back(static_cast<char>(child.first));
+      while (trie[trie_node].children.size() == 1 && trie[trie_node].exact_rule == no_rule &&
+             trie[trie_node].prefix_rule == no_rule)
+      {
+        labels_.push_back(static_cast<char>(trie[trie_node].children.begin()->first));
+        trie_node = trie[trie_node].children.begin()->second;
+      }
+      edges_.push_back({child.first, label_offset,
+                        static_cast<uint32_t>(labels_.size()) - label_offset,
+                        static_cast<uint32_t>(nodes_.size())});
+      stack.push_back({trie_node, static_cast<uint32_t>(nodes_.size()), exit_rule});
+      nodes_.emplace_back();
+    }
+  }
+}
+
+SamplingResult RuleBasedSampler::ShouldSample(
+    const trace_api::SpanContext * /*parent_context*/,
+    trace_api::TraceId trace_id,
+    nostd::string_view name,
+    trace_api::SpanKind /*span_kind*/,
+    const trace_api::KeyValueIterable &attributes) noexcept
+{
+  uint64_t threshold = thresholds_[Match(name, attributes)];
+  bool sampled       = (GetTraceIdRatioBits(trace_id) <= threshold) & (threshold != 0);
+  return {sampled ? Decision::RECORD_AND_SAMPLE : Decision::NOT_RECORD, nullptr};
+}
+
+std::size_t RuleBasedSampler::Match(nostd::string_view name,
+                                    const trace_api::KeyValueIterable &attributes) const noexcept
+{
+  // Walk the trie along the name, for the first rule without an attribute. A name that ends
+  // or differs within the label of an edge leaves the trie at the node the edge starts from.
+  const TrieNode *node = &nodes_[0];
+  uint32_t rule;
+  for (std::size_t i = 0;;)
+  {
+    if (i == name.size())
+    {
+      rule = node->end_rule;
+      break;
+    }
+    auto byte  = static_cast<uint8_t>(name[i]);
+    auto first = edges_.begin() + node->first_edge;
+    auto last  = first + node->edge_count;
+    auto edge  = std::lower_bound(first, last, byte, [](const TrieEdge &edge, uint8_t byte) {
+      return edge.byte < byte;
+    });
+    if (edge == last || edge->byte != byte || name.size() - i < edge->label_size ||
+        std::memcmp(name.data() + i, labels_.data() + edge->label_offset, edge->label_size) != 0)
+    {
+      rule = node->exit_rule;
+      break;
+    }
+    i += edge->label_size;
+    node = &nodes_[edge->child];
+  }
+
+  if (conditions_.empty() || rule == 0)
+  {
+    return rule;
+  }
+
+  // An earlier rule may still match by one of the span's attributes.
+  attributes.ForEachKeyValue([&](nostd::string_view key, common::AttributeValue value) noexcept {
+    if (!nostd::holds_alternative<nostd::string_view>(value))
+    {
+      return true;
+    }
+    auto string_value = nostd::get<nostd::string_view>(value);
+    auto condition    = std::lower_bound(
+        conditions_.begin(), conditions_.end(), std::make_pair(key, string_value),
+        [](const AttributeCondition &condition,
+           const std::pair<nostd::string_view, nostd::string_view> &attribute) {
+          int result = nostd::string_view(condition.key).compare(attribute.first);
+          return result != 0 ? result < 0
+                             : nostd::string_view(condition.value).compare(attribute.second) < 0;
+        });
+    if (condition == conditions_.end() || key != nostd::string_view(condition->key) ||
+        string_value != nostd::string_view(condition->value))
+    {
+      return true;
+    }
+    for (auto condition_rule : condition->rules)
+    {
+      if (condition_rule >= rule)
+      {
+        break;
+      }
+      if (MatchesName(condition_rule, name))
+      {
+        rule = condition_rule;
+        break;
+      }
+    }
+    return rule != 0;
+  });
+  return rule;
+}
+
+bool RuleBasedSampler::MatchesName(uint32_t rule, nostd::string_view name) const noexcept
+{
+  const auto &span_name = rules_[rule].span_name;
+  if (IsAnyName(span_name))
+  {
+    return true;
+  }
+  if (IsPrefix(span_name))
+  {
+    return StartsWith(name, nostd::string_view(span_name.data(), span_name.size() - 1));
+  }
+  return name == nostd::string_view(span_name);
+}
+
+std::string RuleBasedSampler::GetDescription() const noexcept
+{
+  return description_;
+}
+}  // namespace trace
+}  // namespace sdk
+OPENTELEMETRY_END_NAMESPACE
@@ -1,5 +1,6 @@
 #include "src/trace/span.h"
 
+#include "opentelemetry/trace/key_value_iterable_view.h"
 #include "opentelemetry/version.h"
 
 OPENTELEMETRY_BEGIN_NAMESPACE
@@ -13,6 +14,10 @@ using opentelemetry::core::SystemTimestamp;
 
 namespace
 {
+// The attributes of events added without any.
+using NoAttributes =
+    nostd::span<const std::pair<nostd::string_view, opentelemetry::common::AttributeValue>>;
+
 SystemTimestamp NowOr(const SystemTimestamp &system)
 {
   if (system == SystemTimestamp())
@@ -42,7 +47,10 @@ Span::Span(std::shared_ptr<Tracer> &&tracer,
            std::shared_ptr<SpanProcessor> processor,
            nostd::string_view name,
            const trace_api::KeyValueIterable &attributes,
-           const trace_api::StartSpanOptions &options) noexcept
+           const trace_api::KeyValueIterable *sampling_attributes,
+           const trace_api::StartSpanOptions &options,
+           trace_api::TraceId trace_id,
+           trace_api::SpanId span_id) noexcept
     : tracer_{std::move(tracer)},
       processor_{processor},
       recordable_{processor_->MakeRecordable()},
@@ -53,16 +61,20 @@ Span::Span(std::shared_ptr<Tracer> &&tracer,
   {
     return;
   }
-  processor_->OnStart(*recordable_);
-  recordable_->SetName(name);
-
-  attributes.ForEachKeyValue([&](nostd::string_view key, common::AttributeValue value) noexcept {
-    recordable_->SetAttribute(key, value);
-    return true;
-  });
-
-  recordable_->SetStartTime(NowOr(options.start_system_time));
+  // Spans do not have a parent context yet, so every span is the root of its trace.
+  SpanStartData data = {trace_id,
+                        span_id,
+                        trace_api::SpanId(),
+                        name,
+                        options.kind,
+                        &attributes,
+                        sampling_attributes,
+                        NowOr(options.start_system_time)};
+  recordable_->Init(data);
   start_steady_time = NowOr(options.start_steady_time);
+
+  // Processors get to see the span's name, attributes and start time.
+  processor_->OnStart(*recordable_);
 }
 
 Span::~Span()
@@ -79,22 +91,24 @@ void Span::SetAttribute(nostd::string_view key, const common::AttributeValue &va
 
 void Span::AddEvent(nostd::string_view name) noexcept
 {
-  (void)name;
+  AddEvent(name, SystemTimestamp(std::chrono::system_clock::now()));
 }
 
 void Span::AddEvent(nostd::string_view name, core::SystemTimestamp timestamp) noexcept
 {
-  (void)name;
-  (void)timestamp;
+  AddEvent(name, timestamp, trace_api::KeyValueIterableView<NoAttributes>(NoAttributes{}));
 }
 
 void Span::AddEvent(nostd::string_view name,
                     core::SystemTimestamp timestamp,
                     const trace_api::KeyValueIterable &attributes) noexcept
 {
-  (void)name;
-  (void)timestamp;
-  (void)attributes;
+  std::lock_guard<std::mutex> lock_guard{mu_};
+  if (recordable_ == nullptr)
+  {
+    return;
+  }
+  recordable_->AddEvent(name, timestamp, attributes);
 }
 
 void Span::SetStatus(trace_api::CanonicalCode code, nostd::string_view description) noexcept
@@ -19,12 +19,16 @@ class Span final : public trace_api::Span
                 std::shared_ptr<SpanProcessor> processor,
                 nostd::string_view name,
                 const trace_api::KeyValueIterable &attributes,
-                const trace_api::StartSpanOptions &options) noexcept;
+                const trace_api::KeyValueIterable *sampling_attributes,
+                const trace_api::StartSpanOptions &options,
+                trace_api::TraceId trace_id,
+                trace_api::SpanId span_id) noexcept;
 
   ~Span() override;
 
   // trace_api::Span
-  void SetAttribute(nostd::string_view key, const common::AttributeValue &value) noexcept override;
+  void SetAttribute(nostd::string_view key,
+                    const opentelemetry::common::AttributeValue &value) noexcept override;
 
   void AddEvent(nostd::string_view name) noexcept override;
 
@@ -0,0 +1,406 @@
+#include "opentelemetry/sdk/trace/tail_sampling_processor.h"
+
+#include <algorithm>
+#include <array>
+#include <cstring>
+#include <mutex>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "opentelemetry/sdk/trace/samplers/trace_id_ratio.h"
+
+OPENTELEMETRY_BEGIN_NAMESPACE
+namespace sdk
+{
+namespace trace
+{
+namespace
+{
+using opentelemetry::trace::CanonicalCode;
+using opentelemetry::trace::SpanId;
+using opentelemetry::trace::SpanKind;
+using opentelemetry::trace::TraceId;
+
+const std::size_t kCacheLineSize = 64;
+
+// The shard of a trace is selected by the top bits of its hash.
+const int kShardBits = 6;
+
+// The number of recent decisions remembered per shard, for spans that end after their trace
+// was decided.
+const std::size_t kDecisionCacheSize = 256;
+
+/**
+ * Mixes both halves of a trace id. The top bits select the shard, the low bits the bucket.
+ */
+uint64_t HashTraceId(const TraceId &trace_id) noexcept
+{
+  uint64_t halves[2];
+  std::memcpy(halves, trace_id.Id().data(), sizeof(halves));
+  uint64_t hash = (halves[0] ^ halves[1]) * 0x9e3779b97f4a7c15ULL;
+  return hash ^ (hash >> 29);
+}
+
+struct TraceIdHash
+{
+  std::size_t operator()(const TraceId &trace_id) const noexcept
+  {
+    return static_cast<std::size_t>(HashTraceId(trace_id));
+  }
+};
+
+/**
+ * Keeps what the policies need to know about a span, and forwards every update to the
+ * recordable of the downstream processor.
+ */
+class TailSamplingRecordable final : public Recordable
+{
+public:
+  explicit TailSamplingRecordable(std::unique_ptr<Recordable> &&span) noexcept
+      : span_(std::move(span))
+  {}
+
+  void Init(const SpanStartData &data) noexcept override
+  {
+    trace_id_ = data.trace_id;
+    is_root_  = !data.parent_span_id.IsValid();
+    span_->Init(data);
+  }
+
+  void SetIds(TraceId trace_id, SpanId span_id, SpanId parent_span_id) noexcept override
+  {
+    trace_id_ = trace_id;
+    is_root_  = !parent_span_id.IsValid();
+    span_->SetIds(trace_id, span_id, parent_span_id);
+  }
+
+  void SetAttribute(nostd::string_view key,
+                    const opentelemetry::common::AttributeValue &value) noexcept override
+  {
+    span_->SetAttribute(key, value);
+  }
+
+  void AddEvent(nostd::string_view name,
+                core::SystemTimestamp timestamp,
+                const opentelemetry::trace::KeyValueIterable &attributes) noexcept override
+  {
+    span_->AddEvent(name, timestamp, attributes);
+  }
+
+  void SetStatus(CanonicalCode code, nostd::string_view description) noexcept override
+  {
+    has_error_ = code != CanonicalCode::OK;
+    span_->SetStatus(code, description);
+  }
+
+  void SetName(nostd::string_view name) noexcept override { span_->SetName(name); }
+
+  void SetSpanKind(SpanKind span_kind) noexcept override { span_->SetSpanKind(span_kind); }
+
+  void SetStartTime(core::SystemTimestamp start_time) noexcept override
+  {
+    span_->SetStartTime(start_time);
+  }
+
+  void SetDuration(std::chrono::nanoseconds duration) noexcept override
+  {
+    duration_ = duration;
+    span_->SetDuration(duration);
+  }
+
+  std::unique_ptr<Recordable> span_;
+  TraceId trace_id_;
+  bool is_root_   = true;
+  bool has_error_ = false;
+  std::chrono::nanoseconds duration_{0};
+};
+}  // namespace
+
+/**
+ * The buffered traces of a share of the trace ids, in the order they were first seen.
+ */
+struct TailSamplingSpanProcessor::Shard
+{
+  struct Trace
+  {
+    TraceId trace_id;
+    std::vector<std::unique_ptr<Recordable>> spans;
+    bool has_error = false;
+    std::chrono::nanoseconds max_duration{0};
+    std::chrono::steady_clock::time_point deadline;
+
+    // The traces seen before and after this one.
+    Trace *older = nullptr;
+    Trace *newer = nullptr;
+  };
+
+  struct Decision
+  {
+    TraceId trace_id;
+    bool keep = false;
+  };
+
+  /**
+   * Decide a buffered trace and move its spans to kept or dropped.
+   */
+  void Decide(Trace &trace,
+              const TailSamplingSpanProcessor &processor,
+              std::vector<std::unique_ptr<Recordable>> &kept,
+              std::vector<std::unique_ptr<Recordable>> &dropped) noexcept
+  {
+    TraceId trace_id = trace.trace_id;
+    bool keep        = processor.ShouldKeep(trace_id, trace.has_error, trace.max_duration);
+    Remember(trace_id, keep);
+    span_count -= trace.spans.size();
+
+    auto &spans = keep ? kept : dropped;
+    if (spans.empty())
+    {
+      spans.swap(trace.spans);
+    }
+    else
+    {
+      for (auto &span : trace.spans)
+      {
+        spans.push_back(std::move(span));
+      }
+    }
+
+    (trace.older != nullptr ? trace.older->newer : oldest) = trace.newer;
+    (trace.newer != nullptr ? trace.newer->older : newest) = trace.older;
+    traces.erase(trace_id);
+  }
+
+  void Remember(const TraceId &trace_id, bool keep) noexcept
+  {
+    auto &decision    = decisions[HashTraceId(trace_id) % kDecisionCacheSize];
+    decision.trace_id = trace_id;
+    decision.keep     = keep;
+  }
+
+  std::mutex mutex;
+  std::unordered_map<TraceId, Trace, TraceIdHash> traces;
+  Trace *oldest          = nullptr;
+  Trace *newest          = nullptr;
+  std::size_t span_count = 0;
+  std::array<Decision, kDecisionCacheSize> decisions;
+
+  // Keeps shards that are locked by different threads off the same cache line.
+  char padding[kCacheLineSize];
+};
+
+TailSamplingSpanProcessor::TailSamplingSpanProcessor(std::shared_ptr<SpanProcessor> processor,
+                                                     const TailSamplingOptions &options) noexcept
+    : processor_(std::move(processor)),
+      options_(options),
+      max_buffered_spans_per_shard_((options.max_buffered_spans + kShardCount - 1) / kShardCount),
+      probability_threshold_(GetProbabilityThreshold(options.probability)),
+      shards_(new Shard[kShardCount])
+{
+  static_assert(kShardCount == std::size_t(1) << kShardBits, "Every hash must select a shard.");
+  if (options_.sweep_interval.count() > 0)
+  {
+    sweeper_ = std::thread(&TailSamplingSpanProcessor::RunSweeper, this);
+  }
+}
+
+TailSamplingSpanProcessor::~TailSamplingSpanProcessor()
+{
+  StopSweeper();
+}
+
+std::unique_ptr<Recordable> TailSamplingSpanProcessor::MakeRecordable() noexcept
+{
+  return std::unique_ptr<Recordable>(new TailSamplingRecordable(processor_->MakeRecordable()));
+}
+
+void TailSamplingSpanProcessor::OnStart(Recordable &span) noexcept
+{
+  processor_->OnStart(*static_cast<TailSamplingRecordable &>(span).span_);
+}
+
+void TailSamplingSpanProcessor::OnEnd(std::unique_ptr<Recordable> &&span) noexcept
+{
+  if (span == nullptr)
+  {
+    return;
+  }
+  auto &recordable     = static_cast<TailSamplingRecordable &>(*span);
+  const auto &trace_id = recordable.trace_id_;
+  auto hash            = HashTraceId(trace_id);
+  auto &shard          = shards_[hash >> (64 - kShardBits)];
+  auto now             = std::chrono::steady_clock::now();
+
+  // A span that is decided on its own, and the spans of every trace decided along with it.
+  std::unique_ptr<Recordable> single;
+  bool keep_single = false;
+  std::vector<std::unique_ptr<Recordable>> kept;
+  std::vector<std::unique_ptr<Recordable>> dropped;
+  {
+    std::lock_guard<std::mutex> lock(shard.mutex);
+    auto it = shard.traces.find(trace_id);
+    if (it == shard.traces.end())
+    {
+      auto &decision = shard.decisions[hash % kDecisionCacheSize];
+      if (trace_id.IsValid() && decision.trace_id == trace_id)
+      {
+        // A late span of a decided trace.
+        single      = std::move(recordable.span_);
+        keep_single = decision.keep;
+      }
+      else if (recordable.is_root_ || !trace_id.IsValid())
+      {
+        // A trace of a single span.
+        single = std::move(recordable.span_);
+        keep_single = ShouldKeep(trace_id, recordable.has_error_, recordable.duration_);
+        if (trace_id.IsValid())
+        {
+          shard.Remember(trace_id, keep_single);
+        }
+      }
+      else
+      {
+        it             = shard.traces.emplace(trace_id, Shard::Trace()).first;
+        auto &trace    = it->second;
+        trace.trace_id = trace_id;
+        trace.deadline = now + options_.decision_wait;
+        trace.older    = shard.newest;
+        (shard.newest != nullptr ? shard.newest->newer : shard.oldest) = &trace;
+        shard.newest = &trace;
+      }
+    }
+
+    if (it != shard.traces.end())
+    {
+      auto &trace = it->second;
+      trace.spans.push_back(std::move(recordable.span_));
+      trace.has_error    = trace.has_error || recordable.has_error_;
+      trace.max_duration = std::max(trace.max_duration, recordable.duration_);
+      ++shard.span_count;
+      if (recordable.is_root_)
+      {
+        shard.Decide(trace, *this, kept, dropped);
+      }
+    }
+
+    while (shard.oldest != nullptr && (shard.oldest->deadline <= now ||
+                                       shard.span_count > max_buffered_spans_per_shard_))
+    {
+      shard.Decide(*shard.oldest, *this, kept, dropped);
+    }
+  }
+
+  if (single != nullptr && keep_single)
+  {
+    processor_->OnEnd(std::move(single));
+  }
+  for (auto &kept_span : kept)
+  {
+    processor_->OnEnd(std::move(kept_span));
+  }
+}
+
+void TailSamplingSpanProcessor::ForceFlush(std::chrono::microseconds timeout) noexcept
+{
+  for (std::size_t i = 0; i < kShardCount; ++i)
+  {
+    auto &shard = shards_[i];
+    std::vector<std::unique_ptr<Recordable>> kept;
+    std::vector<std::unique_ptr<Recordable>> dropped;
+    {
+      std::lock_guard<std::mutex> lock(shard.mutex);
+      while (shard.oldest != nullptr)
+      {
+        shard.Decide(*shard.oldest, *this, kept, dropped);
+      }
+    }
+    for (auto &span : kept)
+    {
+      processor_->OnEnd(std::move(span));
+    }
+  }
+  processor_->ForceFlush(timeout);
+}
+
+void TailSamplingSpanProcessor::Shutdown(std::chrono::microseconds timeout) noexcept
+{
+  StopSweeper();
+  ForceFlush(timeout);
+  processor_->Shutdown(timeout);
+}
+
+void TailSamplingSpanProcessor::DecideTimedOutTraces() noexcept
+{
+  for (std::size_t i = 0; i < kShardCount; ++i)
+  {
+    auto &shard = shards_[i];
+    auto now    = std::chrono::steady_clock::now();
+    std::vector<std::unique_ptr<Recordable>> kept;
+    std::vector<std::unique_ptr<Recordable>> dropped;
+    {
+      std::lock_guard<std::mutex> lock(shard.mutex);
+      while (shard.oldest != nullptr && shard.oldest->deadline <= now)
+      {
+        shard.Decide(*shard.oldest, *this, kept, dropped);
+      }
+    }
+    for (auto &span : kept)
+    {
+      processor_->OnEnd(std::move(span));
+    }
+  }
+}
+
+void TailSamplingSpanProcessor::RunSweeper() noexcept
+{
+  std::unique_lock<std::mutex> lock(sweeper_mutex_);
+  while (!sweeper_cv_.wait_for(lock, options_.sweep_interval, [this] { return is_stopping_; }))
+  {
+    lock.unlock();
+    DecideTimedOutTraces();
+    lock.lock();
+  }
+}
+
+void TailSamplingSpanProcessor::StopSweeper() noexcept
+{
+  {
+    std::lock_guard<std::mutex> lock(sweeper_mutex_);
+    is_stopping_ = true;
+  }
+  sweeper_cv_.notify_all();
+  if (sweeper_.joinable())
+  {
+    sweeper_.join();
+  }
+}
+
+std::size_t TailSamplingSpanProcessor::GetBufferedSpanCount() const noexcept
+{
+  std::size_t count = 0;
+  for (std::size_t i = 0; i < kShardCount; ++i)
+  {
+    std::lock_guard<std::mutex> lock(shards_[i].mutex);
+    count += shards_[i].span_count;
+  }
+  return count;
+}
+
+bool TailSamplingSpanProcessor::ShouldKeep(TraceId trace_id,
+                                           bool has_error,
+                                           std::chrono::nanoseconds max_duration) const noexcept
+{
+  if (options_.keep_errors && has_error)
+  {
+    return true;
+  }
+  if (options_.latency_threshold.count() > 0 && max_duration >= options_.latency_threshold)
+  {
+    return true;
+  }
+  return probability_threshold_ != 0 && GetTraceIdRatioBits(trace_id) <= probability_threshold_;
+}
+}  // namespace trace
+}  // namespace sdk
+OPENTELEMETRY_END_NAMESPACE
@@ -1,7 +1,11 @@
 #include "opentelemetry/sdk/trace/tracer.h"
 
+#include <new>
+#include <utility>
+
 #include "opentelemetry/sdk/common/atomic_shared_ptr.h"
 #include "opentelemetry/version.h"
+#include "src/common/random.h"
 #include "src/trace/span.h"
 
 OPENTELEMETRY_BEGIN_NAMESPACE
@@ -9,6 +13,36 @@ namespace sdk
 {
 namespace trace
 {
+namespace
+{
+/**
+ * Constructs a span in the storage, or on the heap if the storage is nullptr.
+ */
+template <class T, class... Args>
+trace_api::Span *MakeSpan(void *storage, Args &&... args) noexcept
+{
+  if (storage == nullptr)
+  {
+    return new (std::nothrow) T{std::forward<Args>(args)...};
+  }
+  return new (storage) T{std::forward<Args>(args)...};
+}
+}  // namespace
+
+trace_api::TraceId GenerateTraceId() noexcept
+{
+  uint8_t buffer[trace_api::TraceId::kSize];
+  opentelemetry::sdk::common::Random::GenerateRandomBuffer(buffer);
+  return trace_api::TraceId(buffer);
+}
+
+trace_api::SpanId GenerateSpanId() noexcept
+{
+  uint8_t buffer[trace_api::SpanId::kSize];
+  opentelemetry::sdk::common::Random::GenerateRandomBuffer(buffer);
+  return trace_api::SpanId(buffer);
+}
+
 Tracer::Tracer(std::shared_ptr<SpanProcessor> processor, std::shared_ptr<Sampler> sampler) noexcept
     : processor_{processor}, sampler_{sampler}
 {}
@@ -33,29 +67,40 @@ nostd::unique_ptr<trace_api::Span> Tracer::StartSpan(
     const trace_api::KeyValueIterable &attributes,
     const trace_api::StartSpanOptions &options) noexcept
 {
+  return nostd::unique_ptr<trace_api::Span>{StartSpan(name, attributes, options, nullptr)};
+}
+
+trace_api::Span *Tracer::StartSpanInStorage(nostd::string_view name,
+                                            const trace_api::KeyValueIterable &attributes,
+                                            const trace_api::StartSpanOptions &options,
+                                            void *storage,
+                                            std::size_t storage_size) noexcept
+{
+  if (storage_size < sizeof(Span) || storage_size < sizeof(trace_api::NoopSpan))
+  {
+    return nullptr;
+  }
+  return StartSpan(name, attributes, options, storage);
+}
+
+trace_api::Span *Tracer::StartSpan(nostd::string_view name,
+                                   const trace_api::KeyValueIterable &attributes,
+                                   const trace_api::StartSpanOptions &options,
+                                   void *storage) noexcept
+{
+  auto trace_id = GenerateTraceId();
+
   // TODO: replace nullptr with parent context in span context
   auto sampling_result =
-      sampler_->ShouldSample(nullptr, trace_api::TraceId(), name, options.kind, attributes);
+      sampler_->ShouldSample(nullptr, trace_id, name, options.kind, attributes);
   if (sampling_result.decision == Decision::NOT_RECORD)
   {
-    return nostd::unique_ptr<trace_api::Span>{new (std::nothrow)
-                                                  trace_api::NoopSpan{this->shared_from_this()}};
+    return MakeSpan<trace_api::NoopSpan>(storage, this->shared_from_this());
   }
   else
   {
-    auto span = nostd::unique_ptr<trace_api::Span>{new (std::nothrow) Span{
-        this->shared_from_this(), processor_.load(), name, attributes, options}};
-
-    // if the attributes is not nullptr, add attributes to the span.
-    if (sampling_result.attributes)
-    {
-      for (auto &kv : *sampling_result.attributes)
-      {
-        span->SetAttribute(kv.first, kv.second);
-      }
-    }
-
-    return span;
+    return MakeSpan<Span>(storage, this->shared_from_this(), processor_.load(), name, attributes,
+                          sampling_result.attributes, options, trace_id, GenerateSpanId());
   }
 }
 
@@ -1,5 +1,6 @@
 #include "src/common/circular_buffer.h"
 
+#include <algorithm>
 #include <cassert>
 #include <random>
 #include <thread>
@@ -55,8 +56,11 @@ void RunNumberConsumer(CircularBuffer<uint32_t> &buffer,
 {
   while (true)
   {
-    auto allotment = buffer.Peek();
-    if (exit && allotment.empty())
+    // Read exit before peeking, so that elements added between the peek and
+    // the producers finishing are not missed.
+    bool is_exiting = exit;
+    auto allotment  = buffer.Peek();
+    if (is_exiting && allotment.empty())
     {
       return;
     }
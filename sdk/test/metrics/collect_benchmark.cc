@@ -0,0 +1,53 @@
+#include "opentelemetry/sdk/metrics/meter.h"
+
+#include <map>
+#include <string>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+namespace
+{
+using opentelemetry::sdk::metrics::AggregationTemporality;
+using opentelemetry::sdk::metrics::Meter;
+using opentelemetry::sdk::metrics::MetricRecord;
+using BoundCounter =
+    opentelemetry::nostd::shared_ptr<opentelemetry::metrics::BoundCounter<int64_t>>;
+
+// Collects a counter with state.range(0) label sets, each updated between two collections.
+void BM_CollectSeries(benchmark::State &state, AggregationTemporality temporality)
+{
+  Meter meter(Meter::GetDefaultBoundaries(), static_cast<std::size_t>(state.range(0)));
+  auto counter = meter.NewIntCounter("requests");
+  std::vector<BoundCounter> bound;
+  for (int64_t i = 0; i < state.range(0); ++i)
+  {
+    bound.push_back(counter->Bind(
+        std::map<std::string, std::string>{{"method", "GET"}, {"route", std::to_string(i)}}));
+  }
+
+  std::vector<MetricRecord> records;
+  for (auto _ : state)
+  {
+    state.PauseTiming();
+    records.clear();
+    for (auto &bound_counter : bound)
+    {
+      bound_counter->Add(1);
+    }
+    state.ResumeTiming();
+    meter.Collect(records, temporality, 5);
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK_CAPTURE(BM_CollectSeries, Delta, AggregationTemporality::Delta)
+    ->Arg(1000)
+    ->Arg(100000)
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(BM_CollectSeries, Cumulative, AggregationTemporality::Cumulative)
+    ->Arg(1000)
+    ->Arg(100000)
+    ->Unit(benchmark::kMillisecond);
+
+}  // namespace
+BENCHMARK_MAIN();
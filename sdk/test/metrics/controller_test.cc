@@ -0,0 +1,181 @@
+#include "opentelemetry/sdk/metrics/controller.h"
+
+#include <chrono>
+#include <condition_variable>
+#include <map>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+using namespace opentelemetry::sdk::metrics;
+namespace core  = opentelemetry::core;
+namespace nostd = opentelemetry::nostd;
+
+/**
+ * Keeps the sum of the value of every export.
+ */
+class TestExporter final : public MetricExporter
+{
+public:
+  struct Export
+  {
+    std::vector<int64_t> sums;
+    std::vector<core::SystemTimestamp> record_start_times;
+    core::SystemTimestamp start_time;
+    core::SystemTimestamp end_time;
+  };
+
+  struct State
+  {
+    std::mutex mtx;
+    std::condition_variable cv;
+    std::vector<Export> exports;
+    bool is_shutdown = false;
+  };
+
+  TestExporter(AggregationTemporality temporality, std::shared_ptr<State> state)
+      : temporality_{temporality}, state_{std::move(state)}
+  {}
+
+  AggregationTemporality GetAggregationTemporality() const noexcept override
+  {
+    return temporality_;
+  }
+
+  ExportResult Export(const std::vector<MetricRecord> &records,
+                      core::SystemTimestamp start_time,
+                      core::SystemTimestamp end_time) noexcept override
+  {
+    std::lock_guard<std::mutex> lock(state_->mtx);
+    state_->exports.push_back({{}, {}, start_time, end_time});
+    for (auto &record : records)
+    {
+      state_->exports.back().sums.push_back(nostd::get<int64_t>(record.value));
+      state_->exports.back().record_start_times.push_back(record.start_time);
+    }
+    state_->cv.notify_all();
+    return ExportResult::kSuccess;
+  }
+
+  void Shutdown(std::chrono::microseconds) noexcept override
+  {
+    std::lock_guard<std::mutex> lock(state_->mtx);
+    state_->is_shutdown = true;
+  }
+
+private:
+  const AggregationTemporality temporality_;
+  const std::shared_ptr<State> state_;
+};
+
+TEST(PushController, CollectsPeriodically)
+{
+  auto meter   = std::make_shared<Meter>();
+  auto state   = std::make_shared<TestExporter::State>();
+  auto counter = meter->NewIntCounter("requests");
+  PushController controller(
+      meter,
+      std::unique_ptr<MetricExporter>(new TestExporter(AggregationTemporality::Delta, state)),
+      std::chrono::milliseconds(10));
+  ASSERT_TRUE(controller.Start());
+  EXPECT_FALSE(controller.Start());
+
+  counter->Add(1);
+  {
+    std::unique_lock<std::mutex> lock(state->mtx);
+    ASSERT_TRUE(state->cv.wait_for(lock, std::chrono::seconds(10),
+                                   [&] { return state->exports.size() >= 2; }));
+    // Delta intervals follow each other.
+    EXPECT_EQ(state->exports[1].start_time, state->exports[0].end_time);
+  }
+  counter->Add(2);
+  controller.Stop();
+
+  std::lock_guard<std::mutex> lock(state->mtx);
+  EXPECT_TRUE(state->is_shutdown);
+  int64_t total = 0;
+  for (auto &exported : state->exports)
+  {
+    for (auto sum : exported.sums)
+    {
+      total += sum;
+    }
+  }
+  EXPECT_EQ(total, 3);
+}
+
+TEST(PushController, CumulativeTemporality)
+{
+  auto meter   = std::make_shared<Meter>();
+  auto state   = std::make_shared<TestExporter::State>();
+  auto counter = meter->NewIntCounter("requests");
+  PushController controller(
+      meter,
+      std::unique_ptr<MetricExporter>(new TestExporter(AggregationTemporality::Cumulative, state)),
+      std::chrono::hours(1));
+
+  counter->Add(1);
+  controller.Collect();
+  counter->Add(2);
+  controller.Collect();
+  controller.Stop();
+
+  std::lock_guard<std::mutex> lock(state->mtx);
+  ASSERT_EQ(state->exports.size(), 3);
+  EXPECT_EQ(state->exports[0].sums, std::vector<int64_t>{1});
+  EXPECT_EQ(state->exports[1].sums, std::vector<int64_t>{3});
+  EXPECT_EQ(state->exports[2].sums, std::vector<int64_t>{3});
+  // Cumulative values all start at the same time.
+  EXPECT_EQ(state->exports[1].start_time, state->exports[0].start_time);
+}
+
+TEST(PushController, CumulativeSeriesStartWhenCreated)
+{
+  auto meter   = std::make_shared<Meter>();
+  auto state   = std::make_shared<TestExporter::State>();
+  auto counter = meter->NewIntCounter("requests");
+  PushController controller(
+      meter,
+      std::unique_ptr<MetricExporter>(new TestExporter(AggregationTemporality::Cumulative, state)),
+      std::chrono::hours(1), 1);
+
+  counter->Add(1);
+  controller.Collect();
+  // The series is idle, so it is reclaimed, and the next update creates it again.
+  controller.Collect();
+  std::this_thread::sleep_for(std::chrono::milliseconds(1));
+  counter->Add(2);
+  controller.Collect();
+  controller.Stop();
+
+  std::lock_guard<std::mutex> lock(state->mtx);
+  ASSERT_GE(state->exports.size(), 3);
+  EXPECT_EQ(state->exports[0].sums, std::vector<int64_t>{1});
+  EXPECT_EQ(state->exports[2].sums, std::vector<int64_t>{2});
+  ASSERT_EQ(state->exports[0].record_start_times.size(), 1);
+  ASSERT_EQ(state->exports[2].record_start_times.size(), 1);
+  EXPECT_GT(state->exports[2].record_start_times[0].time_since_epoch(),
+            state->exports[0].record_start_times[0].time_since_epoch());
+  EXPECT_GE(state->exports[0].record_start_times[0].time_since_epoch(),
+            state->exports[0].start_time.time_since_epoch());
+}
+
+TEST(PushController, StopWithoutStart)
+{
+  auto meter = std::make_shared<Meter>();
+  auto state = std::make_shared<TestExporter::State>();
+  meter->NewIntCounter("requests")->Add(5);
+  {
+    PushController controller(
+        meter,
+        std::unique_ptr<MetricExporter>(new TestExporter(AggregationTemporality::Delta, state)),
+        std::chrono::hours(1));
+  }
+
+  std::lock_guard<std::mutex> lock(state->mtx);
+  ASSERT_EQ(state->exports.size(), 1);
+  EXPECT_EQ(state->exports[0].sums, std::vector<int64_t>{5});
+  EXPECT_TRUE(state->is_shutdown);
+}
@@ -0,0 +1,94 @@
+#include "opentelemetry/sdk/metrics/aggregator/sum_aggregator.h"
+#include "opentelemetry/sdk/metrics/meter.h"
+
+#include <atomic>
+#include <cstdint>
+
+#include <benchmark/benchmark.h>
+
+namespace
+{
+using opentelemetry::sdk::metrics::Meter;
+using opentelemetry::sdk::metrics::SumAggregator;
+
+// Each benchmark runs with 1 to 64 threads updating the same sum, to show how updates scale
+// with the number of cores.
+
+void BM_SingleAtomicAdd(benchmark::State &state)
+{
+  static std::atomic<int64_t> sum{0};
+  for (auto _ : state)
+  {
+    sum.fetch_add(1, std::memory_order_relaxed);
+  }
+}
+BENCHMARK(BM_SingleAtomicAdd)->ThreadRange(1, 64)->UseRealTime();
+
+void BM_SumAggregatorUpdate(benchmark::State &state)
+{
+  static SumAggregator<int64_t> aggregator;
+  for (auto _ : state)
+  {
+    aggregator.Update(1);
+  }
+}
+BENCHMARK(BM_SumAggregatorUpdate)->ThreadRange(1, 64)->UseRealTime();
+
+void BM_DoubleSumAggregatorUpdate(benchmark::State &state)
+{
+  static SumAggregator<double> aggregator;
+  for (auto _ : state)
+  {
+    aggregator.Update(1.0);
+  }
+}
+BENCHMARK(BM_DoubleSumAggregatorUpdate)->ThreadRange(1, 64)->UseRealTime();
+
+void BM_CounterAdd(benchmark::State &state)
+{
+  static Meter meter;
+  static auto counter = meter.NewIntCounter("requests");
+  for (auto _ : state)
+  {
+    counter->Add(1);
+  }
+}
+BENCHMARK(BM_CounterAdd)->ThreadRange(1, 64)->UseRealTime();
+
+void BM_CounterAddWithLabels(benchmark::State &state)
+{
+  static Meter meter;
+  static auto counter = meter.NewIntCounter("requests");
+  for (auto _ : state)
+  {
+    counter->Add(1, {{"method", "GET"}, {"code", 200}});
+  }
+}
+BENCHMARK(BM_CounterAddWithLabels)->ThreadRange(1, 64)->UseRealTime();
+
+void BM_BoundCounterAdd(benchmark::State &state)
+{
+  static Meter meter;
+  static auto bound = meter.NewIntCounter("requests")->Bind({{"method", "GET"}, {"code", 200}});
+  for (auto _ : state)
+  {
+    bound->Add(1);
+  }
+}
+BENCHMARK(BM_BoundCounterAdd)->ThreadRange(1, 64)->UseRealTime();
+
+// Every recording has a new label set, folded into the overflow label set past the limit.
+void BM_CounterAddOverflow(benchmark::State &state)
+{
+  static Meter meter(Meter::GetDefaultBoundaries(), 100);
+  static auto counter = meter.NewIntCounter("requests");
+  int64_t request_id  = state.thread_index() * (int64_t{1} << 40);
+  for (auto _ : state)
+  {
+    counter->Add(1, {{"request_id", ++request_id}});
+  }
+}
+BENCHMARK(BM_CounterAddOverflow)->ThreadRange(1, 64)->UseRealTime();
+
+}  // namespace
+BENCHMARK_MAIN();
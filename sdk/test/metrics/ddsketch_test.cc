@@ -0,0 +1,238 @@
+#include "opentelemetry/sdk/metrics/aggregator/ddsketch.h"
+#include "opentelemetry/sdk/metrics/aggregator/sketch_aggregator.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <random>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+using opentelemetry::sdk::metrics::AggregationTemporality;
+using opentelemetry::sdk::metrics::DDSketch;
+using opentelemetry::sdk::metrics::DDSketchOptions;
+using opentelemetry::sdk::metrics::SketchAggregator;
+
+const double kQuantiles[] = {0, 0.01, 0.1, 0.25, 0.5, 0.75, 0.9, 0.95, 0.99, 0.999, 1};
+
+/*
+ * Returns the exact quantile of sorted values, using the same rank as DDSketch.
+ */
+double ExactQuantile(const std::vector<double> &sorted, double quantile)
+{
+  return sorted[static_cast<std::size_t>(std::floor(quantile * (sorted.size() - 1)))];
+}
+
+/*
+ * Checks every quantile estimate of a sketch of values against the exact quantile.
+ */
+void ExpectAccurate(const DDSketch &sketch, std::vector<double> values, double relative_accuracy)
+{
+  std::sort(values.begin(), values.end());
+  for (double quantile : kQuantiles)
+  {
+    double exact    = ExactQuantile(values, quantile);
+    double estimate = sketch.GetQuantile(quantile);
+    EXPECT_LE(std::abs(estimate - exact), relative_accuracy * std::abs(exact) + 1e-12)
+        << "quantile " << quantile << " exact " << exact << " estimate " << estimate;
+  }
+}
+
+DDSketch MakeSketch(const std::vector<double> &values, const DDSketchOptions &options)
+{
+  DDSketch sketch(options);
+  for (double value : values)
+  {
+    sketch.Add(value);
+  }
+  return sketch;
+}
+
+TEST(DDSketch, Empty)
+{
+  DDSketch sketch;
+  EXPECT_EQ(sketch.GetCount(), 0);
+  EXPECT_TRUE(std::isnan(sketch.GetQuantile(0.5)));
+}
+
+TEST(DDSketch, Statistics)
+{
+  DDSketch sketch;
+  for (double value : {3.0, -1.0, 0.0, 10.0})
+  {
+    sketch.Add(value);
+  }
+  sketch.Add(std::nan(""));
+  EXPECT_EQ(sketch.GetCount(), 4);
+  EXPECT_DOUBLE_EQ(sketch.GetSum(), 12);
+  EXPECT_EQ(sketch.GetMin(), -1);
+  EXPECT_EQ(sketch.GetMax(), 10);
+  EXPECT_EQ(sketch.GetQuantile(0), -1);
+  EXPECT_EQ(sketch.GetQuantile(1), 10);
+  EXPECT_TRUE(std::isnan(sketch.GetQuantile(1.5)));
+}
+
+TEST(DDSketch, IgnoresInfiniteValues)
+{
+  DDSketch sketch;
+  sketch.Add(2);
+  sketch.Add(std::numeric_limits<double>::infinity());
+  sketch.Add(-std::numeric_limits<double>::infinity());
+  EXPECT_EQ(sketch.GetCount(), 1);
+  EXPECT_EQ(sketch.GetSum(), 2);
+  EXPECT_EQ(sketch.GetMin(), 2);
+  EXPECT_EQ(sketch.GetMax(), 2);
+  EXPECT_NEAR(sketch.GetQuantile(1), 2, 0.02);
+}
+
+TEST(DDSketch, ExtremeValuesWithTinyAccuracy)
+{
+  DDSketchOptions options;
+  options.relative_accuracy = 1e-12;
+  DDSketch sketch(options);
+  for (double value : {std::numeric_limits<double>::max(), std::numeric_limits<double>::min(),
+                       -std::numeric_limits<double>::max(), 1.0})
+  {
+    sketch.Add(value);
+  }
+  EXPECT_EQ(sketch.GetCount(), 4);
+}
+
+TEST(DDSketch, AccuracyUniform)
+{
+  std::mt19937_64 generator{1};
+  std::uniform_real_distribution<double> distribution(0, 1000);
+  std::vector<double> values(100000);
+  for (auto &value : values)
+  {
+    value = distribution(generator);
+  }
+  ExpectAccurate(MakeSketch(values, DDSketchOptions()), values, 0.01);
+}
+
+TEST(DDSketch, AccuracyLognormal)
+{
+  std::mt19937_64 generator{2};
+  std::lognormal_distribution<double> distribution(0, 2);
+  std::vector<double> values(100000);
+  for (auto &value : values)
+  {
+    value = distribution(generator);
+  }
+  DDSketchOptions options;
+  options.relative_accuracy = 0.005;
+  ExpectAccurate(MakeSketch(values, options), values, 0.005);
+}
+
+TEST(DDSketch, AccuracyMixedSigns)
+{
+  std::mt19937_64 generator{3};
+  std::normal_distribution<double> distribution(0, 100);
+  std::vector<double> values(100000);
+  for (auto &value : values)
+  {
+    value = distribution(generator);
+  }
+  values[0] = 0;
+  ExpectAccurate(MakeSketch(values, DDSketchOptions()), values, 0.01);
+}
+
+TEST(DDSketch, MergeIsLossless)
+{
+  std::mt19937_64 generator{4};
+  std::exponential_distribution<double> distribution(0.01);
+  std::vector<double> values(30000);
+  for (auto &value : values)
+  {
+    value = distribution(generator);
+  }
+
+  DDSketch merged;
+  for (std::size_t part = 0; part < 3; ++part)
+  {
+    std::vector<double> part_values(values.begin() + part * 10000,
+                                    values.begin() + (part + 1) * 10000);
+    EXPECT_TRUE(merged.Merge(MakeSketch(part_values, DDSketchOptions())));
+  }
+  auto whole = MakeSketch(values, DDSketchOptions());
+  EXPECT_EQ(merged.GetCount(), whole.GetCount());
+  for (double quantile : kQuantiles)
+  {
+    EXPECT_EQ(merged.GetQuantile(quantile), whole.GetQuantile(quantile));
+  }
+
+  DDSketchOptions other_accuracy;
+  other_accuracy.relative_accuracy = 0.05;
+  EXPECT_FALSE(merged.Merge(DDSketch(other_accuracy)));
+}
+
+TEST(DDSketch, CollapsingBoundsMemory)
+{
+  DDSketchOptions options;
+  options.max_bin_count = 128;
+  DDSketch sketch(options);
+  std::vector<double> values;
+  for (double value = 1e-6; value < 1e6; value *= 1.001)
+  {
+    values.push_back(value);
+    sketch.Add(value);
+  }
+  EXPECT_LE(sketch.GetBinCount(), 128);
+
+  // The lowest bins are collapsed, so the high quantiles stay accurate. With 128 bins the
+  // sketch only resolves about one decade of the twelve spanned by the values.
+  std::sort(values.begin(), values.end());
+  for (double quantile : {0.95, 0.99, 0.999, 1.0})
+  {
+    double exact = ExactQuantile(values, quantile);
+    EXPECT_NEAR(sketch.GetQuantile(quantile), exact, 0.01 * exact);
+  }
+}
+
+TEST(SketchAggregator, ConcurrentUpdates)
+{
+  SketchAggregator<int64_t> aggregator{DDSketchOptions()};
+  const int kThreads = 8;
+  const int kUpdates = 10000;
+  std::vector<std::thread> threads;
+  for (int i = 0; i < kThreads; ++i)
+  {
+    threads.emplace_back([&aggregator] {
+      for (int j = 1; j <= kUpdates; ++j)
+      {
+        aggregator.Update(j);
+      }
+    });
+  }
+  for (auto &thread : threads)
+  {
+    thread.join();
+  }
+
+  DDSketch sketch;
+  EXPECT_TRUE(aggregator.Checkpoint(AggregationTemporality::Delta, sketch));
+  EXPECT_EQ(sketch.GetCount(), kThreads * kUpdates);
+  EXPECT_DOUBLE_EQ(sketch.GetSum(), kThreads * (kUpdates * (kUpdates + 1.0) / 2));
+  EXPECT_NEAR(sketch.GetQuantile(0.5), kUpdates / 2, 0.01 * kUpdates / 2);
+}
+
+TEST(SketchAggregator, Checkpoint)
+{
+  SketchAggregator<double> aggregator{DDSketchOptions()};
+  DDSketch sketch;
+  EXPECT_FALSE(aggregator.Checkpoint(AggregationTemporality::Cumulative, sketch));
+  EXPECT_EQ(sketch.GetCount(), 0);
+
+  aggregator.Update(1);
+  aggregator.Update(2);
+  EXPECT_TRUE(aggregator.Checkpoint(AggregationTemporality::Cumulative, sketch));
+  EXPECT_EQ(sketch.GetCount(), 2);
+  aggregator.Update(3);
+  EXPECT_TRUE(aggregator.Checkpoint(AggregationTemporality::Cumulative, sketch));
+  EXPECT_EQ(sketch.GetCount(), 3);
+  EXPECT_EQ(sketch.GetMax(), 3);
+  EXPECT_FALSE(aggregator.Checkpoint(AggregationTemporality::Cumulative, sketch));
+  EXPECT_EQ(sketch.GetCount(), 3);
+}
@@ -0,0 +1,136 @@
+#include "opentelemetry/sdk/metrics/aggregator/histogram_aggregator.h"
+
+#include <algorithm>
+#include <limits>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+using opentelemetry::sdk::metrics::AggregationTemporality;
+using opentelemetry::sdk::metrics::FindHistogramBucket;
+using opentelemetry::sdk::metrics::HistogramAggregator;
+using opentelemetry::sdk::metrics::HistogramValue;
+using opentelemetry::sdk::metrics::kMaxAggregatorStripeCount;
+
+TEST(HistogramAggregator, FindBucketAtBoundaries)
+{
+  std::vector<double> boundaries = {0, 5, 10};
+  auto find = [&](double value) {
+    return FindHistogramBucket(boundaries.data(), boundaries.size(), value);
+  };
+  EXPECT_EQ(find(-1), 0);
+  EXPECT_EQ(find(0), 0);
+  EXPECT_EQ(find(0.5), 1);
+  EXPECT_EQ(find(5), 1);
+  EXPECT_EQ(find(7), 2);
+  EXPECT_EQ(find(10), 2);
+  EXPECT_EQ(find(11), 3);
+  EXPECT_EQ(find(std::numeric_limits<double>::infinity()), 3);
+  EXPECT_EQ(FindHistogramBucket(nullptr, 0, 42), 0);
+}
+
+TEST(HistogramAggregator, FindBucketMatchesLowerBound)
+{
+  for (std::size_t size = 1; size <= 70; ++size)
+  {
+    std::vector<double> boundaries;
+    for (std::size_t i = 0; i < size; ++i)
+    {
+      boundaries.push_back(static_cast<double>(i * 2));
+    }
+    for (double value = -1; value <= size * 2; value += 0.5)
+    {
+      auto expected = std::lower_bound(boundaries.begin(), boundaries.end(), value) -
+                      boundaries.begin();
+      ASSERT_EQ(FindHistogramBucket(boundaries.data(), size, value), expected)
+          << "size " << size << " value " << value;
+    }
+  }
+}
+
+TEST(HistogramAggregator, Checkpoint)
+{
+  HistogramAggregator<double> aggregator(
+      std::make_shared<const std::vector<double>>(std::vector<double>{1, 10}));
+  for (double value : {0.5, 1.0, 2.0, 10.0, 100.0})
+  {
+    aggregator.Update(value);
+  }
+  aggregator.Update(std::numeric_limits<double>::quiet_NaN());
+
+  HistogramValue histogram;
+  EXPECT_TRUE(aggregator.Checkpoint(AggregationTemporality::Delta, histogram));
+  EXPECT_EQ(*histogram.boundaries, (std::vector<double>{1, 10}));
+  EXPECT_EQ(histogram.counts, (std::vector<uint64_t>{2, 2, 1}));
+  EXPECT_EQ(histogram.count, 5);
+  EXPECT_DOUBLE_EQ(histogram.sum, 113.5);
+
+  // Every checkpoint takes the values recorded since the previous one.
+  aggregator.Update(5);
+  EXPECT_TRUE(aggregator.Checkpoint(AggregationTemporality::Delta, histogram));
+  EXPECT_EQ(histogram.counts, (std::vector<uint64_t>{0, 1, 0}));
+  EXPECT_EQ(histogram.count, 1);
+  EXPECT_DOUBLE_EQ(histogram.sum, 5);
+  EXPECT_FALSE(aggregator.Checkpoint(AggregationTemporality::Delta, histogram));
+  EXPECT_EQ(histogram.count, 0);
+}
+
+TEST(HistogramAggregator, CumulativeCheckpoint)
+{
+  HistogramAggregator<int64_t> aggregator(
+      std::make_shared<const std::vector<double>>(std::vector<double>{1, 10}));
+  aggregator.Update(1);
+  HistogramValue histogram;
+  EXPECT_TRUE(aggregator.Checkpoint(AggregationTemporality::Cumulative, histogram));
+  aggregator.Update(20);
+  EXPECT_TRUE(aggregator.Checkpoint(AggregationTemporality::Cumulative, histogram));
+  EXPECT_EQ(histogram.counts, (std::vector<uint64_t>{1, 0, 1}));
+  EXPECT_EQ(histogram.count, 2);
+  EXPECT_DOUBLE_EQ(histogram.sum, 21);
+  EXPECT_FALSE(aggregator.Checkpoint(AggregationTemporality::Cumulative, histogram));
+  EXPECT_EQ(histogram.count, 2);
+}
+
+TEST(HistogramAggregator, NoBoundaries)
+{
+  HistogramAggregator<int64_t> aggregator(std::make_shared<const std::vector<double>>());
+  aggregator.Update(3);
+  aggregator.Update(-4);
+
+  HistogramValue histogram;
+  aggregator.Checkpoint(AggregationTemporality::Delta, histogram);
+  EXPECT_EQ(histogram.counts, (std::vector<uint64_t>{2}));
+  EXPECT_DOUBLE_EQ(histogram.sum, -1);
+}
+
+TEST(HistogramAggregator, ConcurrentUpdates)
+{
+  HistogramAggregator<int64_t> aggregator(
+      std::make_shared<const std::vector<double>>(std::vector<double>{10, 20, 30}));
+  // More threads than an aggregator has stripes, so that some share one.
+  const int kThreads = 2 * static_cast<int>(kMaxAggregatorStripeCount);
+  const int kUpdates = 10000;
+  std::vector<std::thread> threads;
+  for (int i = 0; i < kThreads; ++i)
+  {
+    threads.emplace_back([&aggregator] {
+      for (int j = 0; j < kUpdates; ++j)
+      {
+        aggregator.Update(j % 40);
+      }
+    });
+  }
+  for (auto &thread : threads)
+  {
+    thread.join();
+  }
+
+  HistogramValue histogram;
+  aggregator.Checkpoint(AggregationTemporality::Delta, histogram);
+  EXPECT_EQ(histogram.counts,
+            (std::vector<uint64_t>{kThreads * kUpdates * 11 / 40, kThreads * kUpdates * 10 / 40,
+                                   kThreads * kUpdates * 10 / 40, kThreads * kUpdates * 9 / 40}));
+  EXPECT_EQ(histogram.count, kThreads * kUpdates);
+  EXPECT_DOUBLE_EQ(histogram.sum, kThreads * (kUpdates / 40) * (39 * 40 / 2));
+}
@@ -0,0 +1,122 @@
+#include "opentelemetry/sdk/metrics/aggregator/histogram_aggregator.h"
+#include "opentelemetry/sdk/metrics/meter.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <random>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+namespace
+{
+using opentelemetry::sdk::metrics::FindHistogramBucket;
+using opentelemetry::sdk::metrics::HistogramAggregator;
+using opentelemetry::sdk::metrics::Meter;
+
+// The benchmarks take the number of boundaries as their argument and run with 1 to 64 threads.
+
+std::vector<double> MakeBoundaries(std::size_t count)
+{
+  std::vector<double> boundaries;
+  for (std::size_t i = 0; i < count; ++i)
+  {
+    boundaries.push_back(static_cast<double>(i * 10));
+  }
+  return boundaries;
+}
+
+std::vector<double> MakeValues(std::size_t boundary_count)
+{
+  std::mt19937_64 generator{0};
+  std::uniform_real_distribution<double> distribution(-10.0, boundary_count * 10.0);
+  std::vector<double> values(1024);
+  for (auto &value : values)
+  {
+    value = distribution(generator);
+  }
+  return values;
+}
+
+void BM_FindBucketLowerBound(benchmark::State &state)
+{
+  auto boundaries = MakeBoundaries(state.range(0));
+  auto values     = MakeValues(boundaries.size());
+  std::size_t i   = 0;
+  for (auto _ : state)
+  {
+    benchmark::DoNotOptimize(
+        std::lower_bound(boundaries.begin(), boundaries.end(), values[i++ & 1023]));
+  }
+}
+BENCHMARK(BM_FindBucketLowerBound)->Arg(16)->Arg(64);
+
+void BM_FindBucketBranchless(benchmark::State &state)
+{
+  auto boundaries = MakeBoundaries(state.range(0));
+  auto values     = MakeValues(boundaries.size());
+  std::size_t i   = 0;
+  for (auto _ : state)
+  {
+    benchmark::DoNotOptimize(
+        FindHistogramBucket(boundaries.data(), boundaries.size(), values[i++ & 1023]));
+  }
+}
+BENCHMARK(BM_FindBucketBranchless)->Arg(16)->Arg(64);
+
+// A histogram guarded by a mutex, for comparison.
+void BM_MutexHistogramUpdate(benchmark::State &state)
+{
+  static std::mutex mtx;
+  static std::vector<uint64_t> counts(65);
+  auto boundaries = MakeBoundaries(state.range(0));
+  auto values     = MakeValues(boundaries.size());
+  std::size_t i   = 0;
+  for (auto _ : state)
+  {
+    double value = values[i++ & 1023];
+    auto bucket =
+        std::lower_bound(boundaries.begin(), boundaries.end(), value) - boundaries.begin();
+    std::lock_guard<std::mutex> lock(mtx);
+    ++counts[bucket];
+  }
+}
+BENCHMARK(BM_MutexHistogramUpdate)->Arg(16)->Arg(64)->ThreadRange(1, 64)->UseRealTime();
+
+void BM_HistogramAggregatorUpdate(benchmark::State &state)
+{
+  static HistogramAggregator<double> aggregator16(
+      std::make_shared<const std::vector<double>>(MakeBoundaries(16)));
+  static HistogramAggregator<double> aggregator64(
+      std::make_shared<const std::vector<double>>(MakeBoundaries(64)));
+  auto &aggregator = state.range(0) == 16 ? aggregator16 : aggregator64;
+  auto values      = MakeValues(state.range(0));
+  std::size_t i    = 0;
+  for (auto _ : state)
+  {
+    aggregator.Update(values[i++ & 1023]);
+  }
+}
+BENCHMARK(BM_HistogramAggregatorUpdate)->Arg(16)->Arg(64)->ThreadRange(1, 64)->UseRealTime();
+
+void BM_BoundValueRecorderRecord(benchmark::State &state)
+{
+  static Meter meter;
+  static auto bound16 =
+      meter.NewDoubleValueRecorder("latency16", "", "ms", MakeBoundaries(16))->Bind({{"a", "b"}});
+  static auto bound64 =
+      meter.NewDoubleValueRecorder("latency64", "", "ms", MakeBoundaries(64))->Bind({{"a", "b"}});
+  auto &bound   = state.range(0) == 16 ? bound16 : bound64;
+  auto values   = MakeValues(state.range(0));
+  std::size_t i = 0;
+  for (auto _ : state)
+  {
+    bound->Record(values[i++ & 1023]);
+  }
+}
+BENCHMARK(BM_BoundValueRecorderRecord)->Arg(16)->Arg(64)->ThreadRange(1, 64)->UseRealTime();
+
+}  // namespace
+BENCHMARK_MAIN();
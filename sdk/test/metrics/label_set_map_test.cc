@@ -0,0 +1,415 @@
+#include "opentelemetry/sdk/metrics/label_set_map.h"
+
+#include <atomic>
+#include <condition_variable>
+#include <limits>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "opentelemetry/sdk/metrics/aggregator/sum_aggregator.h"
+#include "opentelemetry/trace/key_value_iterable_view.h"
+
+using namespace opentelemetry::sdk::metrics;
+namespace common = opentelemetry::common;
+namespace core   = opentelemetry::core;
+namespace nostd  = opentelemetry::nostd;
+using Labels = std::map<std::string, std::string>;
+using Sums   = LabelSetMap<SumAggregator<int64_t>>;
+
+Sums::Entry *Acquire(Sums &sums, const Labels &labels)
+{
+  return sums.Acquire(opentelemetry::trace::KeyValueIterableView<Labels>(labels));
+}
+
+void Update(Sums &sums, const opentelemetry::trace::KeyValueIterable &labels, int64_t value)
+{
+  sums.Update(labels, [value](SumAggregator<int64_t> &sum) { sum.Update(value); });
+}
+
+void Update(Sums &sums, const Labels &labels, int64_t value)
+{
+  Update(sums, opentelemetry::trace::KeyValueIterableView<Labels>(labels), value);
+}
+
+std::map<std::vector<LabelSet::Label>, int64_t> Collect(Sums &sums,
+                                                        std::size_t max_idle_collections = 1)
+{
+  std::map<std::vector<LabelSet::Label>, int64_t> collected;
+  sums.Collect(max_idle_collections, [&](const LabelSet &labels, SumAggregator<int64_t> &sum,
+                                          core::SystemTimestamp) {
+    return sum.Checkpoint(AggregationTemporality::Cumulative, collected[labels.GetLabels()]);
+  });
+  return collected;
+}
+
+/**
+ * The labels {{"a", "blocked"}}, whose iteration blocks when they are compared to an entry, i.e.
+ * while the index is being probed for them, until they are unblocked.
+ */
+class BlockingLabels final : public opentelemetry::trace::KeyValueIterable
+{
+public:
+  bool ForEachKeyValue(nostd::function_ref<bool(nostd::string_view, common::AttributeValue)>
+                           callback) const noexcept override
+  {
+    std::unique_lock<std::mutex> lock(mtx_);
+    // The first iteration hashes the labels, the second compares them.
+    if (++iteration_count_ == 2)
+    {
+      is_blocked_ = true;
+      cv_.notify_all();
+      cv_.wait(lock, [this] { return !is_blocked_; });
+    }
+    lock.unlock();
+    return callback("a", nostd::string_view("blocked"));
+  }
+
+  std::size_t size() const noexcept override { return 1; }
+
+  void WaitUntilBlocked()
+  {
+    std::unique_lock<std::mutex> lock(mtx_);
+    cv_.wait(lock, [this] { return is_blocked_; });
+  }
+
+  void Unblock()
+  {
+    std::lock_guard<std::mutex> lock(mtx_);
+    is_blocked_ = false;
+    cv_.notify_all();
+  }
+
+private:
+  mutable std::mutex mtx_;
+  mutable std::condition_variable cv_;
+  mutable int iteration_count_ = 0;
+  mutable bool is_blocked_     = false;
+};
+
+TEST(LabelSetMap, InternsEqualLabelSets)
+{
+  Sums sums;
+  auto entry = Acquire(sums, {{"a", "1"}, {"b", "2"}});
+  std::vector<std::pair<std::string, std::string>> reordered = {{"b", "2"}, {"a", "1"}};
+  auto same_entry = sums.Acquire(
+      opentelemetry::trace::KeyValueIterableView<decltype(reordered)>(reordered));
+  auto other_entry = Acquire(sums, {{"a", "2"}});
+
+  EXPECT_EQ(entry, same_entry);
+  EXPECT_NE(entry, other_entry);
+  EXPECT_EQ(entry->GetRefCount(), 2);
+  EXPECT_EQ(sums.size(), 2);
+}
+
+TEST(LabelSetMap, ReclaimsUnreferencedIdleEntries)
+{
+  Sums sums;
+  auto unused = Acquire(sums, {{"a", "unused"}});
+  auto used   = Acquire(sums, {{"a", "used"}});
+  auto bound  = Acquire(sums, {{"a", "bound"}});
+  used->aggregator.Update(1);
+  Sums::Release(unused);
+  Sums::Release(used);
+
+  // Every label set is collected once, but only the one without references or data goes away.
+  EXPECT_EQ(Collect(sums).size(), 3);
+  EXPECT_EQ(sums.size(), 2);
+
+  // The used label set has no new data in the second collection, so it goes away as well.
+  EXPECT_EQ(Collect(sums).size(), 2);
+  EXPECT_EQ(sums.size(), 1);
+
+  Sums::Release(bound);
+  EXPECT_EQ(Collect(sums).size(), 1);
+  EXPECT_EQ(sums.size(), 0);
+}
+
+TEST(LabelSetMap, KeepsIdleEntriesForMaxIdleCollections)
+{
+  Sums sums;
+  auto entry = Acquire(sums, {{"a", "1"}});
+  entry->aggregator.Update(1);
+  Sums::Release(entry);
+
+  EXPECT_EQ(Collect(sums, 3).size(), 1);
+  EXPECT_EQ(Collect(sums, 3).size(), 1);
+
+  // An update resets the idle count.
+  entry = Acquire(sums, {{"a", "1"}});
+  entry->aggregator.Update(1);
+  Sums::Release(entry);
+  EXPECT_EQ(Collect(sums, 3).size(), 1);
+  EXPECT_EQ(Collect(sums, 3).size(), 1);
+  EXPECT_EQ(Collect(sums, 3).size(), 1);
+  EXPECT_EQ(sums.size(), 1);
+  EXPECT_EQ((Collect(sums, 3)[{{"a", "1"}}]), 2);
+  EXPECT_EQ(sums.size(), 0);
+}
+
+TEST(LabelSetMap, UpdatesWithoutTakingReferences)
+{
+  Sums sums;
+  Update(sums, {{"a", "1"}}, 1);
+  Update(sums, {{"a", "1"}}, 2);
+  EXPECT_EQ(sums.size(), 1);
+
+  auto entry = Acquire(sums, {{"a", "1"}});
+  EXPECT_EQ(entry->GetRefCount(), 1);
+  Sums::Release(entry);
+  EXPECT_EQ((Collect(sums)[{{"a", "1"}}]), 3);
+
+  // An update marks the entry as used, even if it leaves the sum as it was.
+  Update(sums, {{"a", "1"}}, 0);
+  Collect(sums);
+  EXPECT_EQ(sums.size(), 1);
+  Collect(sums);
+  EXPECT_EQ(sums.size(), 0);
+}
+
+TEST(LabelSetMap, CollectsUpdatesRacingWithReclaiming)
+{
+  Sums sums;
+  Update(sums, {{"a", "blocked"}}, 1);
+  EXPECT_EQ((Collect(sums)[{{"a", "blocked"}}]), 1);
+
+  // The entry is idle, so it is reclaimed while an update that found it is still in progress.
+  BlockingLabels probe;
+  std::thread thread([&sums, &probe] { Update(sums, probe, 2); });
+  probe.WaitUntilBlocked();
+  Collect(sums);
+  EXPECT_EQ(sums.size(), 0);
+  probe.Unblock();
+  thread.join();
+
+  // The update is collected when the entry is freed.
+  EXPECT_EQ((Collect(sums)[{{"a", "blocked"}}]), 3);
+  EXPECT_EQ(sums.size(), 0);
+}
+
+TEST(LabelSetMap, ConcurrentUpdate)
+{
+  Sums sums;
+  const int kThreads = 8;
+  const int kUpdates = 1000;
+  std::atomic<int64_t> total{0};
+  auto collect = [&sums, &total] {
+    sums.Collect(1, [&total](const LabelSet &, SumAggregator<int64_t> &sum,
+                             core::SystemTimestamp) {
+      int64_t delta;
+      bool has_data = sum.Checkpoint(AggregationTemporality::Delta, delta);
+      total += delta;
+      return has_data;
+    });
+  };
+  std::vector<std::thread> threads;
+  for (int i = 0; i < kThreads; ++i)
+  {
+    threads.emplace_back([&sums, &collect] {
+      for (int j = 0; j < kUpdates; ++j)
+      {
+        Update(sums, {{"key", std::to_string(j % 10)}}, 1);
+        if (j % 100 == 0)
+        {
+          collect();
+        }
+      }
+    });
+  }
+  for (auto &thread : threads)
+  {
+    thread.join();
+  }
+
+  // Label sets are reclaimed after every idle collection, and updates that raced with reclaiming
+  // are collected once their entry is freed, so no update is lost.
+  for (int i = 0; i < 4; ++i)
+  {
+    collect();
+  }
+  EXPECT_EQ(total.load(), kThreads * kUpdates);
+}
+
+TEST(LabelSetMap, ConcurrentAcquire)
+{
+  Sums sums;
+  const int kThreads = 8;
+  const int kUpdates = 1000;
+  std::vector<std::thread> threads;
+  for (int i = 0; i < kThreads; ++i)
+  {
+    threads.emplace_back([&sums, i] {
+      for (int j = 0; j < kUpdates; ++j)
+      {
+        auto entry = Acquire(sums, {{"key", std::to_string(j % 10)}});
+        entry->aggregator.Update(1);
+        Sums::Release(entry);
+        if (j % 100 == 0)
+        {
+          // Label sets are never reclaimed, so the cumulative sums are complete.
+          Collect(sums, std::numeric_limits<std::size_t>::max());
+        }
+      }
+    });
+  }
+  for (auto &thread : threads)
+  {
+    thread.join();
+  }
+
+  auto collected = Collect(sums, std::numeric_limits<std::size_t>::max());
+  ASSERT_EQ(collected.size(), 10);
+  for (auto &labels_sum : collected)
+  {
+    EXPECT_EQ(labels_sum.second, kThreads * kUpdates / 10);
+  }
+}
+
+TEST(LabelSetMap, FoldsNewLabelSetsBeyondCardinalityLimit)
+{
+  Sums sums(2);
+  auto first  = Acquire(sums, {{"a", "1"}});
+  auto second = Acquire(sums, {{"a", "2"}});
+  EXPECT_EQ(sums.GetFoldedCount(), 0);
+
+  auto third  = Acquire(sums, {{"a", "3"}});
+  auto fourth = Acquire(sums, {{"a", "4"}});
+  EXPECT_EQ(third, fourth);
+  EXPECT_NE(third, first);
+  EXPECT_NE(third, second);
+  EXPECT_EQ(sums.size(), 2);
+  EXPECT_EQ(sums.GetFoldedCount(), 2);
+
+  // Existing label sets are still found.
+  EXPECT_EQ(Acquire(sums, {{"a", "1"}}), first);
+  EXPECT_EQ(sums.GetFoldedCount(), 2);
+
+  third->aggregator.Update(3);
+  fourth->aggregator.Update(4);
+  for (auto entry : {first, first, second, third, fourth})
+  {
+    Sums::Release(entry);
+  }
+  auto collected = Collect(sums, std::numeric_limits<std::size_t>::max());
+  ASSERT_EQ(collected.size(), 3);
+  EXPECT_EQ((collected[{{kOverflowLabelKey, "true"}}]), 7);
+}
+
+TEST(LabelSetMap, FoldsRepeatedKeysBeyondCardinalityLimit)
+{
+  using LabelList = std::vector<std::pair<std::string, std::string>>;
+  auto acquire    = [](Sums &sums, const LabelList &labels) {
+    return sums.Acquire(opentelemetry::trace::KeyValueIterableView<LabelList>(labels));
+  };
+  Sums sums(1);
+  auto first = acquire(sums, {{"a", "1"}, {"a", "2"}});
+  EXPECT_EQ(first->labels.GetLabels(), (std::vector<LabelSet::Label>{{"a", "2"}}));
+
+  auto folded = acquire(sums, {{"b", "1"}, {"b", "2"}});
+  EXPECT_EQ(folded->labels.GetLabels(),
+            (std::vector<LabelSet::Label>{{kOverflowLabelKey, "true"}}));
+  EXPECT_EQ(sums.GetFoldedCount(), 1);
+
+  // Existing label sets are still found, whichever form they are passed in.
+  EXPECT_EQ(acquire(sums, {{"a", "0"}, {"a", "2"}}), first);
+  EXPECT_EQ(Acquire(sums, {{"a", "2"}}), first);
+  EXPECT_EQ(sums.GetFoldedCount(), 1);
+  EXPECT_EQ(sums.size(), 1);
+  for (auto entry : {first, folded, first, first})
+  {
+    Sums::Release(entry);
+  }
+}
+
+TEST(LabelSetMap, ReclaimingMakesRoomBelowCardinalityLimit)
+{
+  Sums sums(1);
+  Sums::Release(Acquire(sums, {{"a", "1"}}));
+  Collect(sums);
+  EXPECT_EQ(sums.size(), 0);
+
+  auto entry = Acquire(sums, {{"a", "2"}});
+  EXPECT_EQ(entry->labels.GetLabels(), (std::vector<LabelSet::Label>{{"a", "2"}}));
+  EXPECT_EQ(sums.GetFoldedCount(), 0);
+  Sums::Release(entry);
+}
+
+TEST(LabelSetMap, ManyLabelSets)
+{
+  const int kLabelSets = 10000;
+  Sums sums(kLabelSets);
+  for (int round = 0; round < 2; ++round)
+  {
+    for (int i = 0; i < kLabelSets; ++i)
+    {
+      auto entry = Acquire(sums, {{"key", std::to_string(i)}});
+      entry->aggregator.Update(i);
+      Sums::Release(entry);
+    }
+  }
+  EXPECT_EQ(sums.size(), kLabelSets);
+  EXPECT_EQ(sums.GetFoldedCount(), 0);
+
+  auto collected = Collect(sums);
+  ASSERT_EQ(collected.size(), kLabelSets);
+  EXPECT_EQ((collected[{{"key", "1234"}}]), 2 * 1234);
+
+  // Every label set is reclaimed after an idle collection, and can be added again.
+  Collect(sums);
+  EXPECT_EQ(sums.size(), 0);
+  for (int i = 0; i < kLabelSets; ++i)
+  {
+    Sums::Release(Acquire(sums, {{"key", std::to_string(i)}}));
+  }
+  EXPECT_EQ(sums.size(), kLabelSets);
+}
+
+TEST(LabelSetMap, FreesReclaimedEntriesWhileOtherThreadsProbe)
+{
+  // Every aggregator holds a copy of the token, so its use count tells how many are alive.
+  struct TokenAggregator
+  {
+    std::shared_ptr<int> token;
+  };
+  using Tokens = LabelSetMap<TokenAggregator>;
+  auto token   = std::make_shared<int>(0);
+  Tokens tokens([token] { return TokenAggregator{token}; });
+  auto collect = [&tokens] {
+    tokens.Collect(1, [](const LabelSet &, TokenAggregator &, core::SystemTimestamp) {
+      return false;
+    });
+  };
+
+  Labels blocked_labels = {{"a", "blocked"}};
+  auto blocked = tokens.Acquire(opentelemetry::trace::KeyValueIterableView<Labels>(blocked_labels));
+  Labels reclaimed_labels = {{"a", "reclaimed"}};
+  Tokens::Release(
+      tokens.Acquire(opentelemetry::trace::KeyValueIterableView<Labels>(reclaimed_labels)));
+  auto live_count = token.use_count();
+
+  // Every collection runs while a probe is in progress, that started during the previous one.
+  BlockingLabels probes[3];
+  std::thread threads[3];
+  for (int i = 0; i < 3; ++i)
+  {
+    threads[i] = std::thread([&tokens, &probes, i] { Tokens::Release(tokens.Acquire(probes[i])); });
+    probes[i].WaitUntilBlocked();
+    if (i > 0)
+    {
+      probes[i - 1].Unblock();
+      threads[i - 1].join();
+    }
+    collect();
+    EXPECT_EQ(tokens.size(), 1);
+    // The reclaimed entry is freed once the probes that started before it was reclaimed are done.
+    EXPECT_EQ(token.use_count(), i < 2 ? live_count : live_count - 1);
+  }
+  probes[2].Unblock();
+  threads[2].join();
+  Tokens::Release(blocked);
+}
@@ -0,0 +1,106 @@
+#include "opentelemetry/sdk/metrics/label_set.h"
+
+#include <map>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "opentelemetry/nostd/span.h"
+#include "opentelemetry/trace/key_value_iterable_view.h"
+
+using opentelemetry::sdk::metrics::LabelSet;
+namespace common = opentelemetry::common;
+namespace nostd  = opentelemetry::nostd;
+namespace trace  = opentelemetry::trace;
+
+using LabelList = std::vector<std::pair<nostd::string_view, common::AttributeValue>>;
+
+LabelSet MakeLabelSet(const LabelList &labels)
+{
+  return LabelSet(trace::KeyValueIterableView<LabelList>(labels));
+}
+
+TEST(LabelSet, Empty)
+{
+  auto label_set = MakeLabelSet({});
+  EXPECT_TRUE(label_set.GetLabels().empty());
+  EXPECT_EQ(label_set, LabelSet());
+}
+
+TEST(LabelSet, SortedByKey)
+{
+  auto label_set = MakeLabelSet({{"b", "2"}, {"c", "3"}, {"a", "1"}});
+  std::vector<LabelSet::Label> expected = {{"a", "1"}, {"b", "2"}, {"c", "3"}};
+  EXPECT_EQ(label_set.GetLabels(), expected);
+  EXPECT_EQ(label_set, MakeLabelSet({{"c", "3"}, {"a", "1"}, {"b", "2"}}));
+  EXPECT_EQ(label_set.GetHash(), MakeLabelSet({{"c", "3"}, {"a", "1"}, {"b", "2"}}).GetHash());
+}
+
+TEST(LabelSet, LastValueOfRepeatedKeyWins)
+{
+  auto label_set = MakeLabelSet({{"b", "1"}, {"a", "1"}, {"b", "2"}, {"a", "3"}, {"b", "4"}});
+  std::vector<LabelSet::Label> expected = {{"a", "3"}, {"b", "4"}};
+  EXPECT_EQ(label_set.GetLabels(), expected);
+}
+
+TEST(LabelSet, FormatsValues)
+{
+  int values[] = {1, 2, 3};
+  auto label_set = MakeLabelSet({{"bool", true},
+                                 {"int", 42},
+                                 {"negative", int64_t{-7}},
+                                 {"double", 0.1},
+                                 {"array", nostd::span<const int>(values)}});
+  std::vector<LabelSet::Label> expected = {{"array", "1,2,3"},
+                                           {"bool", "true"},
+                                           {"double", "0.10000000000000001"},
+                                           {"int", "42"},
+                                           {"negative", "-7"}};
+  EXPECT_EQ(label_set.GetLabels(), expected);
+}
+
+TEST(LabelSet, DifferentValuesAreNotEqual)
+{
+  EXPECT_NE(MakeLabelSet({{"a", "1"}}), MakeLabelSet({{"a", "2"}}));
+  EXPECT_NE(MakeLabelSet({{"a", "1"}}), MakeLabelSet({{"b", "1"}}));
+  EXPECT_NE(MakeLabelSet({{"a", "1"}}), MakeLabelSet({}));
+}
+
+TEST(LabelSet, HashAndEqualsWithoutLabelSet)
+{
+  int values[]     = {1, 2, 3};
+  LabelList labels = {{"b", 2.5}, {"a", "1"}, {"c", nostd::span<const int>(values)}};
+  auto label_set   = MakeLabelSet(labels);
+  auto labels_view = trace::KeyValueIterableView<LabelList>(labels);
+  std::size_t hash = 0;
+  ASSERT_TRUE(LabelSet::GetHash(labels_view, hash));
+  EXPECT_EQ(hash, label_set.GetHash());
+  EXPECT_TRUE(label_set.Equals(labels_view));
+
+  LabelList reordered = {{"c", nostd::span<const int>(values)}, {"a", "1"}, {"b", 2.5}};
+  EXPECT_TRUE(label_set.Equals(trace::KeyValueIterableView<LabelList>(reordered)));
+
+  LabelList other_value = {{"b", 2.5}, {"a", "1"}, {"c", "1,2,4"}};
+  EXPECT_FALSE(label_set.Equals(trace::KeyValueIterableView<LabelList>(other_value)));
+  LabelList fewer = {{"b", 2.5}, {"a", "1"}};
+  EXPECT_FALSE(label_set.Equals(trace::KeyValueIterableView<LabelList>(fewer)));
+}
+
+TEST(LabelSet, NoHashForRepeatedKeys)
+{
+  LabelList labels = {{"a", "1"}, {"a", "2"}};
+  std::size_t hash;
+  EXPECT_FALSE(LabelSet::GetHash(trace::KeyValueIterableView<LabelList>(labels), hash));
+}
+
+TEST(LabelSet, CanonicalizeReusesBuffer)
+{
+  std::vector<LabelSet::Label> sorted_labels = {{"unused", "labels"}};
+  LabelList labels = {{"b", "1"}, {"a", 2}, {"b", "3"}};
+  auto hash = LabelSet::Canonicalize(trace::KeyValueIterableView<LabelList>(labels), sorted_labels);
+  std::vector<LabelSet::Label> expected = {{"a", "2"}, {"b", "3"}};
+  EXPECT_EQ(sorted_labels, expected);
+  EXPECT_EQ(hash, MakeLabelSet(labels).GetHash());
+  EXPECT_EQ(LabelSet(sorted_labels, hash), MakeLabelSet(labels));
+}
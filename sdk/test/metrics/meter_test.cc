@@ -0,0 +1,439 @@
+#include "opentelemetry/sdk/metrics/meter.h"
+
+#include <map>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "opentelemetry/sdk/metrics/meter_provider.h"
+
+using namespace opentelemetry::sdk::metrics;
+namespace metrics_api = opentelemetry::metrics;
+namespace nostd       = opentelemetry::nostd;
+
+TEST(Meter, IntCounter)
+{
+  Meter meter;
+  auto counter = meter.NewIntCounter("requests", "Served requests", "1");
+  EXPECT_EQ(counter->GetName(), "requests");
+  EXPECT_EQ(counter->GetDescription(), "Served requests");
+  EXPECT_EQ(counter->GetUnit(), "1");
+  EXPECT_EQ(counter->GetKind(), metrics_api::InstrumentKind::Counter);
+
+  counter->Add(1);
+  counter->Add(2);
+  counter->Add(5, {{"method", "GET"}});
+  counter->Add(-3);
+
+  auto records = meter.Collect();
+  ASSERT_EQ(records.size(), 2);
+  std::map<std::vector<LabelSet::Label>, int64_t> sums;
+  for (auto &record : records)
+  {
+    EXPECT_EQ(record.descriptor->name, "requests");
+    EXPECT_EQ(record.descriptor->kind, metrics_api::InstrumentKind::Counter);
+    sums[record.labels.GetLabels()] = nostd::get<int64_t>(record.value);
+  }
+  EXPECT_EQ(sums[{}], 3);
+  EXPECT_EQ((sums[{{"method", "GET"}}]), 5);
+}
+
+TEST(Meter, DoubleUpDownCounter)
+{
+  Meter meter;
+  auto counter = meter.NewDoubleUpDownCounter("queue_size");
+  EXPECT_EQ(counter->GetKind(), metrics_api::InstrumentKind::UpDownCounter);
+
+  std::map<std::string, std::string> labels = {{"queue", "a"}};
+  counter->Add(1.5, labels);
+  counter->Add(-4.0, labels);
+
+  auto records = meter.Collect();
+  ASSERT_EQ(records.size(), 1);
+  EXPECT_EQ(records[0].descriptor->kind, metrics_api::InstrumentKind::UpDownCounter);
+  EXPECT_DOUBLE_EQ(nostd::get<double>(records[0].value), -2.5);
+}
+
+TEST(Meter, SameNameSharesData)
+{
+  Meter meter;
+  meter.NewIntCounter("requests")->Add(1);
+  meter.NewIntCounter("requests")->Add(2);
+
+  // An instrument of another kind or value type cannot take the name.
+  meter.NewDoubleCounter("requests")->Add(4.0);
+  meter.NewIntUpDownCounter("requests")->Add(8);
+
+  auto records = meter.Collect();
+  ASSERT_EQ(records.size(), 1);
+  EXPECT_EQ(nostd::get<int64_t>(records[0].value), 3);
+}
+
+TEST(Meter, CollectOrderedByName)
+{
+  Meter meter;
+  meter.NewIntCounter("b")->Add(1);
+  meter.NewIntCounter("c")->Add(1);
+  meter.NewIntCounter("a")->Add(1);
+
+  auto records = meter.Collect();
+  ASSERT_EQ(records.size(), 3);
+  EXPECT_EQ(records[0].descriptor->name, "a");
+  EXPECT_EQ(records[1].descriptor->name, "b");
+  EXPECT_EQ(records[2].descriptor->name, "c");
+}
+
+TEST(Meter, ConcurrentAdds)
+{
+  Meter meter;
+  auto int_counter    = meter.NewIntCounter("int");
+  auto double_counter = meter.NewDoubleCounter("double");
+  const int kThreads  = 8;
+  const int kAdds     = 10000;
+
+  std::vector<std::thread> threads;
+  for (int i = 0; i < kThreads; ++i)
+  {
+    threads.emplace_back([&] {
+      for (int j = 0; j < kAdds; ++j)
+      {
+        int_counter->Add(1);
+        double_counter->Add(0.5, {{"thread", "any"}});
+      }
+    });
+  }
+  for (auto &thread : threads)
+  {
+    thread.join();
+  }
+
+  auto records = meter.Collect();
+  ASSERT_EQ(records.size(), 2);
+  EXPECT_DOUBLE_EQ(nostd::get<double>(records[0].value), kThreads * kAdds * 0.5);
+  EXPECT_EQ(nostd::get<int64_t>(records[1].value), kThreads * kAdds);
+}
+
+TEST(Meter, BoundCounter)
+{
+  Meter meter;
+  auto counter = meter.NewIntCounter("requests");
+  auto bound   = counter->Bind({{"method", "GET"}});
+  bound->Add(2);
+  bound->Add(-1);
+  counter->Add(3, {{"method", "GET"}});
+
+  auto records = meter.Collect();
+  ASSERT_EQ(records.size(), 1);
+  EXPECT_EQ(records[0].labels.GetLabels(), (std::vector<LabelSet::Label>{{"method", "GET"}}));
+  EXPECT_EQ(nostd::get<int64_t>(records[0].value), 5);
+
+  // Values added after unbinding are ignored, but the sum is still reported.
+  bound->Unbind();
+  bound->Add(10);
+  records = meter.Collect();
+  ASSERT_EQ(records.size(), 1);
+  EXPECT_EQ(nostd::get<int64_t>(records[0].value), 5);
+}
+
+TEST(Meter, BoundUpDownCounterReclaimed)
+{
+  Meter meter;
+  auto counter = meter.NewDoubleUpDownCounter("queue_size");
+  {
+    auto bound = counter->Bind({{"queue", "a"}});
+    bound->Add(2.0);
+    bound->Add(-2.0);
+    auto records = meter.Collect(AggregationTemporality::Cumulative, 1);
+    ASSERT_EQ(records.size(), 1);
+    EXPECT_DOUBLE_EQ(nostd::get<double>(records[0].value), 0.0);
+  }
+
+  // Once unbound, an idle label set is reported a last time and then reclaimed.
+  EXPECT_EQ(meter.Collect(AggregationTemporality::Cumulative, 1).size(), 1);
+  EXPECT_EQ(meter.Collect(AggregationTemporality::Cumulative, 1).size(), 0);
+}
+
+TEST(Meter, UpDownCounterKeepsIdleCumulativeSum)
+{
+  Meter meter;
+  auto counter = meter.NewIntUpDownCounter("queue_size");
+  counter->Add(5);
+
+  // The sum is not zero, so the label set is never reclaimed, however long it is idle.
+  for (int i = 0; i < 5; ++i)
+  {
+    auto records = meter.Collect(AggregationTemporality::Cumulative, 2);
+    ASSERT_EQ(records.size(), 1);
+    EXPECT_EQ(nostd::get<int64_t>(records[0].value), 5);
+  }
+  counter->Add(-1);
+  auto records = meter.Collect(AggregationTemporality::Cumulative, 2);
+  ASSERT_EQ(records.size(), 1);
+  EXPECT_EQ(nostd::get<int64_t>(records[0].value), 4);
+
+  // Updates that cancel out still count as updates.
+  counter->Add(-4);
+  counter->Add(4);
+  records = meter.Collect(AggregationTemporality::Delta, 2);
+  ASSERT_EQ(records.size(), 1);
+  EXPECT_EQ(nostd::get<int64_t>(records[0].value), 0);
+
+  // Once the sum is back to zero, the idle label set is reclaimed.
+  counter->Add(-4);
+  EXPECT_EQ(meter.Collect(AggregationTemporality::Cumulative, 2).size(), 1);
+  EXPECT_EQ(meter.Collect(AggregationTemporality::Cumulative, 2).size(), 1);
+  EXPECT_EQ(meter.Collect(AggregationTemporality::Cumulative, 2).size(), 1);
+  EXPECT_EQ(meter.Collect(AggregationTemporality::Cumulative, 2).size(), 0);
+}
+
+TEST(Meter, DeltaTemporality)
+{
+  Meter meter;
+  auto counter  = meter.NewIntCounter("requests");
+  auto recorder = meter.NewDoubleValueRecorder("latency");
+  counter->Add(2, {{"method", "GET"}});
+  counter->Add(3, {{"method", "PUT"}});
+  recorder->Record(7);
+
+  auto records = meter.Collect(AggregationTemporality::Delta);
+  ASSERT_EQ(records.size(), 3);
+  EXPECT_EQ(nostd::get<HistogramValue>(records[0].value).count, 1);
+
+  // Only the label sets updated since the previous collection are reported, with the values
+  // recorded since then.
+  counter->Add(4, {{"method", "GET"}});
+  records = meter.Collect(AggregationTemporality::Delta);
+  ASSERT_EQ(records.size(), 1);
+  EXPECT_EQ(records[0].labels.GetLabels(), (std::vector<LabelSet::Label>{{"method", "GET"}}));
+  EXPECT_EQ(nostd::get<int64_t>(records[0].value), 4);
+  EXPECT_TRUE(meter.Collect(AggregationTemporality::Delta).empty());
+}
+
+TEST(Meter, IdleLabelSetsReclaimed)
+{
+  Meter meter;
+  auto counter = meter.NewIntCounter("requests");
+  for (int i = 0; i < 100; ++i)
+  {
+    counter->Add(1, {{"request_id", std::to_string(i)}});
+  }
+  counter->Add(1, {{"request_id", "live"}});
+
+  // Cumulative values are reported until a label set has been idle for max_idle_collections,
+  // and the label set is reclaimed after that last report.
+  for (int i = 0; i < 4; ++i)
+  {
+    EXPECT_EQ(meter.Collect(AggregationTemporality::Cumulative, 3).size(), 101);
+    counter->Add(1, {{"request_id", "live"}});
+  }
+  auto records = meter.Collect(AggregationTemporality::Cumulative, 3);
+  ASSERT_EQ(records.size(), 1);
+  EXPECT_EQ(nostd::get<int64_t>(records[0].value), 5);
+}
+
+TEST(Meter, CardinalityLimit)
+{
+  Meter meter(Meter::GetDefaultBoundaries(), 10);
+  auto counter  = meter.NewIntCounter("requests");
+  auto recorder = meter.NewDoubleValueRecorder("latency");
+  for (int i = 0; i < 100; ++i)
+  {
+    counter->Add(1, {{"request_id", std::to_string(i)}});
+    recorder->Record(1.0, {{"request_id", std::to_string(i)}});
+  }
+  EXPECT_EQ(meter.GetFoldedCount(), 180);
+
+  std::map<std::vector<LabelSet::Label>, int64_t> sums;
+  for (auto &record : meter.Collect())
+  {
+    if (record.descriptor->name == "requests")
+    {
+      sums[record.labels.GetLabels()] = nostd::get<int64_t>(record.value);
+    }
+  }
+  ASSERT_EQ(sums.size(), 11);
+  EXPECT_EQ((sums[{{"request_id", "0"}}]), 1);
+  EXPECT_EQ((sums[{{kOverflowLabelKey, "true"}}]), 90);
+}
+
+struct Pool
+{
+  std::map<std::string, int64_t> sizes;
+  int64_t allocated = 0;
+  int callback_count = 0;
+};
+
+void ObservePoolSizes(metrics_api::ObserverResult<int64_t> &result, void *state)
+{
+  auto pool = static_cast<Pool *>(state);
+  ++pool->callback_count;
+  for (auto &name_size : pool->sizes)
+  {
+    result.Observe(name_size.second, {{"pool", name_size.first}});
+  }
+}
+
+void ObserveAllocated(metrics_api::ObserverResult<int64_t> &result, void *state)
+{
+  result.Observe(static_cast<Pool *>(state)->allocated);
+}
+
+TEST(Meter, ValueObserver)
+{
+  Meter meter;
+  Pool pool;
+  pool.sizes = {{"a", 3}, {"b", 5}};
+  auto observer = meter.NewIntValueObserver("pool_size", "", "1", ObservePoolSizes, &pool);
+  EXPECT_EQ(observer->GetKind(), metrics_api::InstrumentKind::ValueObserver);
+  EXPECT_EQ(pool.callback_count, 0);
+
+  auto records = meter.Collect(AggregationTemporality::Delta);
+  EXPECT_EQ(pool.callback_count, 1);
+  ASSERT_EQ(records.size(), 2);
+  EXPECT_EQ(records[0].descriptor->kind, metrics_api::InstrumentKind::ValueObserver);
+  std::map<std::vector<LabelSet::Label>, int64_t> sizes;
+  for (auto &record : records)
+  {
+    sizes[record.labels.GetLabels()] = nostd::get<int64_t>(record.value);
+  }
+  EXPECT_EQ((sizes[{{"pool", "a"}}]), 3);
+  EXPECT_EQ((sizes[{{"pool", "b"}}]), 5);
+
+  // Gauges are reported as observed, and label sets that are not observed are not reported.
+  pool.sizes = {{"a", 4}};
+  records    = meter.Collect(AggregationTemporality::Delta);
+  ASSERT_EQ(records.size(), 1);
+  EXPECT_EQ(records[0].labels.GetLabels(), (std::vector<LabelSet::Label>{{"pool", "a"}}));
+  EXPECT_EQ(nostd::get<int64_t>(records[0].value), 4);
+}
+
+TEST(Meter, SumObserver)
+{
+  Meter meter;
+  Pool pool;
+  auto observer = meter.NewIntSumObserver("allocated", "", "By", ObserveAllocated, &pool);
+  EXPECT_EQ(observer->GetKind(), metrics_api::InstrumentKind::SumObserver);
+
+  pool.allocated = 10;
+  auto records   = meter.Collect(AggregationTemporality::Delta);
+  ASSERT_EQ(records.size(), 1);
+  EXPECT_EQ(nostd::get<int64_t>(records[0].value), 10);
+
+  // With delta temporality, the difference to the previous observation is reported.
+  pool.allocated = 25;
+  records        = meter.Collect(AggregationTemporality::Delta);
+  ASSERT_EQ(records.size(), 1);
+  EXPECT_EQ(nostd::get<int64_t>(records[0].value), 15);
+}
+
+TEST(Meter, UpDownSumObserver)
+{
+  Meter meter;
+  meter.NewDoubleUpDownSumObserver(
+      "temperature_delta", "", "",
+      [](metrics_api::ObserverResult<double> &result, void *) {
+        result.Observe(1.5, {{"room", "a"}});
+        // The last observation of a label set wins.
+        result.Observe(-2.5, {{"room", "a"}});
+      });
+
+  for (int i = 0; i < 2; ++i)
+  {
+    auto records = meter.Collect();
+    ASSERT_EQ(records.size(), 1);
+    EXPECT_EQ(records[0].descriptor->kind, metrics_api::InstrumentKind::UpDownSumObserver);
+    EXPECT_DOUBLE_EQ(nostd::get<double>(records[0].value), -2.5);
+  }
+}
+
+TEST(Meter, ObserverKeepsCallbackOfExistingInstrument)
+{
+  Meter meter;
+  Pool pool;
+  pool.allocated = 1;
+  meter.NewIntSumObserver("allocated", "", "By", ObserveAllocated, &pool);
+  meter.NewIntSumObserver("allocated", "", "By", nullptr);
+  EXPECT_EQ(meter.NewIntValueObserver("allocated", "", "By", nullptr)->GetName(), "");
+
+  auto records = meter.Collect();
+  ASSERT_EQ(records.size(), 1);
+  EXPECT_EQ(nostd::get<int64_t>(records[0].value), 1);
+}
+
+TEST(Meter, BoundCounterOutlivesMeter)
+{
+  nostd::shared_ptr<metrics_api::BoundCounter<double>> bound;
+  {
+    Meter meter;
+    bound = meter.NewDoubleCounter("bytes")->Bind({{"direction", "in"}});
+  }
+  bound->Add(1.0);
+  bound->Unbind();
+}
+
+TEST(Meter, ValueRecorder)
+{
+  Meter meter({10, 1});
+  auto recorder = meter.NewDoubleValueRecorder("latency", "Request latency", "ms");
+  EXPECT_EQ(recorder->GetKind(), metrics_api::InstrumentKind::ValueRecorder);
+  recorder->Record(0.5);
+  recorder->Record(20, {{"method", "GET"}});
+  auto bound = recorder->Bind({{"method", "GET"}});
+  bound->Record(5);
+
+  auto custom = meter.NewIntValueRecorder("size", "", "By", {100, 100, 10});
+  custom->Record(50);
+
+  auto records = meter.Collect();
+  ASSERT_EQ(records.size(), 3);
+  std::map<std::vector<LabelSet::Label>, HistogramValue> histograms;
+  for (auto &record : records)
+  {
+    if (record.descriptor->name == "latency")
+    {
+      histograms[record.labels.GetLabels()] = nostd::get<HistogramValue>(record.value);
+    }
+  }
+  EXPECT_EQ(*histograms[{}].boundaries, (std::vector<double>{1, 10}));
+  EXPECT_EQ(histograms[{}].counts, (std::vector<uint64_t>{1, 0, 0}));
+  auto &get_histogram = histograms[{{"method", "GET"}}];
+  EXPECT_EQ(get_histogram.counts, (std::vector<uint64_t>{0, 1, 1}));
+  EXPECT_EQ(get_histogram.count, 2);
+  EXPECT_DOUBLE_EQ(get_histogram.sum, 25);
+
+  auto &custom_histogram = nostd::get<HistogramValue>(records[2].value);
+  EXPECT_EQ(records[2].descriptor->name, "size");
+  EXPECT_EQ(*custom_histogram.boundaries, (std::vector<double>{10, 100}));
+  EXPECT_EQ(custom_histogram.counts, (std::vector<uint64_t>{0, 1, 0}));
+}
+
+TEST(Meter, SketchValueRecorder)
+{
+  Meter meter;
+  auto recorder = meter.NewIntValueRecorder("latency", "", "us", DDSketchOptions());
+  for (int64_t value = 1; value <= 100; ++value)
+  {
+    recorder->Record(value);
+  }
+  // The name is taken by a sketch recorder, so a histogram recorder cannot reuse it.
+  meter.NewIntValueRecorder("latency")->Record(1000);
+
+  auto records = meter.Collect();
+  ASSERT_EQ(records.size(), 1);
+  auto &sketch = nostd::get<DDSketch>(records[0].value);
+  EXPECT_EQ(sketch.GetCount(), 100);
+  EXPECT_NEAR(sketch.GetQuantile(0.99), 99, 0.99);
+}
+
+TEST(MeterProvider, GetMeter)
+{
+  auto meter = std::make_shared<Meter>();
+  MeterProvider provider(meter);
+  EXPECT_EQ(provider.GetMeter("test").get(), meter.get());
+  EXPECT_EQ(provider.GetSdkMeter(), meter);
+
+  MeterProvider default_provider;
+  EXPECT_NE(default_provider.GetSdkMeter(), nullptr);
+}
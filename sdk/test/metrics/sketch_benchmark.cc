@@ -0,0 +1,100 @@
+#include "opentelemetry/sdk/metrics/aggregator/ddsketch.h"
+#include "opentelemetry/sdk/metrics/aggregator/sketch_aggregator.h"
+
+#include <algorithm>
+#include <random>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+namespace
+{
+using opentelemetry::sdk::metrics::DDSketch;
+using opentelemetry::sdk::metrics::DDSketchOptions;
+using opentelemetry::sdk::metrics::SketchAggregator;
+
+std::vector<double> MakeLatencies(std::size_t count)
+{
+  std::mt19937_64 generator{0};
+  std::lognormal_distribution<double> distribution(3, 1.5);
+  std::vector<double> values(count);
+  for (auto &value : values)
+  {
+    value = distribution(generator);
+  }
+  return values;
+}
+
+void BM_DDSketchAdd(benchmark::State &state)
+{
+  auto values = MakeLatencies(1024);
+  DDSketch sketch;
+  std::size_t i = 0;
+  for (auto _ : state)
+  {
+    sketch.Add(values[i++ & 1023]);
+  }
+  benchmark::DoNotOptimize(sketch.GetCount());
+}
+BENCHMARK(BM_DDSketchAdd);
+
+void BM_SketchAggregatorUpdate(benchmark::State &state)
+{
+  static SketchAggregator<double> aggregator{DDSketchOptions()};
+  auto values   = MakeLatencies(1024);
+  std::size_t i = 0;
+  for (auto _ : state)
+  {
+    aggregator.Update(values[i++ & 1023]);
+  }
+}
+BENCHMARK(BM_SketchAggregatorUpdate)->ThreadRange(1, 64)->UseRealTime();
+
+// Computes the median of a collection interval's values exactly, by keeping and sorting them.
+void BM_ExactQuantile(benchmark::State &state)
+{
+  auto values = MakeLatencies(state.range(0));
+  for (auto _ : state)
+  {
+    std::vector<double> copy(values);
+    std::nth_element(copy.begin(), copy.begin() + copy.size() / 2, copy.end());
+    benchmark::DoNotOptimize(copy[copy.size() / 2]);
+  }
+}
+BENCHMARK(BM_ExactQuantile)->Arg(1000)->Arg(100000);
+
+// Computes the median of a collection interval's values from their sketch.
+void BM_SketchQuantile(benchmark::State &state)
+{
+  auto values = MakeLatencies(state.range(0));
+  DDSketch sketch;
+  for (double value : values)
+  {
+    sketch.Add(value);
+  }
+  for (auto _ : state)
+  {
+    benchmark::DoNotOptimize(sketch.GetQuantile(0.5));
+  }
+}
+BENCHMARK(BM_SketchQuantile)->Arg(1000)->Arg(100000);
+
+void BM_DDSketchMerge(benchmark::State &state)
+{
+  auto values = MakeLatencies(10000);
+  DDSketch part;
+  for (double value : values)
+  {
+    part.Add(value);
+  }
+  for (auto _ : state)
+  {
+    DDSketch merged;
+    merged.Merge(part);
+    benchmark::DoNotOptimize(merged.GetCount());
+  }
+}
+BENCHMARK(BM_DDSketchMerge);
+
+}  // namespace
+BENCHMARK_MAIN();
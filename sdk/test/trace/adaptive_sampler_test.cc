@@ -0,0 +1,111 @@
+#include "opentelemetry/sdk/trace/samplers/adaptive.h"
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <chrono>
+#include <map>
+#include <thread>
+#include <vector>
+
+using opentelemetry::sdk::trace::AdaptiveSampler;
+using opentelemetry::sdk::trace::Decision;
+using opentelemetry::trace::SpanContext;
+using opentelemetry::trace::TraceId;
+
+namespace
+{
+/*
+ * Calls ShouldSample for a root span of the trace id whose first 8 bytes are all set to the
+ * given value.
+ */
+Decision ShouldSample(AdaptiveSampler &sampler,
+                      uint8_t value              = 0,
+                      const SpanContext *context = nullptr)
+{
+  using M = std::map<std::string, int>;
+  M m1    = {{}};
+  opentelemetry::trace::KeyValueIterableView<M> view{m1};
+
+  uint8_t buffer[TraceId::kSize] = {value, value, value, value, value, value, value, value};
+  return sampler
+      .ShouldSample(context, TraceId(buffer), "", opentelemetry::trace::SpanKind::kInternal, view)
+      .decision;
+}
+
+/*
+ * Calls ShouldSample for the given number of root spans.
+ */
+void RunRootSpans(AdaptiveSampler &sampler, int count)
+{
+  for (int i = 0; i < count; ++i)
+  {
+    ShouldSample(sampler);
+  }
+}
+}  // namespace
+
+TEST(AdaptiveSampler, AdjustsProbabilityToTraffic)
+{
+  AdaptiveSampler sampler(10000, std::chrono::milliseconds(20));
+  EXPECT_EQ(sampler.GetProbability(), 1);
+  EXPECT_EQ(ShouldSample(sampler, 0xff), Decision::RECORD_AND_SAMPLE);
+
+  // A burst far over the target lowers the probability once the interval is over.
+  RunRootSpans(sampler, 100000);
+  std::this_thread::sleep_for(std::chrono::milliseconds(20));
+  RunRootSpans(sampler, AdaptiveSampler::kClockReadInterval);
+  EXPECT_GT(sampler.GetProbability(), 0);
+  EXPECT_LT(sampler.GetProbability(), 0.5);
+  EXPECT_EQ(ShouldSample(sampler, 0), Decision::RECORD_AND_SAMPLE);
+  EXPECT_EQ(ShouldSample(sampler, 0xff), Decision::NOT_RECORD);
+
+  // Traffic below the target samples every span again.
+  std::this_thread::sleep_for(std::chrono::milliseconds(20));
+  RunRootSpans(sampler, AdaptiveSampler::kClockReadInterval);
+  EXPECT_EQ(sampler.GetProbability(), 1);
+  EXPECT_EQ(ShouldSample(sampler, 0xff), Decision::RECORD_AND_SAMPLE);
+}
+
+TEST(AdaptiveSampler, CountsRootSpansOfEveryThread)
+{
+  AdaptiveSampler sampler(10000, std::chrono::milliseconds(20));
+
+  // Every thread counts its root spans in its own cell, and every cell is counted.
+  std::atomic<bool> is_done{false};
+  std::vector<std::thread> threads;
+  for (int i = 0; i < 4; ++i)
+  {
+    threads.emplace_back([&sampler, &is_done] {
+      while (!is_done.load(std::memory_order_relaxed))
+      {
+        RunRootSpans(sampler, AdaptiveSampler::kClockReadInterval);
+      }
+    });
+  }
+  std::this_thread::sleep_for(std::chrono::milliseconds(100));
+  is_done = true;
+  for (auto &thread : threads)
+  {
+    thread.join();
+  }
+  EXPECT_GT(sampler.GetProbability(), 0);
+  EXPECT_LT(sampler.GetProbability(), 0.5);
+}
+
+TEST(AdaptiveSampler, FollowsLocalParent)
+{
+  AdaptiveSampler sampler(1, std::chrono::milliseconds(0));
+  RunRootSpans(sampler, 100000);
+
+  SpanContext sampled(true, false);
+  SpanContext not_sampled(false, false);
+  EXPECT_EQ(ShouldSample(sampler, 0xff, &sampled), Decision::RECORD_AND_SAMPLE);
+  EXPECT_EQ(ShouldSample(sampler, 0, &not_sampled), Decision::NOT_RECORD);
+}
+
+TEST(AdaptiveSampler, GetDescription)
+{
+  AdaptiveSampler sampler(100);
+  ASSERT_EQ("AdaptiveSampler{100.000000}", sampler.GetDescription());
+}
@@ -0,0 +1,89 @@
+#include "opentelemetry/sdk/trace/attribute_key_table.h"
+
+#include <gtest/gtest.h>
+
+#include <string>
+#include <thread>
+#include <vector>
+
+using opentelemetry::nostd::string_view;
+using opentelemetry::sdk::trace::AttributeKeyTable;
+
+TEST(AttributeKeyTable, InternsEqualKeysOnce)
+{
+  AttributeKeyTable table;
+  std::string key = "http.method";
+
+  auto interned = table.Intern(key);
+  EXPECT_EQ("http.method", interned);
+  EXPECT_NE(key.data(), interned.data());
+  EXPECT_EQ(interned.data(), table.Intern("http.method").data());
+  EXPECT_NE(interned.data(), table.Intern("http.route").data());
+  EXPECT_EQ("", table.Intern(""));
+}
+
+TEST(AttributeKeyTable, InternsKeysBeyondTheTable)
+{
+  AttributeKeyTable table;
+  std::vector<string_view> interned;
+  for (int i = 0; i < 4096; ++i)
+  {
+    interned.push_back(table.Intern("key" + std::to_string(i)));
+  }
+  for (int i = 0; i < 4096; ++i)
+  {
+    auto key = "key" + std::to_string(i);
+    EXPECT_EQ(key, interned[i]);
+    EXPECT_EQ(interned[i].data(), table.Intern(key).data());
+  }
+}
+
+TEST(AttributeKeyTable, LimitsOverflowKeys)
+{
+  AttributeKeyTable table;
+  std::vector<string_view> interned;
+  for (int i = 0;; ++i)
+  {
+    auto key = table.Intern("key" + std::to_string(i));
+    if (key.data() == nullptr)
+    {
+      break;
+    }
+    interned.push_back(key);
+    ASSERT_LE(interned.size(), 1024 + AttributeKeyTable::kMaxOverflowKeys);
+  }
+  EXPECT_GT(interned.size(), AttributeKeyTable::kMaxOverflowKeys);
+  // The keys that were interned still are, and new ones are not.
+  EXPECT_EQ(interned.back().data(), table.Intern(std::string(interned.back())).data());
+  EXPECT_EQ(nullptr, table.Intern("another.key").data());
+}
+
+TEST(AttributeKeyTable, InternsConcurrently)
+{
+  AttributeKeyTable table;
+  const int kThreads = 4;
+  const int kKeys    = 2048;
+  std::vector<std::vector<string_view>> interned(kThreads);
+  std::vector<std::thread> threads;
+  for (int t = 0; t < kThreads; ++t)
+  {
+    threads.emplace_back([&table, &interned, t] {
+      for (int i = 0; i < kKeys; ++i)
+      {
+        interned[t].push_back(table.Intern("key" + std::to_string(i)));
+      }
+    });
+  }
+  for (auto &thread : threads)
+  {
+    thread.join();
+  }
+  for (int i = 0; i < kKeys; ++i)
+  {
+    EXPECT_EQ("key" + std::to_string(i), interned[0][i]);
+    for (int t = 1; t < kThreads; ++t)
+    {
+      EXPECT_EQ(interned[0][i].data(), interned[t][i].data());
+    }
+  }
+}
@@ -2,6 +2,7 @@
 #include "src/common/random.h"
 
 #include <gtest/gtest.h>
+#include <cmath>
 #include <cstdlib>
 #include <ctime>
 
@@ -52,6 +53,28 @@ int RunShouldSampleCountDecision(SpanContext &context,
 
   return actual_count;
 }
+
+/*
+ * Returns whether the sampler samples the root span of a trace whose first 8 bytes hold the
+ * given integer in little-endian order, and whose last 8 bytes are all set.
+ */
+bool IsSampled(ProbabilitySampler &sampler, uint64_t bits)
+{
+  using M = std::map<std::string, int>;
+  M m1    = {{}};
+  opentelemetry::trace::KeyValueIterableView<M> view{m1};
+
+  uint8_t buf[16];
+  for (int i = 0; i < 8; ++i)
+  {
+    buf[i]     = static_cast<uint8_t>(bits >> (8 * i));
+    buf[i + 8] = 0xff;
+  }
+  opentelemetry::trace::TraceId trace_id(buf);
+  return sampler.ShouldSample(nullptr, trace_id, "", opentelemetry::trace::SpanKind::kInternal,
+                              view)
+             .decision == Decision::RECORD_AND_SAMPLE;
+}
 }  // namespace
 
 TEST(ProbabilitySampler, ShouldSampleWithoutContext)
@@ -220,3 +243,52 @@ TEST(ProbabilitySampler, GetDescription)
   ProbabilitySampler s9(0.50);
   ASSERT_EQ("ProbabilitySampler{0.500000}", s9.GetDescription());
 }
+
+TEST(ProbabilitySampler, SamplesUpToExactThreshold)
+{
+  // Every multiple of 1/1024 samples exactly the traces up to probability * 2^64.
+  for (uint64_t k = 1; k < 1024; ++k)
+  {
+    ProbabilitySampler s(k / 1024.0);
+    uint64_t threshold = k << 54;
+    ASSERT_TRUE(IsSampled(s, 0)) << k;
+    ASSERT_TRUE(IsSampled(s, threshold - 1)) << k;
+    ASSERT_TRUE(IsSampled(s, threshold)) << k;
+    ASSERT_FALSE(IsSampled(s, threshold + 1)) << k;
+    ASSERT_FALSE(IsSampled(s, UINT64_MAX)) << k;
+  }
+
+  ProbabilitySampler none(0.0);
+  ASSERT_FALSE(IsSampled(none, 0));
+
+  ProbabilitySampler all(1.0);
+  ASSERT_TRUE(IsSampled(all, UINT64_MAX));
+
+  ProbabilitySampler smallest(std::ldexp(1.0, -64));
+  ASSERT_TRUE(IsSampled(smallest, 1));
+  ASSERT_FALSE(IsSampled(smallest, 2));
+
+  ProbabilitySampler largest(std::nextafter(1.0, 0.0));
+  ASSERT_TRUE(IsSampled(largest, UINT64_MAX - 2047));
+  ASSERT_FALSE(IsSampled(largest, UINT64_MAX - 2046));
+}
+
+TEST(ProbabilitySampler, ReadsTraceIdInLittleEndianOrder)
+{
+  // Only the first byte of the trace id is set for a trace id of 1, on every platform.
+  ProbabilitySampler s(std::ldexp(1.0, -64));
+  uint8_t first[16] = {1};
+  uint8_t second[16] = {0, 1};
+
+  using M = std::map<std::string, int>;
+  M m1    = {{}};
+  opentelemetry::trace::KeyValueIterableView<M> view{m1};
+  auto span_kind = opentelemetry::trace::SpanKind::kInternal;
+
+  ASSERT_EQ(Decision::RECORD_AND_SAMPLE,
+            s.ShouldSample(nullptr, opentelemetry::trace::TraceId(first), "", span_kind, view)
+                .decision);
+  ASSERT_EQ(Decision::NOT_RECORD,
+            s.ShouldSample(nullptr, opentelemetry::trace::TraceId(second), "", span_kind, view)
+                .decision);
+}
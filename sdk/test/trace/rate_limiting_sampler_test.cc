@@ -0,0 +1,98 @@
+#include "opentelemetry/sdk/trace/samplers/rate_limiting.h"
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <chrono>
+#include <map>
+#include <thread>
+#include <vector>
+
+using opentelemetry::sdk::trace::Decision;
+using opentelemetry::sdk::trace::RateLimitingSampler;
+
+namespace
+{
+/*
+ * Calls ShouldSample the given number of times and returns how many spans were sampled.
+ */
+int CountSampled(RateLimitingSampler &sampler, int iterations)
+{
+  using M = std::map<std::string, int>;
+  M m1    = {{}};
+  opentelemetry::trace::KeyValueIterableView<M> view{m1};
+
+  int sampled = 0;
+  for (int i = 0; i < iterations; ++i)
+  {
+    auto result = sampler.ShouldSample(nullptr, opentelemetry::trace::TraceId(), "",
+                                       opentelemetry::trace::SpanKind::kInternal, view);
+    if (result.decision == Decision::RECORD_AND_SAMPLE)
+    {
+      ++sampled;
+    }
+    EXPECT_EQ(nullptr, result.attributes);
+  }
+  return sampled;
+}
+}  // namespace
+
+TEST(RateLimitingSampler, SamplesUpToOneSecondOfSpans)
+{
+  RateLimitingSampler sampler(100);
+  EXPECT_EQ(CountSampled(sampler, 1000), 100);
+}
+
+TEST(RateLimitingSampler, RefillsOverTime)
+{
+  RateLimitingSampler sampler(1000);
+  CountSampled(sampler, 2000);
+
+  std::this_thread::sleep_for(std::chrono::milliseconds(50));
+
+  // At least the tokens of 50ms are added back, but never more than the bucket holds.
+  int sampled = CountSampled(sampler, 10000);
+  EXPECT_GE(sampled, 50);
+  EXPECT_LE(sampled, 1000);
+}
+
+TEST(RateLimitingSampler, RefillsAfterBurstForFewSpans)
+{
+  RateLimitingSampler sampler(10);
+  CountSampled(sampler, 1035);
+
+  std::this_thread::sleep_for(std::chrono::milliseconds(1100));
+
+  // The bucket is full again, however few spans follow the burst.
+  EXPECT_EQ(CountSampled(sampler, 5), 5);
+}
+
+TEST(RateLimitingSampler, LimitsConcurrentSpans)
+{
+  RateLimitingSampler sampler(500);
+  std::atomic<int> sampled{0};
+  auto start = std::chrono::steady_clock::now();
+
+  std::vector<std::thread> threads;
+  for (int i = 0; i < 4; ++i)
+  {
+    threads.emplace_back([&] { sampled += CountSampled(sampler, 20000); });
+  }
+  for (auto &thread : threads)
+  {
+    thread.join();
+  }
+
+  auto elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+  EXPECT_GE(sampled, 500);
+  EXPECT_LE(sampled, 500 + static_cast<int>(500 * elapsed) + 1);
+}
+
+TEST(RateLimitingSampler, GetDescription)
+{
+  RateLimitingSampler sampler(100);
+  ASSERT_EQ("RateLimitingSampler{100.000000}", sampler.GetDescription());
+
+  RateLimitingSampler minimum(0);
+  ASSERT_EQ("RateLimitingSampler{1.000000}", minimum.GetDescription());
+}
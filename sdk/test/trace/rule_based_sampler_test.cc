@@ -0,0 +1,92 @@
+#include "opentelemetry/sdk/trace/samplers/rule_based.h"
+
+#include <gtest/gtest.h>
+
+#include <map>
+
+using opentelemetry::sdk::trace::Decision;
+using opentelemetry::sdk::trace::RuleBasedSampler;
+using opentelemetry::sdk::trace::SamplingRule;
+using opentelemetry::trace::KeyValueIterableView;
+
+namespace
+{
+using M = std::map<std::string, std::string>;
+
+/*
+ * Returns the index of the rule matched by a span of the given name and string attributes.
+ */
+std::size_t Match(RuleBasedSampler &sampler, const std::string &name, const M &attributes = {})
+{
+  return sampler.Match(name, KeyValueIterableView<M>{attributes});
+}
+}  // namespace
+
+TEST(RuleBasedSampler, MatchesFirstRule)
+{
+  RuleBasedSampler sampler({{"GET /health", "", "", 0.0},
+                            {"/checkout*", "", "", 1.0},
+                            {"*", "http.route", "/cart", 1.0},
+                            {"GET *", "", "", 0.5},
+                            {"POST *", "user", "admin", 1.0}},
+                           0.01);
+
+  EXPECT_EQ(Match(sampler, "GET /health"), 0);
+  EXPECT_EQ(Match(sampler, "GET /healthz"), 3);
+  EXPECT_EQ(Match(sampler, "GET "), 3);
+  EXPECT_EQ(Match(sampler, "/checkout"), 1);
+  EXPECT_EQ(Match(sampler, "/checkout/pay"), 1);
+  EXPECT_EQ(Match(sampler, "/check"), 5);
+  EXPECT_EQ(Match(sampler, ""), 5);
+
+  // Rules with an attribute only match spans started with that attribute value.
+  EXPECT_EQ(Match(sampler, "POST /x", {{"http.route", "/cart"}}), 2);
+  EXPECT_EQ(Match(sampler, "POST /x", {{"http.route", "/carts"}}), 5);
+  EXPECT_EQ(Match(sampler, "GET /x", {{"http.route", "/cart"}}), 2);
+  EXPECT_EQ(Match(sampler, "GET /health", {{"http.route", "/cart"}}), 0);
+  EXPECT_EQ(Match(sampler, "POST /x", {{"user", "admin"}}), 4);
+  EXPECT_EQ(Match(sampler, "GET /x", {{"user", "admin"}}), 3);
+  EXPECT_EQ(Match(sampler, "PUT /x", {{"user", "admin"}, {"http.route", "/cart"}}), 2);
+
+  // Only string attribute values are matched.
+  std::map<std::string, int> numbers = {{"user", 1}};
+  EXPECT_EQ(sampler.Match("POST /x", KeyValueIterableView<std::map<std::string, int>>{numbers}),
+            5);
+}
+
+TEST(RuleBasedSampler, EarlierRulesTakePrecedence)
+{
+  RuleBasedSampler sampler({{"GET *", "", "", 0.5}, {"GET /health", "", "", 0.0}}, 0.01);
+  EXPECT_EQ(Match(sampler, "GET /health"), 0);
+  EXPECT_EQ(Match(sampler, "POST /health"), 2);
+}
+
+TEST(RuleBasedSampler, ShouldSampleWithRuleProbability)
+{
+  RuleBasedSampler sampler({{"never", "", "", 0.0}, {"always", "", "", 1.0}}, 0.5);
+
+  M m1;
+  KeyValueIterableView<M> view{m1};
+  auto kind = opentelemetry::trace::SpanKind::kInternal;
+
+  constexpr uint8_t low[16]  = {0};
+  constexpr uint8_t high[16] = {0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff};
+  opentelemetry::trace::TraceId low_id(low);
+  opentelemetry::trace::TraceId high_id(high);
+
+  EXPECT_EQ(Decision::NOT_RECORD,
+            sampler.ShouldSample(nullptr, low_id, "never", kind, view).decision);
+  EXPECT_EQ(Decision::RECORD_AND_SAMPLE,
+            sampler.ShouldSample(nullptr, high_id, "always", kind, view).decision);
+  EXPECT_EQ(Decision::RECORD_AND_SAMPLE,
+            sampler.ShouldSample(nullptr, low_id, "other", kind, view).decision);
+  EXPECT_EQ(Decision::NOT_RECORD,
+            sampler.ShouldSample(nullptr, high_id, "other", kind, view).decision);
+  EXPECT_EQ(nullptr, sampler.ShouldSample(nullptr, low_id, "other", kind, view).attributes);
+}
+
+TEST(RuleBasedSampler, GetDescription)
+{
+  RuleBasedSampler sampler({{"a", "", "", 0.0}, {"b", "", "", 1.0}, {"c*", "", "", 0.5}}, 0.01);
+  ASSERT_EQ("RuleBasedSampler{rules=3,default=0.010000}", sampler.GetDescription());
+}
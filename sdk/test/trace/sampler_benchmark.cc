@@ -0,0 +1,136 @@
+#include "opentelemetry/sdk/trace/samplers/adaptive.h"
+#include "opentelemetry/sdk/trace/samplers/probability.h"
+#include "opentelemetry/sdk/trace/samplers/rate_limiting.h"
+#include "opentelemetry/sdk/trace/samplers/rule_based.h"
+
+#include <map>
+#include <string>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+namespace
+{
+using opentelemetry::sdk::trace::AdaptiveSampler;
+using opentelemetry::sdk::trace::ProbabilitySampler;
+using opentelemetry::sdk::trace::RateLimitingSampler;
+using opentelemetry::sdk::trace::RuleBasedSampler;
+using opentelemetry::sdk::trace::Sampler;
+using opentelemetry::sdk::trace::SamplingRule;
+
+using M = std::map<std::string, std::string>;
+
+/*
+ * Calls ShouldSample on the sampler for every iteration, for a span of the given name and
+ * attributes.
+ */
+void RunShouldSample(benchmark::State &state,
+                     Sampler &sampler,
+                     opentelemetry::nostd::string_view name = "",
+                     const M &attributes                    = {{"", ""}})
+{
+  opentelemetry::trace::KeyValueIterableView<M> view{attributes};
+  uint8_t buffer[opentelemetry::trace::TraceId::kSize] = {0x12, 0x34, 0x56, 0x78};
+  opentelemetry::trace::TraceId trace_id(buffer);
+
+  for (auto _ : state)
+  {
+    benchmark::DoNotOptimize(sampler.ShouldSample(nullptr, trace_id, name,
+                                                  opentelemetry::trace::SpanKind::kInternal, view));
+  }
+}
+
+void BM_ProbabilitySampler(benchmark::State &state)
+{
+  ProbabilitySampler sampler(0.5);
+  RunShouldSample(state, sampler);
+}
+BENCHMARK(BM_ProbabilitySampler);
+
+/*
+ * 100 rules: 90 endpoints by exact name, 8 by prefix and 2 by attribute.
+ */
+RuleBasedSampler &GetRuleBasedSampler()
+{
+  static RuleBasedSampler sampler([] {
+    std::vector<SamplingRule> rules;
+    rules.push_back({"GET /health", "", "", 0.0});
+    rules.push_back({"*", "http.route", "/checkout", 1.0});
+    for (int i = 0; i < 89; ++i)
+    {
+      rules.push_back({"GET /api/v1/endpoint/" + std::to_string(i), "", "", 0.1});
+    }
+    for (int i = 0; i < 8; ++i)
+    {
+      rules.push_back({"POST /api/v" + std::to_string(i) + "/*", "", "", 0.2});
+    }
+    rules.push_back({"PUT *", "user", "admin", 1.0});
+    return rules;
+  }(), 0.01);
+  return sampler;
+}
+
+void BM_RuleBasedSamplerExactName(benchmark::State &state)
+{
+  RunShouldSample(state, GetRuleBasedSampler(), "GET /api/v1/endpoint/42",
+                  {{"http.method", "GET"}, {"http.target", "/api/v1/endpoint/42"}});
+}
+BENCHMARK(BM_RuleBasedSamplerExactName);
+
+void BM_RuleBasedSamplerPrefix(benchmark::State &state)
+{
+  RunShouldSample(state, GetRuleBasedSampler(), "POST /api/v7/orders",
+                  {{"http.method", "POST"}, {"http.target", "/api/v7/orders"}});
+}
+BENCHMARK(BM_RuleBasedSamplerPrefix);
+
+void BM_RuleBasedSamplerAttribute(benchmark::State &state)
+{
+  RunShouldSample(state, GetRuleBasedSampler(), "POST /cart",
+                  {{"http.method", "POST"}, {"http.route", "/checkout"}});
+}
+BENCHMARK(BM_RuleBasedSamplerAttribute);
+
+void BM_RuleBasedSamplerNoMatch(benchmark::State &state)
+{
+  RunShouldSample(state, GetRuleBasedSampler(), "GET /api/v2/other",
+                  {{"http.method", "GET"}, {"http.target", "/api/v2/other"}});
+}
+BENCHMARK(BM_RuleBasedSamplerNoMatch);
+
+// The stateful samplers run with 1 to 64 threads, to show how they contend.
+
+// Every span is sampled, so the bucket never empties.
+void BM_RateLimitingSamplerUnderLimit(benchmark::State &state)
+{
+  static RateLimitingSampler sampler(1e18);
+  RunShouldSample(state, sampler);
+}
+BENCHMARK(BM_RateLimitingSamplerUnderLimit)->ThreadRange(1, 64)->UseRealTime();
+
+// Nearly every span is rejected.
+void BM_RateLimitingSamplerOverLimit(benchmark::State &state)
+{
+  static RateLimitingSampler sampler(1000);
+  RunShouldSample(state, sampler);
+}
+BENCHMARK(BM_RateLimitingSamplerOverLimit)->ThreadRange(1, 64)->UseRealTime();
+
+// The baseline of the adaptive sampler, which samples root spans the same way.
+void BM_ProbabilitySamplerThreads(benchmark::State &state)
+{
+  static ProbabilitySampler sampler(0.5);
+  RunShouldSample(state, sampler);
+}
+BENCHMARK(BM_ProbabilitySamplerThreads)->ThreadRange(1, 64)->UseRealTime();
+
+// The probability is adjusted to the traffic of the benchmark every millisecond.
+void BM_AdaptiveSampler(benchmark::State &state)
+{
+  static AdaptiveSampler sampler(1000, std::chrono::milliseconds(1));
+  RunShouldSample(state, sampler);
+}
+BENCHMARK(BM_AdaptiveSampler)->ThreadRange(1, 64)->UseRealTime();
+}  // namespace
+
+BENCHMARK_MAIN();
@@ -1,10 +1,14 @@
 #include "opentelemetry/sdk/trace/span_data.h"
 #include "opentelemetry/nostd/variant.h"
+#include "opentelemetry/trace/key_value_iterable_view.h"
 #include "opentelemetry/trace/span_id.h"
 #include "opentelemetry/trace/trace_id.h"
 
 #include <gtest/gtest.h>
 
+#include <map>
+#include <string>
+
 using opentelemetry::sdk::trace::SpanData;
 
 TEST(SpanData, DefaultValues)
@@ -17,6 +21,7 @@ TEST(SpanData, DefaultValues)
   ASSERT_EQ(data.GetSpanId(), zero_span_id);
   ASSERT_EQ(data.GetParentSpanId(), zero_span_id);
   ASSERT_EQ(data.GetName(), "");
+  ASSERT_EQ(data.GetSpanKind(), opentelemetry::trace::SpanKind::kInternal);
   ASSERT_EQ(data.GetStatus(), opentelemetry::trace::CanonicalCode::OK);
   ASSERT_EQ(data.GetDescription(), "");
   ASSERT_EQ(data.GetStartTime().time_since_epoch(), std::chrono::nanoseconds(0));
@@ -34,19 +39,126 @@ TEST(SpanData, Set)
   SpanData data;
   data.SetIds(trace_id, span_id, parent_span_id);
   data.SetName("span name");
+  data.SetSpanKind(opentelemetry::trace::SpanKind::kServer);
   data.SetStatus(opentelemetry::trace::CanonicalCode::UNKNOWN, "description");
   data.SetStartTime(now);
   data.SetDuration(std::chrono::nanoseconds(1000000));
   data.SetAttribute("attr1", 314159);
-  data.AddEvent("event1", now);
+  std::map<std::string, int> event_attributes = {{"attr2", 2}};
+  opentelemetry::trace::KeyValueIterableView<std::map<std::string, int>> event_view{
+      event_attributes};
+  data.AddEvent("event1", now, event_view);
 
   ASSERT_EQ(data.GetTraceId(), trace_id);
   ASSERT_EQ(data.GetSpanId(), span_id);
   ASSERT_EQ(data.GetParentSpanId(), parent_span_id);
   ASSERT_EQ(data.GetName(), "span name");
+  ASSERT_EQ(data.GetSpanKind(), opentelemetry::trace::SpanKind::kServer);
   ASSERT_EQ(data.GetStatus(), opentelemetry::trace::CanonicalCode::UNKNOWN);
   ASSERT_EQ(data.GetDescription(), "description");
   ASSERT_EQ(data.GetStartTime().time_since_epoch(), now.time_since_epoch());
   ASSERT_EQ(data.GetDuration(), std::chrono::nanoseconds(1000000));
   ASSERT_EQ(opentelemetry::nostd::get<int64_t>(data.GetAttributes().at("attr1")), 314159);
+  ASSERT_EQ(data.GetEventCount(), 1);
+  ASSERT_EQ(data.GetEvent(0).GetName(), "event1");
+  ASSERT_EQ(data.GetEvent(0).GetTimestamp().time_since_epoch(), now.time_since_epoch());
+  ASSERT_EQ(data.GetEvent(0).GetAttributes().size(), 1);
+  ASSERT_EQ(data.GetEvent(0).GetAttributes()[0].first, "attr2");
+  ASSERT_EQ(opentelemetry::nostd::get<int64_t>(data.GetEvent(0).GetAttributes()[0].second), 2);
+  ASSERT_EQ(data.GetDroppedEventCount(), 0);
+}
+
+TEST(SpanData, Init)
+{
+  uint8_t trace_id_buffer[opentelemetry::trace::TraceId::kSize] = {1};
+  uint8_t span_id_buffer[opentelemetry::trace::SpanId::kSize]   = {2};
+  opentelemetry::trace::TraceId trace_id(trace_id_buffer);
+  opentelemetry::trace::SpanId span_id(span_id_buffer);
+  opentelemetry::core::SystemTimestamp now(std::chrono::system_clock::now());
+  std::map<std::string, int> attributes                  = {{"attr1", 1}, {"attr2", 2}};
+  std::map<std::string, std::string> sampling_attributes = {{"attr2", "sampled"}};
+  opentelemetry::trace::KeyValueIterableView<std::map<std::string, int>> view{attributes};
+  opentelemetry::trace::KeyValueIterableView<std::map<std::string, std::string>> sampling_view{
+      sampling_attributes};
+
+  SpanData data;
+  data.Init({trace_id, span_id, opentelemetry::trace::SpanId(), "span name",
+             opentelemetry::trace::SpanKind::kClient, &view, &sampling_view, now});
+
+  ASSERT_EQ(data.GetTraceId(), trace_id);
+  ASSERT_EQ(data.GetSpanId(), span_id);
+  ASSERT_FALSE(data.GetParentSpanId().IsValid());
+  ASSERT_EQ(data.GetName(), "span name");
+  ASSERT_EQ(data.GetSpanKind(), opentelemetry::trace::SpanKind::kClient);
+  ASSERT_EQ(data.GetStartTime().time_since_epoch(), now.time_since_epoch());
+  ASSERT_EQ(data.GetAttributes().size(), 2);
+  ASSERT_EQ(opentelemetry::nostd::get<int64_t>(data.GetAttributes().at("attr1")), 1);
+  ASSERT_EQ(opentelemetry::nostd::get<std::string>(data.GetAttributes().at("attr2")), "sampled");
+}
+
+TEST(SpanData, InternsAttributeKeys)
+{
+  SpanData data1;
+  SpanData data2;
+  data1.SetAttribute("interned.key", 1);
+  data2.SetAttribute(std::string("interned.key"), 2);
+
+  auto key = opentelemetry::sdk::trace::AttributeKeyTable::GetGlobal().Intern("interned.key");
+  ASSERT_EQ(data1.GetAttributes().begin()->first.data(), key.data());
+  ASSERT_EQ(data2.GetAttributes().begin()->first.data(), key.data());
+}
+
+TEST(SpanData, DropsOldestEvents)
+{
+  std::map<std::string, int> attributes;
+  opentelemetry::trace::KeyValueIterableView<std::map<std::string, int>> view{attributes};
+  SpanData data(3);
+  for (int i = 0; i < 5; ++i)
+  {
+    attributes["index"] = i;
+    data.AddEvent("event" + std::to_string(i),
+                  opentelemetry::core::SystemTimestamp(std::chrono::nanoseconds(i)), view);
+  }
+
+  ASSERT_EQ(data.GetEventCount(), 3);
+  ASSERT_EQ(data.GetDroppedEventCount(), 2);
+  for (int i = 0; i < 3; ++i)
+  {
+    auto &event = data.GetEvent(i);
+    ASSERT_EQ(event.GetName(), "event" + std::to_string(i + 2));
+    ASSERT_EQ(event.GetTimestamp().time_since_epoch(), std::chrono::nanoseconds(i + 2));
+    ASSERT_EQ(event.GetAttributes().size(), 1);
+    ASSERT_EQ(opentelemetry::nostd::get<int64_t>(event.GetAttributes()[0].second), i + 2);
+  }
+
+  SpanData no_events(0);
+  no_events.AddEvent("event", opentelemetry::core::SystemTimestamp(), view);
+  ASSERT_EQ(no_events.GetEventCount(), 0);
+  ASSERT_EQ(no_events.GetDroppedEventCount(), 1);
+}
+
+// Fills the global attribute key table, so it runs last.
+TEST(SpanData, CopiesKeysBeyondTheKeyTable)
+{
+  auto &keys = opentelemetry::sdk::trace::AttributeKeyTable::GetGlobal();
+  for (int i = 0; keys.Intern("fill" + std::to_string(i)).data() != nullptr; ++i)
+  {
+  }
+
+  std::string key = "copied.key";
+  SpanData data;
+  data.SetAttribute(key, 1);
+  data.SetAttribute(key, 2);
+  ASSERT_EQ(data.GetAttributes().size(), 1);
+  ASSERT_NE(data.GetAttributes().begin()->first.data(), key.data());
+  ASSERT_EQ(opentelemetry::nostd::get<int64_t>(data.GetAttributes().at("copied.key")), 2);
+
+  std::map<std::string, int> attributes = {{"copied.event.key", 3}};
+  opentelemetry::trace::KeyValueIterableView<std::map<std::string, int>> view{attributes};
+  data.AddEvent("event", opentelemetry::core::SystemTimestamp(), view);
+  data.AddEvent("event", opentelemetry::core::SystemTimestamp(), view);
+  auto &event = data.GetEvent(1);
+  ASSERT_EQ(event.GetAttributes().size(), 1);
+  ASSERT_EQ(event.GetAttributes()[0].first, "copied.event.key");
+  ASSERT_EQ(opentelemetry::nostd::get<int64_t>(event.GetAttributes()[0].second), 3);
 }
@@ -0,0 +1,112 @@
+#include "opentelemetry/sdk/trace/static_tracer.h"
+#include "opentelemetry/sdk/trace/samplers/parent_or_else.h"
+#include "opentelemetry/sdk/trace/samplers/probability.h"
+#include "opentelemetry/sdk/trace/samplers/static.h"
+#include "opentelemetry/sdk/trace/span_data.h"
+#include "opentelemetry/sdk/trace/static_processor.h"
+
+#include <gtest/gtest.h>
+
+#include <map>
+#include <vector>
+
+using namespace opentelemetry::sdk::trace;
+using opentelemetry::trace::TraceId;
+
+/**
+ * A static exporter that keeps every span it is passed.
+ */
+class CollectingExporter
+{
+public:
+  using recordable_type = SpanData;
+
+  ExportResult Export(const opentelemetry::nostd::span<SpanData> &spans) noexcept
+  {
+    for (auto &span : spans)
+    {
+      exported->push_back(std::move(span));
+    }
+    return ExportResult::kSuccess;
+  }
+
+  void Shutdown(std::chrono::microseconds) noexcept { *shut_down = true; }
+
+  std::shared_ptr<std::vector<SpanData>> exported = std::make_shared<std::vector<SpanData>>();
+  std::shared_ptr<bool> shut_down                 = std::make_shared<bool>(false);
+};
+
+template <class SamplerT>
+using CollectingTracer = StaticTracer<SamplerT, StaticSimpleSpanProcessor<CollectingExporter>>;
+
+TEST(StaticTracer, RecordsSampledSpans)
+{
+  auto tracer    = std::make_shared<CollectingTracer<StaticAlwaysOnSampler>>();
+  auto &exported = *tracer->GetProcessor().GetExporter().exported;
+
+  opentelemetry::trace::Tracer &api_tracer  = *tracer;
+  std::map<std::string, int64_t> attributes = {{"attr1", 314159}};
+  auto span                                 = api_tracer.StartSpan("span 1", attributes);
+  EXPECT_TRUE(span->IsRecording());
+  span->SetAttribute("attr2", "value");
+  span->AddEvent("event 1", {{"attr3", 1}});
+  span->SetStatus(opentelemetry::trace::CanonicalCode::INTERNAL, "failed");
+  EXPECT_TRUE(exported.empty());
+  span->End();
+  EXPECT_FALSE(span->IsRecording());
+  span->End();
+
+  ASSERT_EQ(1, exported.size());
+  auto &span_data = exported[0];
+  EXPECT_EQ("span 1", span_data.GetName());
+  EXPECT_TRUE(span_data.GetTraceId().IsValid());
+  EXPECT_TRUE(span_data.GetSpanId().IsValid());
+  EXPECT_FALSE(span_data.GetParentSpanId().IsValid());
+  EXPECT_EQ(opentelemetry::trace::CanonicalCode::INTERNAL, span_data.GetStatus());
+  ASSERT_EQ(2, span_data.GetAttributes().size());
+  EXPECT_EQ(314159, opentelemetry::nostd::get<int64_t>(span_data.GetAttributes().at("attr1")));
+  EXPECT_EQ("value",
+            opentelemetry::nostd::get<std::string>(span_data.GetAttributes().at("attr2")));
+  ASSERT_EQ(1, span_data.GetEventCount());
+  EXPECT_EQ("event 1", span_data.GetEvent(0).GetName());
+  EXPECT_EQ(1, span_data.GetEvent(0).GetAttributes().size());
+  EXPECT_EQ(&api_tracer, &span->tracer());
+}
+
+TEST(StaticTracer, DropsUnsampledSpans)
+{
+  auto tracer = std::make_shared<CollectingTracer<StaticAlwaysOffSampler>>();
+
+  opentelemetry::trace::Tracer &api_tracer = *tracer;
+  auto span                                = api_tracer.StartSpan("span 1");
+  EXPECT_FALSE(span->IsRecording());
+  span->End();
+  EXPECT_TRUE(tracer->GetProcessor().GetExporter().exported->empty());
+}
+
+TEST(StaticTracer, CloseShutsDownProcessor)
+{
+  auto tracer = std::make_shared<CollectingTracer<StaticAlwaysOnSampler>>();
+
+  tracer->CloseWithMicroseconds(0);
+  EXPECT_TRUE(*tracer->GetProcessor().GetExporter().shut_down);
+}
+
+TEST(StaticTracer, StaticSamplersMatchSamplers)
+{
+  StaticParentOrElseSampler<StaticProbabilitySampler> static_sampler(
+      StaticProbabilitySampler(0.25));
+  ParentOrElseSampler sampler(std::make_shared<ProbabilitySampler>(0.25));
+  EXPECT_EQ(sampler.GetDescription(), static_sampler.GetDescription());
+
+  std::map<std::string, int> attributes;
+  opentelemetry::trace::KeyValueIterableView<std::map<std::string, int>> view{attributes};
+  auto kind = opentelemetry::trace::SpanKind::kInternal;
+  for (int i = 0; i < 256; ++i)
+  {
+    uint8_t buffer[TraceId::kSize] = {0, 0, 0, 0, 0, 0, 0, static_cast<uint8_t>(i)};
+    TraceId trace_id(buffer);
+    EXPECT_EQ(sampler.ShouldSample(nullptr, trace_id, "", kind, view).decision,
+              static_sampler.ShouldSample(nullptr, trace_id, "", kind, view).decision);
+  }
+}
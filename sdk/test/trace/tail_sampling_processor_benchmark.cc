@@ -0,0 +1,86 @@
+#include "opentelemetry/sdk/trace/tail_sampling_processor.h"
+
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+
+#include <benchmark/benchmark.h>
+
+namespace
+{
+using namespace opentelemetry::sdk::trace;
+using opentelemetry::trace::CanonicalCode;
+using opentelemetry::trace::SpanId;
+using opentelemetry::trace::TraceId;
+
+/**
+ * A recordable and processor that do nothing, so only the tail sampling is measured.
+ */
+class NoopRecordable final : public Recordable
+{
+public:
+  void SetIds(TraceId, SpanId, SpanId) noexcept override {}
+  void SetAttribute(opentelemetry::nostd::string_view,
+                    const opentelemetry::common::AttributeValue &) noexcept override
+  {}
+  void AddEvent(opentelemetry::nostd::string_view,
+                opentelemetry::core::SystemTimestamp,
+                const opentelemetry::trace::KeyValueIterable &) noexcept override
+  {}
+  void SetStatus(CanonicalCode, opentelemetry::nostd::string_view) noexcept override {}
+  void SetName(opentelemetry::nostd::string_view) noexcept override {}
+  void SetSpanKind(opentelemetry::trace::SpanKind) noexcept override {}
+  void SetStartTime(opentelemetry::core::SystemTimestamp) noexcept override {}
+  void SetDuration(std::chrono::nanoseconds) noexcept override {}
+};
+
+class NoopSpanProcessor final : public SpanProcessor
+{
+public:
+  std::unique_ptr<Recordable> MakeRecordable() noexcept override
+  {
+    return std::unique_ptr<Recordable>(new NoopRecordable);
+  }
+  void OnStart(Recordable &) noexcept override {}
+  void OnEnd(std::unique_ptr<Recordable> &&) noexcept override {}
+  void ForceFlush(std::chrono::microseconds) noexcept override {}
+  void Shutdown(std::chrono::microseconds) noexcept override {}
+};
+
+// Every thread ends traces of state.range(0) spans: the children first, then the root, with
+// one trace in a hundred failing. Items are spans, so the rate is spans per second.
+
+void BM_TailSamplingOnEnd(benchmark::State &state)
+{
+  static TailSamplingSpanProcessor processor(std::make_shared<NoopSpanProcessor>());
+  static std::atomic<uint64_t> next_trace{1};
+  const int64_t spans_per_trace = state.range(0);
+
+  SpanId root_id;
+  uint8_t span_id_buffer[SpanId::kSize] = {1};
+  SpanId child_id(span_id_buffer);
+  for (auto _ : state)
+  {
+    uint64_t trace = next_trace.fetch_add(1, std::memory_order_relaxed);
+    uint8_t trace_id_buffer[TraceId::kSize] = {0};
+    std::memcpy(trace_id_buffer, &trace, sizeof(trace));
+    TraceId trace_id(trace_id_buffer);
+    for (int64_t i = spans_per_trace - 1; i >= 0; --i)
+    {
+      auto span = processor.MakeRecordable();
+      processor.OnStart(*span);
+      span->SetIds(trace_id, child_id, i == 0 ? root_id : child_id);
+      if (i == 0 && trace % 100 == 0)
+      {
+        span->SetStatus(CanonicalCode::INTERNAL, "");
+      }
+      span->SetDuration(std::chrono::microseconds(i));
+      processor.OnEnd(std::move(span));
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * spans_per_trace);
+}
+BENCHMARK(BM_TailSamplingOnEnd)->Arg(1)->Arg(10)->ThreadRange(1, 8)->UseRealTime();
+}  // namespace
+
+BENCHMARK_MAIN();
@@ -0,0 +1,232 @@
+#include "opentelemetry/sdk/trace/tail_sampling_processor.h"
+#include "opentelemetry/sdk/trace/span_data.h"
+#include "opentelemetry/sdk/trace/tracer.h"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <atomic>
+#include <thread>
+#include <vector>
+
+using namespace opentelemetry::sdk::trace;
+using opentelemetry::trace::CanonicalCode;
+using opentelemetry::trace::SpanId;
+using opentelemetry::trace::TraceId;
+
+/**
+ * A processor that keeps every span it is passed, as span data.
+ */
+class CollectingSpanProcessor : public SpanProcessor
+{
+public:
+  std::unique_ptr<Recordable> MakeRecordable() noexcept override
+  {
+    return std::unique_ptr<Recordable>(new SpanData);
+  }
+
+  void OnStart(Recordable &) noexcept override {}
+
+  void OnEnd(std::unique_ptr<Recordable> &&span) noexcept override
+  {
+    ended.emplace_back(static_cast<SpanData *>(span.release()));
+    ++ended_count;
+  }
+
+  void ForceFlush(std::chrono::microseconds) noexcept override { ++flushed; }
+
+  void Shutdown(std::chrono::microseconds) noexcept override { ++shut_down; }
+
+  std::vector<std::unique_ptr<SpanData>> ended;
+  // Counts the ended spans, for spans that end on the background thread of the processor.
+  std::atomic<std::size_t> ended_count{0};
+  int flushed   = 0;
+  int shut_down = 0;
+};
+
+TraceId MakeTraceId(uint8_t value)
+{
+  uint8_t buffer[TraceId::kSize];
+  std::fill(buffer, buffer + TraceId::kSize, value);
+  return TraceId(buffer);
+}
+
+SpanId MakeSpanId(uint8_t value)
+{
+  uint8_t buffer[SpanId::kSize] = {0, 0, 0, 0, 0, 0, 0, value};
+  return SpanId(buffer);
+}
+
+/**
+ * Ends a span of the trace, which is a local root if parent is 0.
+ */
+void EndSpan(SpanProcessor &processor,
+             uint8_t trace,
+             uint8_t span,
+             uint8_t parent,
+             CanonicalCode status            = CanonicalCode::OK,
+             std::chrono::milliseconds duration = std::chrono::milliseconds(1))
+{
+  auto recordable = processor.MakeRecordable();
+  processor.OnStart(*recordable);
+  recordable->SetIds(MakeTraceId(trace), MakeSpanId(span), MakeSpanId(parent));
+  recordable->SetStatus(status, "");
+  recordable->SetDuration(duration);
+  processor.OnEnd(std::move(recordable));
+}
+
+TEST(TailSamplingSpanProcessor, KeepsTracesWithErrors)
+{
+  auto downstream = std::make_shared<CollectingSpanProcessor>();
+  TailSamplingSpanProcessor processor(downstream);
+
+  EndSpan(processor, 1, 2, 1, CanonicalCode::INTERNAL);
+  EndSpan(processor, 2, 2, 1);
+  EXPECT_EQ(processor.GetBufferedSpanCount(), 2);
+  EXPECT_TRUE(downstream->ended.empty());
+
+  // The whole trace is kept once its root ends.
+  EndSpan(processor, 1, 1, 0);
+  ASSERT_EQ(downstream->ended.size(), 2);
+  EXPECT_EQ(downstream->ended[0]->GetSpanId(), MakeSpanId(2));
+  EXPECT_EQ(downstream->ended[0]->GetStatus(), CanonicalCode::INTERNAL);
+  EXPECT_EQ(downstream->ended[1]->GetSpanId(), MakeSpanId(1));
+  EXPECT_EQ(processor.GetBufferedSpanCount(), 1);
+
+  // A trace without errors is dropped.
+  EndSpan(processor, 2, 1, 0);
+  EXPECT_EQ(downstream->ended.size(), 2);
+  EXPECT_EQ(processor.GetBufferedSpanCount(), 0);
+}
+
+TEST(TailSamplingSpanProcessor, KeepsSlowTraces)
+{
+  auto downstream = std::make_shared<CollectingSpanProcessor>();
+  TailSamplingOptions options;
+  options.keep_errors       = false;
+  options.latency_threshold = std::chrono::milliseconds(100);
+  TailSamplingSpanProcessor processor(downstream, options);
+
+  EndSpan(processor, 1, 2, 1, CanonicalCode::OK, std::chrono::milliseconds(150));
+  EndSpan(processor, 1, 1, 0, CanonicalCode::OK, std::chrono::milliseconds(10));
+  EndSpan(processor, 2, 1, 0, CanonicalCode::INTERNAL, std::chrono::milliseconds(99));
+
+  ASSERT_EQ(downstream->ended.size(), 2);
+  EXPECT_EQ(downstream->ended[0]->GetTraceId(), MakeTraceId(1));
+  EXPECT_EQ(downstream->ended[1]->GetTraceId(), MakeTraceId(1));
+}
+
+TEST(TailSamplingSpanProcessor, KeepsShareOfTraces)
+{
+  auto downstream = std::make_shared<CollectingSpanProcessor>();
+  TailSamplingOptions options;
+  options.probability = 0.5;
+  TailSamplingSpanProcessor processor(downstream, options);
+
+  // Traces are chosen by the first 8 bytes of their id.
+  EndSpan(processor, 0x10, 1, 0);
+  EndSpan(processor, 0xf0, 1, 0);
+
+  ASSERT_EQ(downstream->ended.size(), 1);
+  EXPECT_EQ(downstream->ended[0]->GetTraceId(), MakeTraceId(0x10));
+}
+
+TEST(TailSamplingSpanProcessor, DecidesTimedOutTraces)
+{
+  auto downstream = std::make_shared<CollectingSpanProcessor>();
+  TailSamplingOptions options;
+  options.decision_wait = std::chrono::milliseconds(0);
+  TailSamplingSpanProcessor processor(downstream, options);
+
+  // The trace is decided without waiting for its root, which then follows the decision.
+  EndSpan(processor, 1, 2, 1, CanonicalCode::INTERNAL);
+  EXPECT_EQ(downstream->ended.size(), 1);
+  EXPECT_EQ(processor.GetBufferedSpanCount(), 0);
+
+  EndSpan(processor, 1, 1, 0);
+  ASSERT_EQ(downstream->ended.size(), 2);
+  EXPECT_EQ(downstream->ended[1]->GetSpanId(), MakeSpanId(1));
+}
+
+TEST(TailSamplingSpanProcessor, DecidesTimedOutTracesOfEveryShard)
+{
+  auto downstream = std::make_shared<CollectingSpanProcessor>();
+  TailSamplingOptions options;
+  options.decision_wait  = std::chrono::milliseconds(50);
+  options.sweep_interval = std::chrono::milliseconds(10);
+  TailSamplingSpanProcessor processor(downstream, options);
+
+  // The two traces are in different shards, so neither is decided when a span of the other
+  // ends, and no span ends once the decision wait ran out.
+  uint8_t buffer[TraceId::kSize] = {1};
+  TraceId trace_id1(buffer);
+  buffer[0] = 2;
+  TraceId trace_id2(buffer);
+  for (auto &trace_id : {trace_id1, trace_id2})
+  {
+    auto recordable = processor.MakeRecordable();
+    recordable->SetIds(trace_id, MakeSpanId(2), MakeSpanId(1));
+    recordable->SetStatus(CanonicalCode::INTERNAL, "");
+    processor.OnEnd(std::move(recordable));
+  }
+  EXPECT_EQ(downstream->ended_count, 0);
+
+  auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(10);
+  while (downstream->ended_count < 2 && std::chrono::steady_clock::now() < deadline)
+  {
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+  }
+  ASSERT_EQ(downstream->ended_count, 2);
+  EXPECT_EQ(processor.GetBufferedSpanCount(), 0);
+  EXPECT_EQ(downstream->flushed, 0);
+}
+
+TEST(TailSamplingSpanProcessor, DecidesOldestTracesOverBudget)
+{
+  auto downstream = std::make_shared<CollectingSpanProcessor>();
+  TailSamplingOptions options;
+  options.max_buffered_spans = 1;
+  TailSamplingSpanProcessor processor(downstream, options);
+
+  // Spans of the same trace share a shard, whose budget is a single span.
+  EndSpan(processor, 1, 2, 1, CanonicalCode::INTERNAL);
+  EXPECT_EQ(processor.GetBufferedSpanCount(), 1);
+  EndSpan(processor, 1, 3, 1);
+  EXPECT_EQ(processor.GetBufferedSpanCount(), 0);
+  EXPECT_EQ(downstream->ended.size(), 2);
+}
+
+TEST(TailSamplingSpanProcessor, FlushDecidesBufferedTraces)
+{
+  auto downstream = std::make_shared<CollectingSpanProcessor>();
+  TailSamplingSpanProcessor processor(downstream);
+
+  EndSpan(processor, 1, 2, 1, CanonicalCode::INTERNAL);
+  EndSpan(processor, 2, 2, 1);
+  processor.ForceFlush();
+  EXPECT_EQ(downstream->ended.size(), 1);
+  EXPECT_EQ(downstream->flushed, 1);
+  EXPECT_EQ(processor.GetBufferedSpanCount(), 0);
+
+  EndSpan(processor, 3, 2, 1, CanonicalCode::UNKNOWN);
+  processor.Shutdown();
+  EXPECT_EQ(downstream->ended.size(), 2);
+  EXPECT_EQ(downstream->shut_down, 1);
+}
+
+TEST(TailSamplingSpanProcessor, SamplesTracerSpans)
+{
+  auto downstream = std::make_shared<CollectingSpanProcessor>();
+  auto processor  = std::make_shared<TailSamplingSpanProcessor>(downstream);
+  std::shared_ptr<opentelemetry::trace::Tracer> tracer(new Tracer(processor));
+
+  tracer->StartSpan("ok")->End();
+  auto span = tracer->StartSpan("failed");
+  span->SetStatus(CanonicalCode::INTERNAL, "");
+  span->End();
+
+  ASSERT_EQ(downstream->ended.size(), 1);
+  EXPECT_EQ(downstream->ended[0]->GetName(), "failed");
+  EXPECT_TRUE(downstream->ended[0]->GetTraceId().IsValid());
+  EXPECT_TRUE(downstream->ended[0]->GetSpanId().IsValid());
+}
@@ -0,0 +1,223 @@
+#include "opentelemetry/sdk/trace/samplers/parent_or_else.h"
+#include "opentelemetry/sdk/trace/samplers/probability.h"
+#include "opentelemetry/sdk/trace/samplers/static.h"
+#include "opentelemetry/sdk/trace/simple_processor.h"
+#include "opentelemetry/sdk/trace/span_data.h"
+#include "opentelemetry/sdk/trace/static_processor.h"
+#include "opentelemetry/sdk/trace/static_tracer.h"
+#include "opentelemetry/sdk/trace/tracer.h"
+#include "opentelemetry/trace/macros.h"
+#include "opentelemetry/trace/noop.h"
+#include "opentelemetry/trace/scoped_span.h"
+
+#include <memory>
+
+#include <benchmark/benchmark.h>
+
+namespace
+{
+using namespace opentelemetry::sdk::trace;
+
+/*
+ * An exporter that drops every span, so that only the pipeline up to the exporter is measured.
+ */
+class DiscardingExporter final : public SpanExporter
+{
+public:
+  std::unique_ptr<Recordable> MakeRecordable() noexcept override
+  {
+    return std::unique_ptr<Recordable>(new SpanData);
+  }
+
+  ExportResult Export(
+      const opentelemetry::nostd::span<std::unique_ptr<Recordable>> &spans) noexcept override
+  {
+    benchmark::DoNotOptimize(spans.data());
+    return ExportResult::kSuccess;
+  }
+
+  void Shutdown(std::chrono::microseconds) noexcept override {}
+};
+
+/*
+ * The static counterpart of the DiscardingExporter.
+ */
+class StaticDiscardingExporter
+{
+public:
+  using recordable_type = SpanData;
+
+  ExportResult Export(const opentelemetry::nostd::span<SpanData> &spans) noexcept
+  {
+    benchmark::DoNotOptimize(spans.data());
+    return ExportResult::kSuccess;
+  }
+
+  void Shutdown(std::chrono::microseconds) noexcept {}
+};
+
+std::shared_ptr<opentelemetry::trace::Tracer> MakeDynamicTracer(double probability)
+{
+  std::unique_ptr<SpanExporter> exporter(new DiscardingExporter);
+  return std::make_shared<Tracer>(
+      std::make_shared<SimpleSpanProcessor>(std::move(exporter)),
+      std::make_shared<ParentOrElseSampler>(std::make_shared<ProbabilitySampler>(probability)));
+}
+
+std::shared_ptr<opentelemetry::trace::Tracer> MakeStaticTracer(double probability)
+{
+  using StaticPipelineTracer = StaticTracer<StaticParentOrElseSampler<StaticProbabilitySampler>,
+                                            StaticSimpleSpanProcessor<StaticDiscardingExporter>>;
+  return std::make_shared<StaticPipelineTracer>(
+      StaticParentOrElseSampler<StaticProbabilitySampler>(StaticProbabilitySampler(probability)));
+}
+
+/*
+ * Starts and ends a span for every iteration, through the trace_api::Tracer interface.
+ */
+void RunStartEndSpan(benchmark::State &state, opentelemetry::trace::Tracer &tracer)
+{
+  for (auto _ : state)
+  {
+    auto span = tracer.StartSpan("span");
+    span->End();
+  }
+}
+
+void BM_DynamicTracerSampled(benchmark::State &state)
+{
+  RunStartEndSpan(state, *MakeDynamicTracer(1.0));
+}
+BENCHMARK(BM_DynamicTracerSampled);
+
+void BM_StaticTracerSampled(benchmark::State &state)
+{
+  RunStartEndSpan(state, *MakeStaticTracer(1.0));
+}
+BENCHMARK(BM_StaticTracerSampled);
+
+void BM_DynamicTracerDropped(benchmark::State &state)
+{
+  RunStartEndSpan(state, *MakeDynamicTracer(0.0));
+}
+BENCHMARK(BM_DynamicTracerDropped);
+
+void BM_StaticTracerDropped(benchmark::State &state)
+{
+  RunStartEndSpan(state, *MakeStaticTracer(0.0));
+}
+BENCHMARK(BM_StaticTracerDropped);
+
+/*
+ * Starts and ends a span with a few attributes for every iteration.
+ */
+void RunStartEndSpanWithAttributes(benchmark::State &state, opentelemetry::trace::Tracer &tracer)
+{
+  for (auto _ : state)
+  {
+    auto span = tracer.StartSpan("span", {{"http.method", "GET"},
+                                          {"http.route", "/api/v1/endpoint"},
+                                          {"http.status_code", 200},
+                                          {"net.peer.port", 8080}});
+    span->End();
+  }
+}
+
+void BM_DynamicTracerAttributes(benchmark::State &state)
+{
+  RunStartEndSpanWithAttributes(state, *MakeDynamicTracer(1.0));
+}
+BENCHMARK(BM_DynamicTracerAttributes);
+
+void BM_StaticTracerAttributes(benchmark::State &state)
+{
+  RunStartEndSpanWithAttributes(state, *MakeStaticTracer(1.0));
+}
+BENCHMARK(BM_StaticTracerAttributes);
+
+/*
+ * Adds an event with an attribute to a long running span for every iteration, which is past the
+ * maximum number of events of the span after the first iterations.
+ */
+void RunAddEvent(benchmark::State &state, opentelemetry::trace::Tracer &tracer)
+{
+  auto span = tracer.StartSpan("span");
+  for (auto _ : state)
+  {
+    span->AddEvent("message", {{"message.id", 1}});
+  }
+  span->End();
+}
+
+void BM_DynamicTracerAddEvent(benchmark::State &state)
+{
+  RunAddEvent(state, *MakeDynamicTracer(1.0));
+}
+BENCHMARK(BM_DynamicTracerAddEvent);
+
+void BM_StaticTracerAddEvent(benchmark::State &state)
+{
+  RunAddEvent(state, *MakeStaticTracer(1.0));
+}
+BENCHMARK(BM_StaticTracerAddEvent);
+
+/*
+ * Starts and ends a scoped span, in storage on the stack, for every iteration.
+ */
+void RunScopedSpan(benchmark::State &state, opentelemetry::trace::Tracer &tracer)
+{
+  for (auto _ : state)
+  {
+    opentelemetry::trace::ScopedSpan span(tracer, "span");
+  }
+}
+
+void BM_ScopedSpanSampled(benchmark::State &state)
+{
+  RunScopedSpan(state, *MakeDynamicTracer(1.0));
+}
+BENCHMARK(BM_ScopedSpanSampled);
+
+void BM_ScopedSpanDropped(benchmark::State &state)
+{
+  RunScopedSpan(state, *MakeDynamicTracer(0.0));
+}
+BENCHMARK(BM_ScopedSpanDropped);
+
+/*
+ * Starts a span with an attribute, sets another and ends the span for every iteration, through
+ * the tracing macros.
+ */
+void RunMacros(benchmark::State &state, opentelemetry::trace::Tracer *tracer)
+{
+  for (auto _ : state)
+  {
+    OPENTELEMETRY_START_SPAN(span, tracer, "span", {{"key", 1}});
+    OPENTELEMETRY_SPAN_SET_ATTRIBUTE(span, "other key", 2);
+    OPENTELEMETRY_SPAN_END(span);
+  }
+}
+
+void BM_MacrosDisabled(benchmark::State &state)
+{
+  opentelemetry::trace::SetTracingEnabled(false);
+  RunMacros(state, MakeDynamicTracer(1.0).get());
+  opentelemetry::trace::SetTracingEnabled(true);
+}
+BENCHMARK(BM_MacrosDisabled);
+
+void BM_MacrosNoopTracer(benchmark::State &state)
+{
+  auto tracer = std::make_shared<opentelemetry::trace::NoopTracer>();
+  RunMacros(state, tracer.get());
+}
+BENCHMARK(BM_MacrosNoopTracer);
+
+void BM_MacrosTracer(benchmark::State &state)
+{
+  RunMacros(state, MakeDynamicTracer(1.0).get());
+}
+BENCHMARK(BM_MacrosTracer);
+}  // namespace
+
+BENCHMARK_MAIN();
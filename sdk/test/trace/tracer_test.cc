@@ -3,9 +3,12 @@
 #include "opentelemetry/sdk/trace/samplers/always_on.h"
 #include "opentelemetry/sdk/trace/simple_processor.h"
 #include "opentelemetry/sdk/trace/span_data.h"
+#include "opentelemetry/trace/scoped_span.h"
 
 #include <gtest/gtest.h>
 
+#include <array>
+
 using namespace opentelemetry::sdk::trace;
 using opentelemetry::core::SteadyTimestamp;
 using opentelemetry::core::SystemTimestamp;
@@ -19,6 +22,11 @@ using opentelemetry::trace::SpanContext;
 class MockSampler final : public Sampler
 {
 public:
+  MockSampler() noexcept
+      : attributes_{{{"sampling_attr1", 123}, {"sampling_attr2", "string"}}},
+        attributes_view_{attributes_}
+  {}
+
   SamplingResult ShouldSample(const SpanContext * /*parent_context*/,
                               trace_api::TraceId /*trace_id*/,
                               nostd::string_view /*name*/,
@@ -26,13 +34,15 @@ public:
                               const trace_api::KeyValueIterable & /*attributes*/) noexcept override
   {
     // Return two pairs of attributes. These attributes should be added to the span attributes
-    return {Decision::RECORD_AND_SAMPLE,
-            nostd::unique_ptr<const std::map<std::string, opentelemetry::common::AttributeValue>>(
-                new const std::map<std::string, opentelemetry::common::AttributeValue>(
-                    {{"sampling_attr1", 123}, {"sampling_attr2", "string"}}))};
+    return {Decision::RECORD_AND_SAMPLE, &attributes_view_};
   }
 
   std::string GetDescription() const noexcept override { return "MockSampler"; }
+
+private:
+  using Attributes = std::array<std::pair<nostd::string_view, common::AttributeValue>, 2>;
+  Attributes attributes_;
+  trace_api::KeyValueIterableView<Attributes> attributes_view_;
 };
 
 /**
@@ -302,3 +312,75 @@ TEST(Tracer, SpanSetAttribute)
   auto &span_data = spans_received->at(0);
   ASSERT_EQ(3.1, nostd::get<double>(span_data->GetAttributes().at("abc")));
 }
+
+TEST(Tracer, SpanAddEvent)
+{
+  std::shared_ptr<std::vector<std::unique_ptr<SpanData>>> spans_received(
+      new std::vector<std::unique_ptr<SpanData>>);
+  auto tracer = initTracer(spans_received);
+
+  auto span = tracer->StartSpan("span 1");
+
+  span->AddEvent("event 1");
+  span->AddEvent("event 2", SystemTimestamp(std::chrono::nanoseconds(2)));
+  span->AddEvent("event 3", SystemTimestamp(std::chrono::nanoseconds(3)), {{"attr1", 1}});
+
+  span->End();
+  span->AddEvent("event 4");
+  ASSERT_EQ(1, spans_received->size());
+  auto &span_data = spans_received->at(0);
+  ASSERT_EQ(3, span_data->GetEventCount());
+  ASSERT_EQ("event 1", span_data->GetEvent(0).GetName());
+  ASSERT_NE(0, span_data->GetEvent(0).GetTimestamp().time_since_epoch().count());
+  ASSERT_EQ("event 2", span_data->GetEvent(1).GetName());
+  ASSERT_EQ(std::chrono::nanoseconds(2), span_data->GetEvent(1).GetTimestamp().time_since_epoch());
+  ASSERT_EQ("event 3", span_data->GetEvent(2).GetName());
+  auto &attributes = span_data->GetEvent(2).GetAttributes();
+  ASSERT_EQ(1, attributes.size());
+  ASSERT_EQ("attr1", attributes[0].first);
+  ASSERT_EQ(1, nostd::get<int64_t>(attributes[0].second));
+}
+
+TEST(Tracer, SpanSamplingAttributes)
+{
+  std::shared_ptr<std::vector<std::unique_ptr<SpanData>>> spans_received(
+      new std::vector<std::unique_ptr<SpanData>>);
+  auto tracer = initTracer(spans_received, std::make_shared<MockSampler>());
+
+  tracer->StartSpan("span 1", {{"attr1", 1}, {"sampling_attr1", 0}})->End();
+
+  ASSERT_EQ(1, spans_received->size());
+  auto &attributes = spans_received->at(0)->GetAttributes();
+  ASSERT_EQ(3, attributes.size());
+  ASSERT_EQ(1, nostd::get<int64_t>(attributes.at("attr1")));
+  ASSERT_EQ(123, nostd::get<int64_t>(attributes.at("sampling_attr1")));
+  ASSERT_EQ("string", nostd::get<std::string>(attributes.at("sampling_attr2")));
+}
+
+TEST(Tracer, ScopedSpanInStorage)
+{
+  std::shared_ptr<std::vector<std::unique_ptr<SpanData>>> spans_received(
+      new std::vector<std::unique_ptr<SpanData>>);
+  auto tracer = initTracer(spans_received);
+
+  {
+    opentelemetry::trace::ScopedSpan span(*tracer, "span 1", {{"attr1", 1}});
+    EXPECT_TRUE(span.IsInStorage());
+    EXPECT_TRUE(span->IsRecording());
+    EXPECT_EQ(tracer.get(), &span->tracer());
+    span->SetAttribute("attr2", 2);
+    ASSERT_EQ(0, spans_received->size());
+  }
+
+  ASSERT_EQ(1, spans_received->size());
+  EXPECT_EQ("span 1", spans_received->at(0)->GetName());
+  EXPECT_EQ(2, spans_received->at(0)->GetAttributes().size());
+
+  auto tracer_off = initTracer(spans_received, std::make_shared<AlwaysOffSampler>());
+  {
+    opentelemetry::trace::ScopedSpan span(*tracer_off, "span 2");
+    EXPECT_TRUE(span.IsInStorage());
+    EXPECT_FALSE(span->IsRecording());
+  }
+  EXPECT_EQ(1, spans_received->size());
+}